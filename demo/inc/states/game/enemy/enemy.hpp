@@ -25,6 +25,7 @@ using Tyra::Renderer;
 using Tyra::Renderer3DUtility;
 using Tyra::TextureRepository;
 using Tyra::Vec4;
+using Tyra::VoiceRequest;
 
 namespace Demo {
 
@@ -57,6 +58,7 @@ class Enemy {
   Vec4 terrainRightDown;
 
   Audio* audio;
+  VoiceRequest voice;
   EnemyInfo info;
 };
 
@@ -20,7 +20,6 @@ using Tyra::Vec4;
 namespace Demo {
 
 struct EnemyInfo {
-  unsigned char adpcmChannel;
   audsrv_adpcm_t* adpcmPunch;
   audsrv_adpcm_t* adpcmDeath;
   DynamicMesh* motherMesh;
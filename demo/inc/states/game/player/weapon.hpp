@@ -21,6 +21,7 @@ using Tyra::StaticMesh;
 using Tyra::TextureRepository;
 using Tyra::Timer;
 using Tyra::Vec4;
+using Tyra::VoiceRequest;
 
 namespace Demo {
 
@@ -41,14 +42,12 @@ class Weapon {
   Audio* audio;
   Timer shootTimer;
   Vec4 initialPosition;
-  unsigned char adpcmCurrentChannel;
-  unsigned char adpcmChannelsCount;
+  VoiceRequest shootVoice;
 
   audsrv_adpcm_t* shootAdpcm;
 
   void shoot();
   void allocateOptions();
-  unsigned char getShootChannel();
 };
 
 }  // namespace Demo
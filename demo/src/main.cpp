@@ -14,6 +14,7 @@
 
 int main() {
   Tyra::EngineOptions options;
+  options.audioVoices.channelsCount = 24;
 
   if (Demo::IS_REAL_PS2_VIA_USB) {
     options.writeLogsToFile = true;
@@ -52,7 +52,9 @@ Enemy::Enemy(Engine* engine, const EnemyInfo& t_info) {
   mesh->translation.translateY(-5.0F);
 
   audio = &engine->audio;
-  audio->adpcm.setVolume(30, info.adpcmChannel);
+  voice.category = 2;
+  voice.volume = 30;
+  voice.maxDistance = 2000.0F;
 
   allocateOptions();
 
@@ -110,7 +112,8 @@ void Enemy::handlePlayerShoot(const PlayerShootAction& shootAction) {
 
   if (isOnEnemy) {
     setMeshToSpawn();
-    audio->adpcm.tryPlay(info.adpcmDeath, info.adpcmChannel);
+    voice.priority = 150;
+    audio->voices.play(info.adpcmDeath, *mesh->getPosition(), voice);
   }
 }
 
@@ -145,7 +148,8 @@ void Enemy::fight() {
 void Enemy::animationCallback(const AnimationSequenceCallback& callback) {
   if (callback == AnimationSequenceCallback::AnimationSequenceCallback_Loop) {
     if (isFighting) {
-      audio->adpcm.tryPlay(info.adpcmPunch, info.adpcmChannel);
+      voice.priority = 100;
+      audio->voices.play(info.adpcmPunch, *mesh->getPosition(), voice);
     }
   }
 }
@@ -68,6 +68,7 @@ void GameState::update() {
 
   // Game logic
   player->update(terrain->heightmap);
+  engine->audio.voices.setListener(player->getPosition());
   skybox->update(player->getPosition());
   auto shootAction = player->getShootAction();
   enemyManager->update(terrain->heightmap, player->getPosition(), shootAction);
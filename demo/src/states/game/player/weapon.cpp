@@ -51,13 +51,10 @@ Weapon::Weapon(Engine* engine) {
 
   isShootAnimation1 = isShootAnimation2 = false;
 
-  adpcmChannelsCount = 8;
-  adpcmCurrentChannel = 0;
-
-  const unsigned char shootVolume = 25;
-  for (unsigned char i = 0; i < adpcmChannelsCount; i++) {
-    audio->adpcm.setVolume(shootVolume, i);
-  }
+  shootVoice.priority = 200;
+  shootVoice.category = 1;
+  shootVoice.volume = 25;
+  audio->voices.setCategoryLimit(shootVoice.category, 8);
 }
 
 Weapon::~Weapon() {
@@ -66,15 +63,6 @@ Weapon::~Weapon() {
   delete shootAdpcm;
 }
 
-unsigned char Weapon::getShootChannel() {
-  auto result = adpcmCurrentChannel++;
-
-  if (adpcmCurrentChannel >= adpcmChannelsCount) {
-    adpcmCurrentChannel = 0;
-  }
-  return result;
-}
-
 void Weapon::update() {
   isShooting = false;
 
@@ -113,7 +101,7 @@ void Weapon::update() {
 void Weapon::shoot() {
   isShooting = true;
   shootTimer.prime();
-  audio->adpcm.tryPlay(shootAdpcm, getShootChannel());
+  audio->voices.play(shootAdpcm, shootVoice);
   isShootAnimation1 = true;
 }
 
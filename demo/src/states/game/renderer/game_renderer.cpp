@@ -10,8 +10,6 @@
 
 #include "states/game/renderer/game_renderer.hpp"
 
-using Tyra::Threading;
-
 namespace Demo {
 
 GameRenderer::GameRenderer(Renderer* t_renderer) {
@@ -62,8 +60,6 @@ void GameRenderer::render() {
     }
   }
 
-  Threading::switchThread();  // give some time for audio thread
-
   // Render animated stuff
   if (dynamicPairs.size()) {
     renderer->renderer3D.usePipeline(&dypip);
@@ -73,8 +69,6 @@ void GameRenderer::render() {
     }
   }
 
-  Threading::switchThread();
-
   // Render debug stuff after stapip/dynpip, otherwise it will not be visible
   for (auto& bbox : bboxes) {
     renderer->renderer3D.utility.drawBBox(bbox);
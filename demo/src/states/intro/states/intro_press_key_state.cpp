@@ -15,7 +15,6 @@ using Tyra::FileUtils;
 using Tyra::Math;
 using Tyra::PngLoader;
 using Tyra::SpriteMode;
-using Tyra::Threading;
 
 namespace Demo {
 
@@ -156,8 +155,6 @@ void IntroPressKeyState::update() {
 
   updateMap();
 
-  Threading::switchThread();
-
   for (unsigned char i = 0; i < mapRows; i++)
     for (unsigned char j = 0; j < mapCols; j++)
       engine->renderer.renderer2D.render(mapSprites[i][j]);
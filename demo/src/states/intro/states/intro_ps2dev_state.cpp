@@ -12,7 +12,6 @@
 
 using Tyra::FileUtils;
 using Tyra::PngLoader;
-using Tyra::Threading;
 
 namespace Demo {
 
@@ -41,8 +40,6 @@ void IntroPs2DevState::onStart() {
                        settings.getHeight() / 2 - sprite->size.y / 2);
   sprite->color.a = 0;
 
-  Threading::switchThread();
-
   texture = engine->renderer.core.texture.repository.add(
       FileUtils::fromCwd("intro/ps2dev.png"));
   texture->addLink(sprite->id);
@@ -87,8 +84,6 @@ void IntroPs2DevState::update() {
     }
   }
 
-  Threading::switchThread();
-
   if (fadeoutActivated && frameSkipper == 0) {
     if (sprite->color.a > 0)
       sprite->color.a -= 4;
@@ -13,7 +13,6 @@
 using Tyra::FileUtils;
 using Tyra::Math;
 using Tyra::PngLoader;
-using Tyra::Threading;
 
 namespace Demo {
 
@@ -64,8 +63,6 @@ void IntroTyraState::onStart() {
       FileUtils::fromCwd("intro/tyra_bg.png"));
   bgTexture->addLink(bgSprite->id);
 
-  Threading::switchThread();
-
   bg2Texture = engine->renderer.core.texture.repository.add(
       FileUtils::fromCwd("intro/tyra_bg2.png"));
   bg2Texture->addLink(bg2Sprite->id);
@@ -142,8 +139,6 @@ void IntroTyraState::update() {
       _wantFinish = true;
   }
 
-  Threading::switchThread();
-
   engine->renderer.renderer2D.render(bgSprite);
   engine->renderer.renderer2D.render(bg2Sprite);
   engine->renderer.renderer2D.render(tyraSprite);
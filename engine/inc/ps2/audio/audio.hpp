@@ -13,6 +13,8 @@
 
 #include "./audio_adpcm.hpp"
 #include "./audio_song.hpp"
+#include "./audio_sound_bank.hpp"
+#include "./audio_voices.hpp"
 
 namespace Tyra {
 
@@ -23,10 +25,16 @@ class Audio {
   ~Audio();
 
   void init();
+  void init(const AudioStreamOptions& songStreamOptions);
+  void init(const AudioStreamOptions& songStreamOptions,
+            const AudioVoicesOptions& voicesOptions);
 
   AudioSong song;
   AudioAdpcm adpcm;
 
+  /** Prioritized ADPCM playing, on top of adpcm. Off by default. */
+  AudioVoices voices;
+
   void work();
 
  private:
@@ -13,6 +13,7 @@
 
 #include "./audio_listener_ref.hpp"
 #include "./adpcm_result.hpp"
+#include "file/archive_reader.hpp"
 #include <audsrv.h>
 #include <string>
 
@@ -38,6 +39,19 @@ class AudioAdpcm {
   audsrv_adpcm_t* load(const char* t_path);
   audsrv_adpcm_t* load(const std::string& t_path);
 
+  /**
+   * Load ADPCM sample from memory (for example from sound bank).
+   * Data is uploaded into SPU memory, so it can be freed after.
+   */
+  audsrv_adpcm_t* load(const unsigned char* t_data,
+                       const unsigned int& t_size);
+
+  /**
+   * Load ADPCM sample from archive.
+   * @param t_name Entry name. Example: "sounds/jump.adpcm"
+   */
+  audsrv_adpcm_t* load(ArchiveReader& t_archive, const std::string& t_name);
+
   /**
    * Frees up all memory taken by samples, and stops all voices from
    * being played.
@@ -54,7 +68,7 @@ class AudioAdpcm {
 
   /**
    * Play ADPCM sample, if channel is occupied, wait for it.
-   * If not used properly, can hugely reduce performance.
+   * Channel is checked once per VBlank, so it can block for a long time.
    * @param t_adpcm ADPCM data, created by load();
    * @param t_ch Channel (0-23). Type -1 for use any free channel.
    */
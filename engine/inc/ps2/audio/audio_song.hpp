@@ -12,6 +12,9 @@
 #pragma once
 
 #include "./audio_listener_ref.hpp"
+#include "./audio_stream.hpp"
+#include "thread/threading_event.hpp"
+#include "thread/threading_semaphore.hpp"
 #include <audsrv.h>
 #include <string>
 #include <vector>
@@ -26,11 +29,15 @@ class AudioSong {
   ~AudioSong();
 
   void init();
+  void init(const AudioStreamOptions& options);
 
   bool inLoop;
 
   /**
-   * Load 16bit 22kHz Stereo WAV.
+   * Load mono/stereo WAV, 8/16bit PCM or IMA ADPCM.
+   * IMA ADPCM is recommended, because it needs 4x less I/O.
+   * It can be created with "wav2ima" tool or with ffmpeg
+   * (-acodec adpcm_ima_wav). 22kHz is recommended.
    * Can be used multiple times for song switching.
    * @param t_path Example: "host:song.wav" or "host:folder/song.wav"
    */
@@ -65,26 +72,37 @@ class AudioSong {
 
   std::size_t getListenersCount() const;
 
+  /** Read-ahead statistics, like underruns or amount of reads. */
+  const AudioStreamStats& getStreamStats() const { return stream.getStats(); }
+
+  void resetStreamStats() { stream.resetStats(); }
+
   void work();
 
  private:
   bool songLoaded, songPlaying, songFinished;
   unsigned char tyraVolume, audsrvVolume;
-  FILE* wav;
   audsrv_fmt_t format;
+  AudioStream stream;
   std::vector<AudioListenerRef*> songListeners;
 
-  ee_sema_t sema;
-  int fillbufferSema;
+  /** Signaled by audsrv when it needs next chunk. */
+  ThreadingSemaphore fillbufferSema;
+
+  /** Set when song starts playing, so idle audio thread can sleep. */
+  ThreadingEvent playEvent;
   static const unsigned short chunkSize;
-  char* chunk;
-  int chunkReadStatus;
+  static const unsigned int headerReadSize;
+  AudioStreamSlot* slot;
+  unsigned int slotOffset;
 
   void initSema();
   void initAUDSRV();
-  void setSongFormat();
+  void setSongFormat(const int& bits, const int& freq, const int& channels);
   void unloadSong();
   void rewindSongToStart();
+  void releaseSlot();
+  void onSlotFinished();
 };
 
 }  // namespace Tyra
@@ -0,0 +1,62 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./audio_adpcm.hpp"
+#include <audsrv.h>
+#include <string>
+#include <vector>
+
+namespace Tyra {
+
+/**
+ * Many ADPCM samples in one file, loaded with single read.
+ * Bank is an output of "soundbank" tool.
+ */
+class AudioSoundBank {
+ public:
+  AudioSoundBank();
+  ~AudioSoundBank();
+
+  /**
+   * Load whole bank and upload all samples into SPU memory.
+   * @param t_path Example: "host:sounds.bank"
+   */
+  void load(AudioAdpcm* t_adpcm, const char* t_path);
+  void load(AudioAdpcm* t_adpcm, const std::string& t_path);
+
+  /**
+   * Returns sample.
+   * nullptr if not found.
+   * @param t_name Filename of sample without extension. Example: "shoot"
+   */
+  audsrv_adpcm_t* get(const char* t_name) const;
+
+  unsigned int getCount() const {
+    return static_cast<unsigned int>(samples.size());
+  }
+
+  /**
+   * Delete sample handles.
+   * SPU memory is freed only by AudioAdpcm::reset().
+   */
+  void unload();
+
+ private:
+  struct Sample {
+    unsigned int nameHash;
+    audsrv_adpcm_t* adpcm;
+  };
+
+  std::vector<Sample> samples;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,114 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./audio_stream_options.hpp"
+#include "audio/audio_stream_ring.hpp"
+#include "audio/wav_info.hpp"
+#include "thread/threading_event.hpp"
+#include "thread/threading_semaphore.hpp"
+#include <kernel.h>
+#include <stdio.h>
+
+namespace Tyra {
+
+/**
+ * Read-ahead ring buffer.
+ * Slots are filled by separate, low priority reader thread, so
+ * playback thread never waits for the device.
+ * One producer (reader thread) and one consumer (playback) only.
+ */
+class AudioStream {
+ public:
+  AudioStream();
+  ~AudioStream();
+
+  void init(const AudioStreamOptions& options);
+
+  /**
+   * Start streaming of WAV data described by t_info.
+   * PCM is copied as is, IMA ADPCM is decoded into 16bit PCM
+   * by the reader thread.
+   * Stream takes ownership of the file.
+   */
+  void open(FILE* t_file, const WavInfo& t_info);
+
+  /** Restart streaming from the beginning of data. */
+  void rewind();
+
+  /** Stop streaming and close the file. */
+  void close();
+
+  /** If true, reader will continue from the start after end of the data. */
+  void setLoop(const bool& t_loop) { loop = t_loop; }
+
+  /**
+   * Get next filled slot. Blocks if reader is behind (underrun).
+   * Slots from before last open()/rewind() are skipped.
+   */
+  AudioStreamSlot* acquire() { return ring.acquire(); }
+
+  /** Give oldest acquired slot back to the reader. */
+  void release() { ring.release(); }
+
+  /** False if slot was filled before last open()/rewind(). */
+  bool isCurrent(const AudioStreamSlot* t_slot) const {
+    return ring.isCurrent(t_slot);
+  }
+
+  void onPlayed(const unsigned int& t_bytes) { stats.bytesPlayed += t_bytes; }
+
+  const AudioStreamStats& getStats() const { return stats; }
+  void resetStats();
+
+  const AudioStreamOptions& getOptions() const { return options; }
+
+  void readerWork();
+
+ private:
+  AudioStreamOptions options;
+  AudioStreamStats stats;
+  AudioStreamSlot* slots;
+  AudioStreamRing ring;
+  unsigned char* compressed;
+  unsigned int compressedSize;
+
+  ThreadingSemaphore mutexSema;
+
+  /** Wakes up idle reader (end of data) after open()/rewind(). */
+  ThreadingEvent requestEvent;
+
+  FILE* file;
+  WavInfo info;
+  long remaining, position;
+  bool loop, endOfData;
+
+  FILE* requestedFile;
+  WavInfo requestedInfo;
+
+  /** Generation of ring, which reader works on. */
+  unsigned int generation;
+
+  ee_thread_t thread;
+  int threadId;
+  static const unsigned int threadStackSize;
+  unsigned char* threadStack;
+
+  void initThread();
+  void request(FILE* t_file, const WavInfo& t_info);
+  void applyRequest();
+  void seekToStart();
+  void fillSlot(AudioStreamSlot* slot);
+  long readPcm(AudioStreamSlot* slot);
+  long readImaAdpcm(AudioStreamSlot* slot);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,46 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+struct AudioStreamOptions {
+  /**
+   * Size of single ring buffer slot in bytes.
+   * Every slot is filled by one read request, so bigger slots means
+   * fewer (but longer) I/O requests.
+   */
+  unsigned int slotSize = 32 * 1024;
+
+  /** Amount of slots in ring buffer. Minimum 2. */
+  unsigned int slotsCount = 4;
+
+  /**
+   * Reads will start on multiple of this value.
+   * 2048 is a sector size of CD/DVD.
+   */
+  unsigned int readAlignment = 2048;
+
+  /**
+   * Priority of the reader thread.
+   * Should be lower (bigger value) than priority of the audio thread.
+   */
+  int readerPriority = 0x6;
+
+  /**
+   * Additional delay after every read in ms.
+   * Simulates slow device (for example DVD seek), useful for testing
+   * if ring buffer size is big enough for your data source.
+   */
+  unsigned int simulatedReadLatency = 0;
+};
+
+}  // namespace Tyra
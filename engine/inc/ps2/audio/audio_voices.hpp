@@ -0,0 +1,79 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "audio/voice_manager.hpp"
+#include "math/vec4.hpp"
+#include <audsrv.h>
+
+namespace Tyra {
+
+class AudioVoicesBackend : public VoiceBackend {
+ public:
+  bool play(const int& t_channel, void* t_sample) override;
+  bool isPlaying(const int& t_channel, void* t_sample) override;
+  void setVolume(const int& t_channel, const unsigned char& t_volume) override;
+};
+
+struct AudioVoicesOptions {
+  /**
+   * ADPCM channels owned by voices. 0 -> voices are off, so every
+   * channel stays free for AudioAdpcm::tryPlay().
+   */
+  unsigned int channelsCount = 0;
+
+  unsigned int firstChannel = 0;
+};
+
+/**
+ * Prioritized ADPCM voices.
+ * Picks channel automatically, steals less important voices
+ * and culls sounds which are too far from the listener.
+ * Do not use AudioAdpcm::tryPlay() on channels owned by this class.
+ */
+class AudioVoices {
+ public:
+  AudioVoices();
+  ~AudioVoices();
+
+  /** Use all 24 channels. */
+  void init();
+
+  /** Use channels from t_firstChannel to t_firstChannel + t_count - 1. */
+  void init(const unsigned int& t_firstChannel, const unsigned int& t_count);
+
+  VoiceResult play(audsrv_adpcm_t* t_adpcm, const VoiceRequest& t_request);
+
+  /**
+   * Play sample positioned in the world.
+   * Distance to the listener is calculated from t_position.
+   * Set maxDistance in request to enable falloff and culling.
+   */
+  VoiceResult play(audsrv_adpcm_t* t_adpcm, const Vec4& t_position,
+                   const VoiceRequest& t_request);
+
+  /** Position of the listener, usually camera position. */
+  void setListener(const Vec4& t_position) { listener = t_position; }
+
+  void setCategoryLimit(const unsigned char& t_category,
+                        const unsigned int& t_limit) {
+    manager.setCategoryLimit(t_category, t_limit);
+  }
+
+  const VoiceStats& getStats() const { return manager.getStats(); }
+
+ private:
+  AudioVoicesBackend backend;
+  VoiceManager manager;
+  Vec4 listener;
+};
+
+}  // namespace Tyra
@@ -13,9 +13,12 @@
 #include "./renderer/renderer.hpp"
 #include "./pad/pad.hpp"
 #include "./audio/audio.hpp"
+#include "./loaders/async/async_loader.hpp"
 #include "./irx/irx_loader.hpp"
+#include "./math/vu0_jobs.hpp"
 #include "./info/info.hpp"
 #include "./info/banner.hpp"
+#include "./time/fixed_timestep.hpp"
 #include "./game.hpp"
 
 namespace Tyra {
@@ -28,6 +31,30 @@ struct EngineOptions {
   bool writeLogsToFile = false;
 
   bool loadUsbDriver = false;
+
+  /** Read-ahead settings of background song streaming. */
+  AudioStreamOptions songStream;
+
+  /** ADPCM channels given to audio.voices. None by default. */
+  AudioVoicesOptions audioVoices;
+
+  /** Background asset loading thread settings. */
+  AsyncLoaderOptions asyncLoader;
+
+  /** Framebuffers and presentation settings. */
+  RendererOptions renderer;
+
+  /**
+   * True -> game->update() runs at fixed rate and game->render() once
+   * per frame, instead of game->loop().
+   */
+  bool fixedTimestep = false;
+
+  /** Updates per second. 0 -> video refresh rate (50 PAL, 59.94 NTSC) */
+  float fixedTimestepRate = 0.0F;
+
+  /** Lag above this amount of updates per frame is dropped */
+  unsigned int maxUpdatesPerFrame = 4;
 };
 
 class Engine {
@@ -39,18 +66,27 @@ class Engine {
   Renderer renderer;
   Pad pad;
   Audio audio;
+  AsyncLoader asyncLoader;
   Info info;
 
+  /** Batched math on VU0 (micro mode) */
+  Vu0Jobs vu0Jobs;
+
   void run(Game* t_game);
 
+  const FixedTimestep& getTimestep() const { return timestep; }
+
  private:
   IrxLoader irx;
 
   Game* game;
   Banner banner;
+  bool isFixedTimestep;
+  FixedTimestep timestep;
 
   void realLoop();
-  void initAll(const bool& loadUsbDriver);
+  void fixedLoop();
+  void initAll(const EngineOptions& options);
 };
 
 }  // namespace Tyra
@@ -0,0 +1,111 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "archive/archive_file.hpp"
+#include <stdio.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Tyra {
+
+/** Entry data, 64 bytes aligned (ready for DMA). */
+class ArchiveData {
+ public:
+  ArchiveData();
+  ArchiveData(const unsigned int& t_size);
+  ArchiveData(ArchiveData&& other);
+  ArchiveData& operator=(ArchiveData&& other);
+  ArchiveData(const ArchiveData&) = delete;
+  ArchiveData& operator=(const ArchiveData&) = delete;
+  ~ArchiveData();
+
+  unsigned char* data;
+  unsigned int size;
+
+  /** Release ownership. Must be freed by Memory::free(). */
+  unsigned char* release();
+};
+
+struct ArchiveReaderStats {
+  unsigned int reads;
+  unsigned int bytesRead;
+};
+
+/**
+ * Reads entries of archive made by tools/archive.
+ * TOC is read on open(), so finding entry costs no IO.
+ * Not thread safe, use from single thread (for example from
+ * AsyncLoader jobs).
+ */
+class ArchiveReader {
+ public:
+  ArchiveReader();
+  ~ArchiveReader();
+
+  /** Max gap between entries which are still read together by preload(). */
+  static const unsigned int preloadMaxGap;
+
+  /** Max size of single read made by preload(). */
+  static const unsigned int preloadMaxReadSize;
+
+  /** @param t_path Full path, for example FileUtils::fromCwd("level1.tya") */
+  void open(const std::string& t_path);
+  void close();
+
+  bool isOpened() const { return file != nullptr; }
+
+  bool has(const std::string& t_name) const;
+
+  /** @returns Unpacked size of entry. */
+  unsigned int getSize(const std::string& t_name) const;
+
+  /**
+   * Read (and decompress) entry. Asserts if not found.
+   * Empty entry is returned without data (nullptr, size 0).
+   */
+  ArchiveData read(const std::string& t_name);
+
+  /**
+   * Read many entries with few big sequential reads.
+   * Data is kept in memory and next read() calls are served from it,
+   * until releasePreloaded().
+   */
+  void preload(const std::vector<std::string>& t_names);
+
+  void releasePreloaded();
+
+  const ArchiveReaderStats& getStats() const { return stats; }
+
+ private:
+  FILE* file;
+  std::string path;
+  unsigned int fileSize;
+  unsigned char* toc;
+  ArchiveReaderStats stats;
+
+  /**
+   * Preloaded spans, and entry name hash -> span index.
+   * Not keyed by offset, because empty entry has offset of the next one.
+   */
+  std::vector<ArchiveData> spans;
+  std::vector<unsigned int> spanOffsets;
+  std::unordered_map<unsigned int, unsigned int> preloaded;
+
+  const ArchiveEntry* find(const std::string& t_name) const;
+  void readAt(const unsigned int& offset, unsigned char* output,
+              const unsigned int& size);
+  ArchiveData unpack(const ArchiveEntry* entry, const unsigned char* stored,
+                     const std::string& name);
+};
+
+}  // namespace Tyra
@@ -15,7 +15,22 @@ namespace Tyra {
 class Game {
  public:
   virtual void init() = 0;
-  virtual void loop() = 0;
+
+  /** Called once per frame, when fixed timestep is off */
+  virtual void loop() {}
+
+  /**
+   * Fixed timestep mode (EngineOptions::fixedTimestep).
+   * Called 0 - n times per frame, with constant step in seconds.
+   */
+  virtual void update(const float& t_step) {}
+
+  /**
+   * Fixed timestep mode, called once per frame after updates.
+   * @param t_alpha Progress to next update (0 - 1), for interpolation
+   * between previous and current state.
+   */
+  virtual void render(const float& t_alpha) {}
 };
 
 }  // namespace Tyra
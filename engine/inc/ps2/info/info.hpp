@@ -10,8 +10,8 @@
 
 #pragma once
 
-#include <stddef.h>
 #include "time/timer.hpp"
+#include "time/frame_stats.hpp"
 #include "./version.hpp"
 
 namespace Tyra {
@@ -28,19 +28,30 @@ class Info {
   /** Called by engine */
   void update();
 
+  /** Average of last FrameStats::windowSize frames */
   const unsigned int& getFps() const { return fps; };
 
-  /** @return Available RAM in MB */
+  /** Duration of last frame in seconds, for current video mode */
+  const float& getFrameTime() const { return frameTime; }
+
+  /** Frame times in microseconds, with percentiles and histogram */
+  const FrameStats& getFrameStats() const { return frameStats; }
+
+  /**
+   * Cheap, can be called every frame.
+   * Per subsystem usage -> Memory::getTracker()
+   * @return Available RAM in MB
+   */
   float getAvailableRAM();
 
  private:
   float calcFps();
-  void* allocateLargestFreeRAMBlock(size_t* size);
-  size_t getFreeRAMSize();
 
   unsigned char fpsDelayer;
   unsigned int fps;
+  float frameTime;
   Timer timer;
+  FrameStats frameStats;
 };
 
 }  // namespace Tyra
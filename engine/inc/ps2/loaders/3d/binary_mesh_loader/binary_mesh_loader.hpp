@@ -0,0 +1,46 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "../builder/mesh_builder_data.hpp"
+#include "file/archive_reader.hpp"
+#include <string>
+#include <memory>
+
+namespace Tyra {
+
+/**
+ * Class responsible for loading precooked ".tym" meshes
+ * (tools/meshcook output). No parsing, just a single read and copies.
+ */
+class BinaryMeshLoader {
+ public:
+  static std::unique_ptr<MeshBuilderData> load(const char* fullpath);
+  static std::unique_ptr<MeshBuilderData> load(const std::string& fullpath);
+
+  /**
+   * Load from archive.
+   * @param name Entry name. Example: "meshes/zombie.tym"
+   */
+  static std::unique_ptr<MeshBuilderData> load(ArchiveReader& archive,
+                                               const std::string& name);
+
+  /** Load from memory. Data can be freed after. */
+  static std::unique_ptr<MeshBuilderData> load(const unsigned char* data,
+                                               const unsigned int& size,
+                                               const std::string& name);
+
+ private:
+  template <typename T>
+  static T* copyArray(const float* source, const unsigned int& count);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,35 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./mesh_builder_data.hpp"
+#include "mesh/mesh_optimizer.hpp"
+
+namespace Tyra {
+
+/**
+ * Runs MeshOptimizer on loaded mesh data.
+ * For big meshes prefer offline optimization (tools/meshcook -O),
+ * this pass temporarily needs twice the mesh memory.
+ */
+class MeshBuilderOptimizer {
+ public:
+  static MeshOptimizerStats optimize(MeshBuilderData* t_data);
+  static MeshOptimizerStats optimize(MeshBuilderData* t_data,
+                                     const MeshOptimizerOptions& t_options);
+
+ private:
+  static void toSource(MeshBuilderData* data, BinaryMeshSource& output);
+  static void fromSource(const BinaryMeshSource& source,
+                         MeshBuilderData* output);
+};
+
+}  // namespace Tyra
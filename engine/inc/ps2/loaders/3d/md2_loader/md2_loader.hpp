@@ -13,6 +13,7 @@
 #include "../builder/mesh_builder_data.hpp"
 #include <string>
 #include <memory>
+#include "file/archive_reader.hpp"
 
 namespace Tyra {
 
@@ -30,6 +31,23 @@ class MD2Loader {
   static std::unique_ptr<MeshBuilderData> load(const std::string& fullpath);
   static std::unique_ptr<MeshBuilderData> load(const std::string& fullpath,
                                                MD2LoaderOptions options);
+
+  /**
+   * Load from archive.
+   * @param name Entry name. Example: "meshes/warrior.md2"
+   */
+  static std::unique_ptr<MeshBuilderData> load(ArchiveReader& archive,
+                                               const std::string& name,
+                                               MD2LoaderOptions options);
+
+  /**
+   * Load from memory.
+   * @param name Filename, used for material and texture name.
+   */
+  static std::unique_ptr<MeshBuilderData> load(const unsigned char* data,
+                                               const unsigned int& size,
+                                               const std::string& name,
+                                               MD2LoaderOptions options);
 };
 
 }  // namespace Tyra
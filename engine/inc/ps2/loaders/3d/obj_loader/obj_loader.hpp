@@ -11,9 +11,11 @@
 #pragma once
 
 #include "../builder/mesh_builder_data.hpp"
+#include "../builder/mesh_builder_optimizer.hpp"
 #include <string>
 #include "renderer/models/color.hpp"
 #include "loaders/3d/obj_loader/tiny_obj_loader.hpp"
+#include "file/archive_reader.hpp"
 #include <memory.h>
 #include <optional>
 
@@ -28,6 +30,12 @@ struct ObjLoaderOptions {
   bool flipUVs = false;
   float scale = 1.0F;
   ObjLoaderAnimationOptions animation;
+
+  /**
+   * Run MeshBuilderOptimizer after load (degenerates removal, materials
+   * merge, spatial triangle sort). Slower load, better VU1 packages.
+   */
+  bool optimize = false;
 };
 
 struct MaterialVertexCount {
@@ -45,7 +53,30 @@ class ObjLoader {
   static std::unique_ptr<MeshBuilderData> load(const std::string& fullpath,
                                                const ObjLoaderOptions& options);
 
+  /**
+   * Load obj (and its mtl) from archive.
+   * @param name Entry name. Example: "meshes/warrior.obj"
+   */
+  static std::unique_ptr<MeshBuilderData> load(ArchiveReader& archive,
+                                               const std::string& name,
+                                               const ObjLoaderOptions& options);
+
  private:
+  static std::string getFramePath(const std::string& path,
+                                  const unsigned short& index,
+                                  const unsigned short& count);
+
+  /** Returns mtllib filename from obj text, empty if not found. */
+  static std::string getMtlLibName(const std::string& objText);
+
+  static tinyobj::ObjReaderConfig getReaderConfig(
+      const ObjLoaderOptions& options);
+
+  static void processFrame(MeshBuilderData* output,
+                           const tinyobj::ObjReader& reader,
+                           const bool& parsed, const unsigned short& index,
+                           const ObjLoaderOptions& options);
+
   static void addOutputMaterialsAndFrames(
       MeshBuilderData* output, const tinyobj::attrib_t& attrib,
       const std::vector<tinyobj::shape_t>& shapes,
@@ -0,0 +1,147 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./async_loader_job.hpp"
+#include "./async_loader_options.hpp"
+#include "loaders/3d/builder/mesh_builder_data.hpp"
+#include "loaders/3d/obj_loader/obj_loader.hpp"
+#include "loaders/3d/md2_loader/md2_loader.hpp"
+#include "loaders/texture/base/texture_loader_selector.hpp"
+#include "renderer/core/texture/texture_repository.hpp"
+#include "audio/audio_adpcm.hpp"
+#include "thread/threading_event.hpp"
+#include "thread/threading_semaphore.hpp"
+#include <kernel.h>
+#include <string>
+#include <vector>
+
+namespace Tyra {
+
+/**
+ * Loads assets on background thread.
+ * Every job has two steps: work() on loader thread (file reading,
+ * parsing, decoding) and finalize() on main thread, called from update()
+ * (VRAM, audsrv, repositories and everything else which is not thread
+ * safe).
+ */
+class AsyncLoader {
+ public:
+  AsyncLoader();
+  ~AsyncLoader();
+
+  void init();
+  void init(const AsyncLoaderOptions& options);
+
+  /**
+   * Finalize loaded jobs. Called by engine every frame.
+   * If loader thread is waiting for CPU, main thread sleeps for 0.5ms,
+   * so loading progresses also with frame limit off.
+   */
+  void update();
+
+  /**
+   * Add custom job.
+   * @param t_priority Higher value = loaded earlier.
+   * @param t_estimateMemory Optional, used by memory budget.
+   */
+  AsyncLoaderHandle add(std::function<void()> t_work,
+                        std::function<void()> t_finalize,
+                        const int& t_priority = 0,
+                        std::function<unsigned int()> t_estimateMemory =
+                            nullptr);
+
+  /** Add custom job with result, created on loader thread. */
+  template <typename T>
+  std::shared_ptr<AsyncLoaderResult<T>> load(
+      std::function<std::unique_ptr<T>()> t_work,
+      std::function<void(AsyncLoaderResult<T>&)> t_onLoaded = nullptr,
+      const int& t_priority = 0,
+      std::function<unsigned int()> t_estimateMemory = nullptr) {
+    auto result = std::make_shared<AsyncLoaderResult<T>>();
+    AsyncLoaderResult<T>* ptr = result.get();
+    result->job = add([ptr, t_work]() { ptr->value = t_work(); },
+                      [result, t_onLoaded]() {
+                        if (t_onLoaded) t_onLoaded(*result);
+                      },
+                      t_priority, t_estimateMemory);
+    return result;
+  }
+
+  std::shared_ptr<AsyncLoaderResult<MeshBuilderData>> loadObj(
+      const std::string& t_path, const ObjLoaderOptions& t_options,
+      const int& t_priority = 0);
+
+  std::shared_ptr<AsyncLoaderResult<MeshBuilderData>> loadMd2(
+      const std::string& t_path, const MD2LoaderOptions& t_options,
+      const int& t_priority = 0);
+
+  /**
+   * Load texture and add it to repository (on main thread).
+   * @param t_onLoaded Optional, called on main thread.
+   */
+  AsyncLoaderHandle loadTexture(
+      const std::string& t_path, TextureRepository* t_repository,
+      std::function<void(Texture*)> t_onLoaded = nullptr,
+      const int& t_priority = 0);
+
+  /**
+   * Read ADPCM file on loader thread, upload it into SPU on main thread.
+   * @param t_onLoaded Called on main thread. Sample must be deleted by user.
+   */
+  AsyncLoaderHandle loadAdpcm(
+      const std::string& t_path, AudioAdpcm* t_adpcm,
+      std::function<void(audsrv_adpcm_t*)> t_onLoaded,
+      const int& t_priority = 0);
+
+  /**
+   * Cancel job which is still in queue.
+   * @returns False if job was already started.
+   */
+  bool cancel(const AsyncLoaderHandle& t_job);
+
+  /** Jobs waiting, loading or waiting for finalization. */
+  unsigned int getPendingCount() const { return pendingCount; }
+
+  bool isIdle() const { return pendingCount == 0; }
+
+  /** Estimated memory of jobs being loaded and not finalized yet. */
+  unsigned int getInFlightMemory() const { return inFlightMemory; }
+
+  void loaderWork();
+
+ private:
+  AsyncLoaderOptions options;
+  std::vector<AsyncLoaderHandle> queue;
+  std::vector<AsyncLoaderHandle> loaded;
+  unsigned int lastId;
+  volatile unsigned int pendingCount;
+  volatile unsigned int inFlightMemory;
+
+  ThreadingSemaphore mutex;
+  ThreadingSemaphore queuedSema;
+  ThreadingEvent memoryReleasedEvent;
+  TextureLoaderSelector textureLoaderSelector;
+
+  ee_thread_t thread;
+  int threadId;
+  unsigned char* threadStack;
+
+  void initThread();
+  AsyncLoaderHandle popMostImportant();
+  static void releaseClosures(const AsyncLoaderHandle& t_job);
+  bool isLoaderStarved() const;
+  bool fitsIntoBudget(const unsigned int& cost) const;
+
+  static unsigned int getFileSize(const std::string& path);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,67 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+namespace Tyra {
+
+enum AsyncLoaderJobState {
+  ASYNC_JOB_QUEUED,
+  ASYNC_JOB_LOADING,
+
+  /** Loaded, waiting for finalization on main thread. */
+  ASYNC_JOB_LOADED,
+
+  ASYNC_JOB_DONE,
+  ASYNC_JOB_CANCELLED
+};
+
+struct AsyncLoaderJob {
+  unsigned int id;
+
+  /** Higher value = loaded earlier. */
+  int priority;
+
+  /** Runs on loader thread. No VRAM/audsrv/renderer calls here! */
+  std::function<void()> work;
+
+  /** Runs on main thread, in AsyncLoader::update(). */
+  std::function<void()> finalize;
+
+  /** Runs on loader thread before work(). Optional. */
+  std::function<unsigned int()> estimateMemory;
+
+  unsigned int memoryCost;
+  volatile AsyncLoaderJobState state;
+
+  bool isDone() const { return state == ASYNC_JOB_DONE; }
+};
+
+using AsyncLoaderHandle = std::shared_ptr<AsyncLoaderJob>;
+
+/** Value loaded by AsyncLoader. Ready after finalization. */
+template <typename T>
+class AsyncLoaderResult {
+ public:
+  AsyncLoaderHandle job;
+  std::unique_ptr<T> value;
+
+  bool isReady() const { return job && job->isDone(); }
+
+  T* get() const { return isReady() ? value.get() : nullptr; }
+
+  /** Take ownership of loaded value. */
+  std::unique_ptr<T> take() { return isReady() ? std::move(value) : nullptr; }
+};
+
+}  // namespace Tyra
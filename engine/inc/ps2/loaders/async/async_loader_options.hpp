@@ -0,0 +1,39 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+struct AsyncLoaderOptions {
+  /**
+   * Priority of the loader thread.
+   * Default is lower than main thread, so loading happens when main
+   * thread waits for VSync. When that is not enough (e.g. frame limit
+   * off), update() gives loader 0.5ms per frame. For faster loading set
+   * it higher (smaller value) than Threading::mainThreadPriority.
+   */
+  int threadPriority = 0x30;
+
+  /** Loaders (tinyobj, libpng) need big stack. */
+  unsigned int threadStackSize = 64 * 1024;
+
+  /**
+   * Max estimated bytes of jobs which are loading or waiting for
+   * finalization. Next job waits until some memory is released.
+   * Single job bigger than budget is still loaded, alone.
+   */
+  unsigned int memoryBudget = 8 * 1024 * 1024;
+
+  /** Max finalizations in single update(), to keep frame time stable. */
+  unsigned int maxFinalizationsPerUpdate = 4;
+};
+
+}  // namespace Tyra
@@ -28,6 +28,14 @@ class TextureLoader {
     return load(fullpath.c_str());
   }
 
+  /**
+   * @brief Loads texture data from memory (for example from archive).
+   * @param name Texture name, usually filename.
+   */
+  virtual TextureBuilderData* load(const unsigned char* data,
+                                   const unsigned int& size,
+                                   const std::string& name) = 0;
+
   unsigned int getTextureSize(const unsigned int& width,
                               const unsigned int& height,
                               const TextureBpp& bpp);
@@ -31,5 +31,8 @@ class TextureBuilderData {
   unsigned char* clut;
   TextureBpp clutBpp;
   unsigned char clutGsComponents;
+
+  /** True when data and clut were allocated by Memory::allocate() */
+  bool isMemoryTracked;
 };
 }  // namespace Tyra
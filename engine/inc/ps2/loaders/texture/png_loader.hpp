@@ -43,7 +43,13 @@ class PngLoader : public TextureLoader {
 
   TextureBuilderData* load(const char* fullpath);
 
+  TextureBuilderData* load(const unsigned char* data, const unsigned int& size,
+                           const std::string& name);
+
  private:
+  TextureBuilderData* read(png_structp pngPtr, png_infop infoPtr,
+                           const std::string& filename);
+
   void handle32bpp(TextureBuilderData* result, png_structp pngPtr,
                    png_infop infoPtr, png_bytep* rowPointers);
 
@@ -63,6 +69,14 @@ class PngLoader : public TextureLoader {
                             png_infop infoPtr, png_bytep* rowPointers,
                             png_colorp palette, png_bytep trans,
                             const int& numPallete, const int& numTrans);
+
+  /**
+   * Decode image into texture data rows of given stride.
+   * Rows are decoded in place when PNG row size matches, otherwise
+   * (for example odd width 4bpp) through temporary buffer.
+   */
+  void readImage(png_structp pngPtr, unsigned char* data, const int& height,
+                 const int& rowBytes, const int& stride);
 };
 
 }  // namespace Tyra
@@ -0,0 +1,128 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "loaders/async/async_loader.hpp"
+#include "renderer/3d/mesh/static/static_mesh.hpp"
+#include "world/world_streaming_planner.hpp"
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Tyra {
+
+struct WorldStreamerStats {
+  unsigned int residentCells, loadingCells;
+
+  /** Memory reserved by resident and loading cells, in bytes */
+  unsigned int ramUsed, vramUsed;
+
+  unsigned int loadsCount, evictionsCount;
+
+  /** Required cells which didn't fit into budgets, in last update */
+  unsigned int overBudget;
+
+  /** Cell load latency (request -> resident), in frames */
+  unsigned int lastLatency, maxLatency;
+  float averageLatency;
+};
+
+/**
+ * Pages world cells (tools/worldsplit output) in and out around camera.
+ * Cell meshes and textures are loaded by AsyncLoader, under RAM and VRAM
+ * budgets. Render getMeshes() with StaticPipeline.
+ *
+ * Usage:
+ * streamer.init("world/world.tyw", &engine->asyncLoader,
+ *               &renderer.getTextureRepository(), options);
+ * // every frame
+ * streamer.update(cameraPosition);
+ * for (auto* mesh : streamer.getMeshes()) stapip.render(mesh);
+ */
+class WorldStreamer {
+ public:
+  WorldStreamer();
+  ~WorldStreamer();
+
+  void init(const std::string& t_layoutPath, AsyncLoader* t_loader,
+            TextureRepository* t_repository);
+  void init(const std::string& t_layoutPath, AsyncLoader* t_loader,
+            TextureRepository* t_repository,
+            const WorldStreamingOptions& t_options);
+
+  /** Plans loads/evictions. Call once per frame. */
+  void update(const Vec4& t_cameraPosition);
+
+  /**
+   * Unloads resident cells, cancels queued loads.
+   * Loads already started are dropped when they finish.
+   */
+  void unloadAll();
+
+  /** Meshes of resident cells, in world space */
+  const std::vector<StaticMesh*>& getMeshes() const { return meshes; }
+
+  const WorldStreamerStats& getStats() const { return stats; }
+
+  unsigned int getCellsCount() const;
+
+  WorldCellState getCellState(const unsigned int& t_index) const {
+    return states[t_index];
+  }
+
+  WorldStreamingOptions options;
+
+ private:
+  struct Cell {
+    StaticMesh* mesh;
+    std::shared_ptr<AsyncLoaderResult<MeshBuilderData>> job;
+    unsigned int requestFrame;
+
+    /** Bumped by unloadAll(), so loads started before it are dropped */
+    unsigned int generation;
+
+    /** Texture, material id */
+    std::vector<std::pair<Texture*, unsigned int>> links;
+  };
+
+  struct TextureSlot {
+    Texture* texture;
+    unsigned int refs;
+    AsyncLoaderHandle job;
+  };
+
+  std::string directory;
+  unsigned char* layout;
+  AsyncLoader* loader;
+  TextureRepository* repository;
+
+  std::vector<WorldCellState> states;
+  std::vector<Cell> cells;
+  std::vector<TextureSlot> textures;
+  std::vector<StaticMesh*> meshes;
+  WorldStreamerStats stats;
+  unsigned int frame, latencySum, loadedCount;
+
+  /** Jobs finalized after destruction check it */
+  std::shared_ptr<bool> alive;
+
+  void load(const unsigned int& index, const int& priority);
+  void evict(const unsigned int& index);
+  void acquireTexture(const unsigned int& index, const int& priority);
+  void releaseTexture(const unsigned int& index);
+  void onTextureLoaded(const unsigned int& index, Texture* texture);
+  void tryToFinish(const unsigned int& index);
+  void linkTextures(const unsigned int& index);
+  void free();
+};
+
+}  // namespace Tyra
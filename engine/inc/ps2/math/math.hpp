@@ -29,6 +29,9 @@ class Math {
   static float acos(const float& x);
   static float sin(const float& x);
   static float tan(const float& x);
+
+  /** sin and cos with one range reduction, see TrigKernels */
+  static void sinCos(const float& x, float* o_sin, float* o_cos);
   static float invSqrt(const float& x);
   static float randomf(const float& min, const float& max);
   static int randomi(const int& min, const int& max);
@@ -0,0 +1,93 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "math/vec4.hpp"
+#include "math/m4x4.hpp"
+#include <string>
+
+namespace Tyra {
+
+/**
+ * Unit quaternion rotation (x, y, z - vector part, w - scalar part).
+ * Cheaper to compose and interpolate than rotation M4x4.
+ * Host versions of operations are in QuatMath.
+ */
+class Quat {
+ public:
+  union {
+    struct {
+      float x;
+      float y;
+      float z;
+      float w;
+    };
+    VECTOR xyzw alignas(sizeof(float) * 4);
+  };
+
+  /** (0,0,0,1) - no rotation */
+  static const Quat Identity;
+
+  /** Initialize Quat without setting default values */
+  Quat() {}
+
+  Quat(const float& x, const float& y, const float& z, const float& w)
+      : x(x), y(y), z(z), w(w) {}
+
+  Quat(const Quat& v) { set(v); }
+
+  /** From rotation part of matrix */
+  explicit Quat(const M4x4& matrix);
+
+  /** Axis does not have to be normalized */
+  static Quat fromAxisAngle(const Vec4& axis, const float& radians);
+
+  /** -Z (camera forward) turned into forward, +Y close to up */
+  static Quat lookRotation(const Vec4& forward,
+                           const Vec4& up = Vec4(0.0F, 1.0F, 0.0F, 0.0F));
+
+  void operator=(const Quat& v) { set(v); }
+
+  /** Composition (VU0): first v, then this */
+  Quat operator*(const Quat& v) const;
+  void operator*=(const Quat& v);
+
+  /** Rotate xyz of vector */
+  Vec4 operator*(const Vec4& v) const;
+
+  void set(const Quat& v);
+  void set(const float& x, const float& y, const float& z, const float& w);
+
+  /** Inverse of unit quaternion */
+  Quat conjugate() const;
+
+  float dot(const Quat& v) const;
+  float length() const;
+
+  void normalize();
+  Quat getNormalized() const;
+
+  /** Rotation matrix without translation */
+  M4x4 toM4x4() const;
+
+  /** Normalized lerp. Cheap, good enough for small steps */
+  static Quat nlerp(const Quat& from, const Quat& to, const float& interp);
+
+  /** Spherical lerp, constant angular speed */
+  static Quat slerp(const Quat& from, const Quat& to, const float& interp);
+
+  void print() const;
+  void print(const char* name) const;
+  void print(const std::string& name) const { print(name.c_str()); }
+  std::string getPrint(const char* name = nullptr) const;
+};
+
+}  // namespace Tyra
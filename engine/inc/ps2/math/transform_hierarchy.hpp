@@ -0,0 +1,52 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./transform_node.hpp"
+#include <vector>
+
+namespace Tyra {
+
+/**
+ * Flat list of transform nodes, sorted so parents are before children.
+ * update() walks it once and recalculates dirty world matrices, so every
+ * node is calculated at most once per frame and later getWorldMatrix()
+ * calls are just reads. Order is rebuilt only when tree was changed.
+ */
+class TransformHierarchy {
+ public:
+  TransformHierarchy();
+  ~TransformHierarchy();
+
+  /** Node can be in one hierarchy. Children are not added. */
+  void add(TransformNode* t_node);
+  void remove(TransformNode* t_node);
+  void clear();
+
+  /** Call once per frame, after game logic and before rendering */
+  void update();
+
+  const std::vector<TransformNode*>& getNodes() const { return nodes; }
+
+  /** World matrices recalculated in last update() */
+  unsigned int getLastUpdatedCount() const { return lastUpdatedCount; }
+
+ private:
+  friend class TransformNode;
+
+  std::vector<TransformNode*> nodes;
+  bool isOrderDirty;
+  unsigned int lastUpdatedCount;
+
+  void sort();
+};
+
+}  // namespace Tyra
@@ -0,0 +1,90 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./m4x4.hpp"
+#include "./quat.hpp"
+#include "./vec4.hpp"
+#include <vector>
+
+namespace Tyra {
+
+class TransformHierarchy;
+
+/**
+ * Node of transform tree: local position, rotation and scale plus
+ * parent/child links. World matrix (parent world * local) is cached and
+ * recalculated only when node or one of its parents was changed.
+ *
+ * Meshes (Mesh::transform) and cameras (CameraInfo3D) can be attached.
+ * Use TransformHierarchy to update all nodes in one pass per frame.
+ */
+class TransformNode {
+ public:
+  TransformNode();
+
+  /** Children are detached and become roots */
+  ~TransformNode();
+
+  /** nullptr -> root. Local transform is kept (not world). */
+  void setParent(TransformNode* t_parent);
+  TransformNode* getParent() const { return parent; }
+  const std::vector<TransformNode*>& getChildren() const { return children; }
+
+  void setPosition(const Vec4& t_position);
+  void setRotation(const M4x4& t_rotation);
+  void setRotation(const Quat& t_rotation);
+  void setScale(const Vec4& t_scale);
+  void setScale(const float& t_scale);
+
+  const Vec4& getPosition() const { return position; }
+  const M4x4& getRotation() const { return rotation; }
+  const Vec4& getScale() const { return scale; }
+
+  /** Translation * rotation * scale */
+  const M4x4& getLocalMatrix() const;
+
+  /** Recalculated (with dirty parents) only if needed */
+  const M4x4& getWorldMatrix() const;
+
+  Vec4 getWorldPosition() const;
+
+  /** Local point (w = 1) or direction (w = 0) to world space */
+  Vec4 toWorld(const Vec4& t_local) const;
+
+  bool isWorldDirty() const { return isWorldMatrixDirty; }
+
+  /** Incremented every time world matrix is recalculated */
+  unsigned int getWorldVersion() const { return worldVersion; }
+
+  /** Distance to root */
+  unsigned int getDepth() const;
+
+ private:
+  friend class TransformHierarchy;
+
+  TransformNode* parent;
+  std::vector<TransformNode*> children;
+  TransformHierarchy* hierarchy;
+
+  Vec4 position, scale;
+  M4x4 rotation;
+
+  mutable M4x4 localMatrix, worldMatrix;
+  mutable bool isLocalMatrixDirty, isWorldMatrixDirty;
+  mutable unsigned int worldVersion;
+
+  void onLocalChanged();
+  void markWorldDirty();
+  void updateWorld() const;
+};
+
+}  // namespace Tyra
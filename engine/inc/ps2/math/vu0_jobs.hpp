@@ -0,0 +1,107 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <packet2.h>
+#include <vector>
+
+namespace Tyra {
+
+enum Vu0JobKernel {
+  VU0_JOB_TRANSFORM,
+  VU0_JOB_CULL,
+  VU0_JOB_MORPH,
+  VU0_JOB_SKIN,
+  VU0_JOB_KERNELS_COUNT
+};
+
+struct Vu0Job {
+  Vu0JobKernel kernel;
+
+  /** Transform/cull matrix or skinning bones */
+  const float* matrix;
+  unsigned int bonesCount;
+
+  const float* inputs[3];
+  void* output;
+  float interp;
+
+  unsigned int count, done;
+};
+
+/**
+ * Batched math on VU0 in micro mode.
+ * Jobs are split into chunks which fit VU0 memory (vu0_kernels_defines.h)
+ * and sent via VIF0, so VU0 works while EE continues with game logic.
+ * Every poll() collects finished chunk and kicks next one.
+ *
+ * Inputs must be qword aligned and alive until job is done.
+ * VU0 macro mode (Vec4, M4x4) stalls while chunk is running.
+ * Host reference of every kernel: Vu0Kernels.
+ */
+class Vu0Jobs {
+ public:
+  Vu0Jobs();
+  ~Vu0Jobs();
+
+  void init();
+
+  /** See Vu0Kernels::transform() */
+  void transform(const float* t_matrix, const float* t_vertices,
+                 float* o_vertices, const unsigned int& t_count);
+
+  /** See Vu0Kernels::cullBoxes() */
+  void cullBoxes(const float* t_matrix, const float* t_boxes,
+                 unsigned int* o_flags, const unsigned int& t_count);
+
+  /** See Vu0Kernels::morph() */
+  void morph(const float* t_from, const float* t_to, const float& t_interp,
+             float* o_vertices, const unsigned int& t_count);
+
+  /** See Vu0Kernels::skin(). Max VU0_SKIN_MAX_BONES bones. */
+  void skin(const float* t_bones, const unsigned int& t_bonesCount,
+            const float* t_positions, const float* t_weights,
+            const int* t_indices, float* o_positions,
+            const unsigned int& t_count);
+
+  /**
+   * Non blocking.
+   * @returns true if all jobs are done
+   */
+  bool poll();
+
+  /** Blocks until all jobs are done */
+  void wait();
+
+  bool isIdle() const { return jobs.empty() && !isChunkInFlight; }
+
+ private:
+  std::vector<Vu0Job> jobs;
+  unsigned int programAddresses[VU0_JOB_KERNELS_COUNT];
+  unsigned int chunkCount;
+  bool isChunkInFlight;
+  packet2_t* packet;
+
+  void add(const Vu0Job& t_job);
+  void uploadPrograms();
+  void kick(const Vu0Job& t_job);
+  void collect(Vu0Job* t_job);
+  void addData(const unsigned int& t_address, const void* t_data,
+               const unsigned int& t_qwords);
+  void addHeader(const unsigned int& t_address, const float& t_interp);
+  bool isVu0Busy() const;
+
+  static unsigned int getMaxCount(const Vu0JobKernel& t_kernel);
+  static unsigned int getOutputAddress(const Vu0JobKernel& t_kernel,
+                                       const unsigned int& t_count);
+};
+
+}  // namespace Tyra
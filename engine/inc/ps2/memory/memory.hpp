@@ -0,0 +1,68 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "memory/memory_tracker.hpp"
+#include "thread/threading_semaphore.hpp"
+
+namespace Tyra {
+
+/**
+ * Engine wide tracked heap.
+ * Engine subsystems allocate their big buffers here (textures, meshes,
+ * audio), game can use MEMORY_CATEGORY_GAME. All queries are cheap, so
+ * they can be called every frame.
+ * Thread safe after init() (async loader allocates from its thread).
+ */
+class Memory {
+ public:
+  /** Called by engine, before any other thread is started */
+  static void init();
+
+  /** Not locked, so only for reading (counters can be one block behind) */
+  static MemoryTracker& getTracker() { return tracker; }
+
+  static void* allocate(const unsigned int& t_size,
+                        const MemoryCategory& t_category);
+  static void* allocate(const unsigned int& t_size,
+                        const MemoryCategory& t_category,
+                        const unsigned int& t_alignment);
+
+  /** Pointer has to come from allocate() */
+  static void free(void* t_pointer);
+
+  /** Going over budget traps in debug build */
+  static void setBudget(const MemoryCategory& t_category,
+                        const unsigned int& t_bytes);
+
+  /** Free heap bytes (malloc free lists + not yet claimed heap) */
+  static unsigned int getFreeRAM();
+
+  /** 1 - largest free block / free bytes, 0 - 1 */
+  static float getHeapFragmentation();
+
+  /** Called by engine at the end of frame */
+  static void onFrameEnd();
+
+  static void print();
+
+ private:
+  static MemoryTracker tracker;
+  static ThreadingSemaphore lock;
+  static bool isInitialized;
+
+  static void wait();
+  static void signal();
+  static void onBudgetExceeded(const MemoryCategory& t_category,
+                               const MemoryCategoryStats& t_stats);
+};
+
+}  // namespace Tyra
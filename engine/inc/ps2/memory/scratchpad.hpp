@@ -0,0 +1,50 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "memory/scratchpad_arena.hpp"
+
+namespace Tyra {
+
+/**
+ * EE scratchpad RAM (SPR) - 16KB of fast memory, not cached.
+ * CPU access is as fast as cache hit and DMA can read/write it directly,
+ * so data built here doesn't need FlushCache() before DMA transfer.
+ *
+ * Allocations are stack based (see ScratchpadArena), so free in reverse
+ * order.
+ */
+class Scratchpad {
+ public:
+  static const unsigned int address;
+  static const unsigned int size;
+
+  static ScratchpadArena& getArena();
+
+  /** Offset of SPR pointer, as used by DMA SADR and chain tags */
+  static unsigned int getOffset(const void* t_pointer);
+
+  /** DMA copy (toSPR channel). Waits for finish. */
+  static void copyTo(void* t_spr, const void* t_ram,
+                     const unsigned int& t_qwords);
+
+  /** DMA copy (fromSPR channel). Waits for finish. */
+  static void copyFrom(void* t_ram, const void* t_spr,
+                       const unsigned int& t_qwords);
+
+ private:
+  static ScratchpadArena arena;
+  static bool isInitialized;
+
+  static void init();
+};
+
+}  // namespace Tyra
@@ -0,0 +1,55 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./scratchpad.hpp"
+#include "memory/scratchpad_double_buffer.hpp"
+#include <packet2.h>
+
+namespace Tyra {
+
+/**
+ * Double buffered DMA chain packet in scratchpad.
+ * Packet is built in one half while the other one is being sent.
+ * It is sent by DMA straight from SPR, so no FlushCache() is needed,
+ * but data has to be copied inline (open_unpack + add), not referenced
+ * by ref tags from main RAM.
+ */
+class ScratchpadPacket {
+ public:
+  ScratchpadPacket();
+  ~ScratchpadPacket();
+
+  /** @param t_qwords Size of one half */
+  void init(const unsigned short& t_qwords);
+
+  /** Releases scratchpad memory, must be the last allocation. */
+  void free();
+
+  /**
+   * Switch half and reset its packet.
+   * Previous transfer from this half must be finished - so
+   * dma_channel_wait() before every send, as pipelines do.
+   */
+  packet2_t* next();
+
+  packet2_t* get() { return &packets[buffer.getIndex()]; }
+
+  /** Send current packet, without cache flush. */
+  void send(const int& t_channel);
+
+ private:
+  ScratchpadDoubleBuffer buffer;
+  packet2_t packets[2];
+  unsigned int marker;
+};
+
+}  // namespace Tyra
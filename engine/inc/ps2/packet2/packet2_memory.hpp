@@ -0,0 +1,82 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <packet2.h>
+
+namespace Tyra {
+
+enum Packet2MemoryType {
+  /** Regular cached RAM. Packet must be written back before DMA. */
+  PACKET2_MEMORY_CACHED,
+
+  /**
+   * Uncached accelerated segment. Writes skip D-cache and go through
+   * write-back buffer, so only a "sync.l" is needed before DMA.
+   * Use it for write-only packets.
+   */
+  PACKET2_MEMORY_UCAB,
+};
+
+enum Packet2FlushType {
+  /** Packet is UCAB and references nothing written by CPU */
+  PACKET2_FLUSH_NONE,
+
+  /** Write back only packet memory. Referenced data is not touched by CPU */
+  PACKET2_FLUSH_PACKET,
+
+  /** Write back whole D-cache. Packet references CPU written data */
+  PACKET2_FLUSH_ALL,
+};
+
+struct Packet2MemoryStats {
+  unsigned int sends;
+  unsigned int fullFlushes;
+  unsigned int rangeFlushes;
+  unsigned int skippedFlushes;
+};
+
+/**
+ * Packet memory policy.
+ * Every DMA send site declares what memory its packet lives in and what
+ * must be written back, instead of flushing whole D-cache each time.
+ */
+class Packet2Memory {
+ public:
+  /** Ranges bigger than this are written back by full flush */
+  static const unsigned int maxRangeFlushSize;
+
+  static packet2_t* create(const unsigned short& t_qwords,
+                           const Packet2MemoryType& t_type,
+                           const Packet2Mode& t_mode,
+                           const unsigned char& t_tte);
+
+  /** Flushes according to flush type and sends packet (no wait) */
+  static void send(packet2_t* t_packet, const int& t_channel,
+                   const Packet2FlushType& t_flush);
+
+  /** Writes back given memory range (or whole D-cache if too big) */
+  static void flushRange(const void* t_start, const void* t_end);
+
+  /** Called by renderer at the end of frame */
+  static void onFrameEnd();
+
+  /** Counters of previous frame */
+  static const Packet2MemoryStats& getLastFrameStats();
+
+ private:
+  static Packet2MemoryStats current;
+  static Packet2MemoryStats lastFrame;
+
+  static bool isUcab(const packet2_t* t_packet);
+};
+
+}  // namespace Tyra
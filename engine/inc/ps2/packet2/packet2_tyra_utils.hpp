@@ -30,6 +30,26 @@ class Packet2TyraUtils {
     packet2_vif_close_unpack_manual(packet2, t_size);
   }
 
+  /**
+   * Same as addUnpackData(), but data is copied into packet instead of
+   * being referenced. Required for packets in scratchpad.
+   * @param t_size In qwords
+   */
+  inline static void addInlineUnpackData(packet2_t* packet2,
+                                         const unsigned int& t_dest_address,
+                                         const void* t_data,
+                                         const unsigned int& t_size,
+                                         const unsigned char& t_use_top) {
+    const auto* data = reinterpret_cast<const qword_t*>(t_data);
+
+    packet2_utils_vu_open_unpack(packet2, t_dest_address, t_use_top);
+    for (unsigned int i = 0; i < t_size; i++) {
+      *packet2->next = data[i];
+      packet2_advance_next(packet2, sizeof(qword_t));
+    }
+    packet2_utils_vu_close_unpack(packet2);
+  }
+
   inline static void addM4x4(packet2_t* packet2, const M4x4& val) {
     *(reinterpret_cast<M4x4*>(packet2->next)) = val;
     packet2_advance_next(packet2, sizeof(MATRIX));
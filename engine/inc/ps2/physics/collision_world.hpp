@@ -0,0 +1,58 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "physics/collision_bvh.hpp"
+#include "physics/ray.hpp"
+#include "renderer/3d/mesh/static/static_mesh.hpp"
+
+namespace Tyra {
+
+/**
+ * Collision against static level geometry (CollisionBvh), for Vec4/Ray.
+ * Add level meshes at load, then call build() once.
+ */
+class CollisionWorld {
+ public:
+  CollisionWorld();
+  ~CollisionWorld();
+
+  /** First frame of every material, in world space (model matrix) */
+  void add(const StaticMesh* t_mesh);
+
+  void build();
+  void clear();
+
+  /** @param t_maxDistance Along normalized ray direction */
+  bool raycast(const Ray& t_ray, const float& t_maxDistance,
+               CollisionHit* o_hit) const;
+
+  bool isOccluded(const Vec4& t_from, const Vec4& t_to) const;
+
+  /** @param t_direction Normalized */
+  bool sweepSphere(const Vec4& t_center, const float& t_radius,
+                   const Vec4& t_direction, const float& t_distance,
+                   CollisionHit* o_hit) const;
+
+  bool sweepCapsule(const Vec4& t_a, const Vec4& t_b, const float& t_radius,
+                    const Vec4& t_direction, const float& t_distance,
+                    CollisionHit* o_hit) const;
+
+  bool closestPoint(const Vec4& t_point, const float& t_maxDistance,
+                    CollisionHit* o_hit) const;
+
+  const CollisionBvh& getBvh() const { return bvh; }
+
+ private:
+  CollisionBvh bvh;
+};
+
+}  // namespace Tyra
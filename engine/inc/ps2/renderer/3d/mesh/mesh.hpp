@@ -11,6 +11,7 @@
 #pragma once
 
 #include "math/m4x4.hpp"
+#include "math/transform_node.hpp"
 #include "./mesh_material.hpp"
 
 #include "debug/debug.hpp"
@@ -29,12 +30,22 @@ class Mesh {
 
   M4x4 translation, rotation, scale;
 
+  /**
+   * Optional transform node (not owned, nullptr by default).
+   * When set, translation/rotation/scale are relative to node.
+   */
+  const TransformNode* transform;
+
   /** nullptr if not found */
   MeshMaterial* getMaterialByName(const std::string& name);
 
   std::vector<MeshMaterial*> materials;
 
-  M4x4 getModelMatrix() const;
+  /**
+   * Node world matrix * translation * rotation * scale.
+   * Cached, recalculated only when one of them was changed.
+   */
+  const M4x4& getModelMatrix() const;
 
   /** Get position from translation matrix */
   inline Vec4* getPosition() {
@@ -45,6 +56,18 @@ class Mesh {
 
  protected:
   void init();
+
+ private:
+  /**
+   * Matrices are public, so changes are found by comparing them with
+   * copies from last calculation.
+   */
+  mutable M4x4 modelMatrix, cachedTranslation, cachedRotation, cachedScale;
+  mutable const TransformNode* cachedTransform;
+  mutable unsigned int cachedTransformVersion;
+  mutable bool isModelMatrixValid;
+
+  bool isModelMatrixDirty() const;
 };
 
 }  // namespace Tyra
@@ -28,6 +28,9 @@ class MeshMaterial {
   unsigned int id;
   std::string name;
   std::optional<std::string> textureName;
+
+  /** Texture filename with extension, for example "warrior.png" */
+  std::optional<std::string> textureFilename;
   Color ambient;
 
   std::vector<MeshMaterialFrame*> frames;
@@ -0,0 +1,68 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./static_mesh.hpp"
+#include "renderer/core/texture/texture_repository.hpp"
+#include <vector>
+
+namespace Tyra {
+
+/** Where geometry of one source material landed in the batch */
+struct StaticBatchEntry {
+  /** Index of source mesh, in order of StaticBatchBuilder::add() calls */
+  unsigned int sourceIndex;
+
+  /** Index of source mesh material */
+  unsigned int sourceMaterialIndex;
+
+  unsigned int chunkIndex, materialIndex;
+
+  /** Vertex range in chunk material */
+  unsigned int firstVertex, count;
+};
+
+/**
+ * Result of StaticBatchBuilder.
+ * Every chunk is a regular static mesh with world space vertices
+ * (identity model matrix), so it can be rendered and frustum culled
+ * by StaticPipeline like any other mesh.
+ */
+class StaticBatch {
+ public:
+  StaticBatch();
+  ~StaticBatch();
+
+  std::vector<StaticMesh*> chunks;
+
+  std::vector<StaticBatchEntry> entries;
+
+  /** Mesh material id of the first source of every chunk material */
+  std::vector<std::vector<unsigned int>> sourceMaterialIds;
+
+  /** @returns entries of given source mesh */
+  std::vector<StaticBatchEntry> getEntries(
+      const unsigned int& sourceIndex) const;
+
+  /** @returns total vertex count of all chunks */
+  unsigned int getVertexCount() const;
+
+  /**
+   * Links textures of source meshes with batch materials.
+   * Source meshes textures have to be already in repository.
+   */
+  void linkTextures(TextureRepository* repository) const;
+
+  /** Removes links created by linkTextures() */
+  void unlinkTextures(TextureRepository* repository) const;
+};
+
+}  // namespace Tyra
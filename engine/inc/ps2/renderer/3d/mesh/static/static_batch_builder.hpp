@@ -0,0 +1,101 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./static_batch.hpp"
+#include "loaders/3d/builder/mesh_builder_data.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace Tyra {
+
+struct StaticBatchOptions {
+  /**
+   * World space size of one chunk (cube edge).
+   * Source meshes are assigned to chunks by their bbox center, so chunks
+   * can be culled separately. 0 -> everything goes into one chunk.
+   */
+  float chunkSize = 0.0F;
+};
+
+/**
+ * Merges many small static meshes, which never move, into a few big ones.
+ * Vertices are pre-transformed into world space and geometry is grouped
+ * by material (texture + ambient), which replaces hundreds of tiny draws
+ * with a few large ones.
+ *
+ * Usage:
+ * StaticBatchBuilder builder;
+ * for (auto* prop : props) builder.add(prop);
+ * auto batch = builder.build(options);
+ * batch->linkTextures(&renderer.getTextureRepository());
+ * for (auto* chunk : batch->chunks) stapip.render(chunk);
+ */
+class StaticBatchBuilder {
+ public:
+  StaticBatchBuilder();
+  ~StaticBatchBuilder();
+
+  /**
+   * Add mesh with its current model matrix.
+   * Mesh data is read only during build(), so it has to live until then.
+   * @returns source index
+   */
+  unsigned int add(const StaticMesh* mesh);
+
+  /** @returns source index */
+  unsigned int add(const StaticMesh* mesh, const M4x4& model);
+
+  unsigned int getSourcesCount() const {
+    return static_cast<unsigned int>(sources.size());
+  }
+
+  void clear();
+
+  std::unique_ptr<StaticBatch> build();
+  std::unique_ptr<StaticBatch> build(const StaticBatchOptions& options);
+
+ private:
+  struct Source {
+    const StaticMesh* mesh;
+    M4x4 model;
+  };
+
+  struct ChunkKey {
+    int x, y, z;
+    bool normals, lightmap;
+  };
+
+  std::vector<Source> sources;
+
+  static ChunkKey getChunkKey(const Source& source,
+                              const StaticBatchOptions& options);
+  static bool isEqual(const ChunkKey& a, const ChunkKey& b);
+  static std::optional<std::string> getTexturePath(
+      const MeshMaterial* material);
+
+  /** @returns index of chunk material, creates new one if not found */
+  static unsigned int getMaterialIndex(MeshBuilderData* data,
+                                       const MeshMaterial* material);
+
+  /**
+   * Inverse transpose of upper 3x3, without translation.
+   * Keeps normals perpendicular under non uniform scale.
+   */
+  static M4x4 getNormalMatrix(const M4x4& model);
+
+  static void allocate(MeshBuilderData* data);
+  static void fill(const Source& source, const StaticBatchEntry& entry,
+                   MeshBuilderMaterialFrameData* output);
+};
+
+}  // namespace Tyra
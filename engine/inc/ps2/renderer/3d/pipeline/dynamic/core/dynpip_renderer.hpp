@@ -11,6 +11,7 @@
 #pragma once
 
 #include "renderer/core/renderer_core.hpp"
+#include "memory/scratchpad_packet.hpp"
 #include "./dynpip_programs_repository.hpp"
 
 namespace Tyra {
@@ -26,7 +27,7 @@ class DynPipRenderer {
   void reinitVU1();
 
   void sendObjectData(DynPipBag* bag, M4x4* mvp,
-                      RendererCoreTextureBuffers* texBuffers) const;
+                      RendererCoreTextureBuffers* texBuffers);
 
   void render(DynPipBag** bags, const unsigned int& count);
 
@@ -54,7 +55,9 @@ class DynPipRenderer {
   packet2_t* programsPacket;
   packet2_t* currentPacket;
   packet2_t* staticDataPacket;
-  packet2_t* objectDataPacket;
+
+  /** Per object header, built and sent from scratchpad */
+  ScratchpadPacket objectDataPackets;
 
   DynPipProgramsRepository* programsRepo;
   RendererCore* rendererCore;
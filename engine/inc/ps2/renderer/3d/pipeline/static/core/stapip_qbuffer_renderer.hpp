@@ -24,6 +24,7 @@
 #include "./stapip_clipper.hpp"
 #include "renderer/core/paths/path1/path1.hpp"
 #include "renderer/core/renderer_core.hpp"
+#include "memory/scratchpad_packet.hpp"
 #include "renderer/core/texture/renderer_core_texture_buffers.hpp"
 
 namespace Tyra {
@@ -42,7 +43,7 @@ class StaPipQBufferRenderer {
   StaPipQBuffer* getBuffer();
 
   void sendObjectData(StaPipBag* bag, M4x4* mvp,
-                      RendererCoreTextureBuffers* texBuffers) const;
+                      RendererCoreTextureBuffers* texBuffers);
 
   void setMaxVertCount(const unsigned int& count);
 
@@ -98,7 +99,9 @@ class StaPipQBufferRenderer {
   StaPipVU1Program** dBufferPrograms;
   StaPipQBuffer** buffers;
   packet2_t* staticDataPacket;
-  packet2_t* objectDataPacket;
+
+  /** Per object header, built and sent from scratchpad */
+  ScratchpadPacket objectDataPackets;
 
   RendererCore* rendererCore;
 
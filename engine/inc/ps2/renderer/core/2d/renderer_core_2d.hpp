@@ -14,6 +14,7 @@
 #include "renderer/core/2d/sprite/sprite.hpp"
 #include "renderer/core/texture/renderer_core_texture_buffers.hpp"
 #include "renderer/core/texture/models/texture.hpp"
+#include "renderer/core/gs/renderer_core_gs.hpp"
 #include "renderer/renderer_settings.hpp"
 #include <packet2_utils.h>
 #include <draw2d.h>
@@ -25,7 +26,8 @@ class RendererCore2D {
   RendererCore2D();
   ~RendererCore2D();
 
-  void init(RendererSettings* settings, clutbuffer_t* clutBuffer);
+  void init(RendererSettings* settings, clutbuffer_t* clutBuffer,
+            const RendererCoreGS* gs);
 
   void render(const Sprite& sprite,
               const RendererCoreTextureBuffers& texBuffers, Texture* texture);
@@ -43,6 +45,7 @@ class RendererCore2D {
   unsigned char context;
   RendererSettings* settings;
   clutbuffer_t* clutBuffer;
+  const RendererCoreGS* gs;
   packet2_t* packets[2];
   texrect_t* rects[2];
 };
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "math/vec4.hpp"
+#include "math/transform_node.hpp"
 
 namespace Tyra {
 
@@ -18,12 +19,24 @@ class CameraInfo3D {
  public:
   CameraInfo3D(const Vec4* cameraPosition, const Vec4* cameraLooksAt,
                const Vec4* cameraUp = nullptr);
+
+  /**
+   * Camera attached to transform node.
+   * Looks along node's -Z axis, up is node's +Y axis.
+   */
+  explicit CameraInfo3D(const TransformNode* transform);
+
+  CameraInfo3D(const CameraInfo3D& other);
+  CameraInfo3D& operator=(const CameraInfo3D& other);
   ~CameraInfo3D();
 
   const Vec4 *position, *looksAt, *up;
 
  private:
   static Vec4 defaultCameraUp;
+
+  /** Storage for transform node camera */
+  Vec4 nodePosition, nodeLooksAt, nodeUp;
 };
 
 }  // namespace Tyra
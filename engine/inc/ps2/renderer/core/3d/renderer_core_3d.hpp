@@ -35,6 +35,12 @@ class RendererCore3D {
 
   void setFov(const float& t_fov);
 
+  /**
+   * Size of area 3D is projected to, screen size by default.
+   * Set by renderer core for reduced resolution rendering.
+   */
+  void setViewport(const float& t_width, const float& t_height);
+
   /**
    * Called by beginFrame();
    * Sets 3D support to off
@@ -88,7 +94,7 @@ class RendererCore3D {
 
  private:
   M4x4 view, projection, viewProj;
-  float fov;
+  float fov, viewportWidth, viewportHeight;
   bool is3DSupportEnabled;
 
   RendererSettings* settings;
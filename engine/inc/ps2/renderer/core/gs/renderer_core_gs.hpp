@@ -24,10 +24,48 @@ class RendererCoreGS {
   zbuffer_t zBuffer;
   RendererCoreGSVRam vram;
 
-  void init(RendererSettings* settings);
+  void init(RendererSettings* settings, const bool& t_tripleBuffering);
 
+  /** Double buffering. Shows drawn frame immediately (call after VSync) */
   void flipBuffers();
 
+  /**
+   * Triple buffering. Waits only for GS to finish drawing, frame is shown
+   * by VSync interrupt. Path1 has to be fenced before (RendererCore).
+   * @param t_waitForQueue True -> if previous frame is still waiting,
+   * wait for VSync. False -> previous frame is dropped.
+   */
+  void queueFlip(const bool& t_waitForQueue);
+
+  const bool& isTripleBuffering() const { return tripleBuffering; }
+
+  /** Frames not shown, because newer one was ready first */
+  const unsigned int& getDroppedFramesCount() const { return droppedFrames; }
+
+  /** Offscreen buffer of screen size, for reduced resolution rendering */
+  void allocateRenderTarget();
+
+  /**
+   * Following drawing goes to top left corner of render target.
+   * Projection has to be scaled to the same size (RendererCore3D).
+   */
+  void beginRenderTarget(const unsigned int& t_width,
+                         const unsigned int& t_height);
+
+  /**
+   * Stretches used part of render target over framebuffer (bilinear),
+   * following drawing goes to framebuffer again.
+   */
+  void resolveRenderTarget();
+
+  const bool& isRenderTargetActive() const { return renderTargetActive; }
+
+  /**
+   * Field rendering. Odd field lines are half of framebuffer line lower,
+   * so drawing is moved up by 0.5px. Returns 0.5 or 0.
+   */
+  float getFieldOffset() const;
+
   void enableZTests();
 
  private:
@@ -35,16 +73,33 @@ class RendererCoreGS {
   constexpr static float screenCenter = gsCenter / 2.0F;
 
   RendererSettings* settings;
-  framebuffer_t frameBuffers[2];
+  framebuffer_t frameBuffers[3];
+  framebuffer_t renderTarget;
+  unsigned int renderTargetWidth, renderTargetHeight;
+  bool renderTargetActive;
+  packet2_t* renderTargetPacket;
+  bool tripleBuffering;
+  unsigned int droppedFrames;
+  int flipHandlerId;
   packet2_t* flipPacket;
   packet2_t* zTestPacket;
   unsigned char context;
   unsigned char currentField;
 
+  /** Read by VSync interrupt handler */
+  static framebuffer_t* displayBuffers;
+  static volatile int displayedBuffer;
+  static volatile int queuedBuffer;
+
+  static int flipHandler(int cause);
+
   void allocateBuffers();
+  void sendFramebuffer(const unsigned char& t_buffer);
   void initDrawingEnvironment();
   void initChannels();
   void updateCurrentField();
+  qword_t* setScissor(qword_t* q, const int& drawContext,
+                      const unsigned int& width, const unsigned int& height);
   qword_t* setXYOffset(qword_t* q, const int& drawContext, const float& x,
                        const float& y);
 };
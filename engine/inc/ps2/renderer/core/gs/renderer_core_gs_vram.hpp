@@ -22,6 +22,9 @@ class RendererCoreGSVRam {
 
   const float& getFreeSpaceInMB();
 
+  /** Framebuffers and zBuffer */
+  float getBuffersSizeInMB() const { return buffersSize / ptr2MB; }
+
   float getSizeInMB(const Texture& texture);
   float getSizeInMB(const TextureData& texData);
   float getSizeInMB(int width, const int& height, const int& psm,
@@ -41,7 +44,7 @@ class RendererCoreGSVRam {
 
   static constexpr float ptr2MB = 262144.0F;
   bool touched;
-  int pointer;
+  int pointer, buffersSize;
   float cachedFreeSpace;
 };
 
@@ -29,6 +29,10 @@ class Path3 {
 
   void sendDrawFinishTag();
   void clearScreen(zbuffer_t* z, const Color& color);
+
+  /** Clears centered area of given size */
+  void clearScreen(zbuffer_t* z, const Color& color, const float& t_width,
+                   const float& t_height);
   void sendTexture(const Texture* texture,
                    const RendererCoreTextureBuffers& texBuffers);
 
@@ -17,6 +17,9 @@
 #include "./paths/path3/path3.hpp"
 #include "./paths/path1/path1.hpp"
 #include "./renderer_core_sync.hpp"
+#include "../renderer_options.hpp"
+#include "renderer/dynamic_resolution.hpp"
+#include "time/timer.hpp"
 
 namespace Tyra {
 
@@ -41,7 +44,7 @@ class RendererCore {
   RendererCoreSync sync;
 
   /** Called by renderer */
-  void init();
+  void init(const RendererOptions& t_options);
 
   /** World background color */
   void setClearScreenColor(const Color& color);
@@ -52,11 +55,26 @@ class RendererCore {
   /** Clear screen and update view frustum for frustum culling. 3D support */
   void beginFrame(const CameraInfo3D& cameraInfo);
 
-  /** VSync and swap frame double buffer. */
+  /**
+   * VSync and swap frame double buffer.
+   * Triple buffering -> queue frame for next VSync.
+   */
   void endFrame();
 
   void setFrameLimit(const bool& onoff) { isFrameLimitOn = onoff; }
 
+  /**
+   * Dynamic resolution only. Stretches reduced resolution 3D over the
+   * screen, so following drawing is full resolution.
+   * Called automatically by first 2D render and endFrame()
+   */
+  void resolve3D();
+
+  /** Scale and measured frame time (RendererOptions::dynamicResolution) */
+  const DynamicResolution& getDynamicResolution() const {
+    return dynamicResolution;
+  }
+
   /** Get screen settings */
   const RendererSettings& getSettings() const { return settings; }
 
@@ -65,11 +83,15 @@ class RendererCore {
   Path3* getPath3() { return &path3; }
 
  private:
-  bool isFrameLimitOn;
+  bool isFrameLimitOn, isDynamicResolutionOn, isScaledFrame;
   Color bgColor;
+  DynamicResolution dynamicResolution;
+  Timer frameTimer;
   RendererSettings settings;
   Path3 path3;
   Path1 path1;
+
+  void initDynamicResolution(const RendererOptions& t_options);
 };
 
 }  // namespace Tyra
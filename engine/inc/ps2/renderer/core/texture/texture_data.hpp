@@ -19,7 +19,7 @@ class TextureData {
  public:
   TextureData(unsigned char* data, const TextureBpp& bpp,
               const unsigned char& gsComponents, const int& width,
-              const int& height);
+              const int& height, const bool& isMemoryTracked);
   ~TextureData();
 
   int width, height;
@@ -28,6 +28,9 @@ class TextureData {
   TextureBpp bpp;
   unsigned char components;
 
+  /** Data is freed by Memory::free() if true, delete[] otherwise */
+  bool isMemoryTracked;
+
   void print() const;
   void print(const unsigned char* name) const;
   void print(const std::string& name) const { print(name.c_str()); }
@@ -16,6 +16,7 @@
 #include "renderer/3d/mesh/mesh.hpp"
 #include "renderer/core/2d/sprite/sprite.hpp"
 #include "loaders/texture/base/texture_loader_selector.hpp"
+#include "file/archive_reader.hpp"
 #include <string>
 
 namespace Tyra {
@@ -75,6 +76,12 @@ class TextureRepository {
    */
   Texture* add(Texture* texture);
 
+  /**
+   * Add unlinked texture from archive.
+   * @param name Entry name. Example: "textures/warrior.png"
+   */
+  Texture* add(ArchiveReader& archive, const std::string& name);
+
   /**
    * Add linked textures in given path for mesh material names.
    */
@@ -89,6 +96,12 @@ class TextureRepository {
     addByMesh(mesh, directory.c_str(), extension);
   }
 
+  /**
+   * Add linked textures from archive directory for mesh material names.
+   */
+  void addByMesh(const Mesh* mesh, ArchiveReader& archive,
+                 const std::string& directory, const char* extension);
+
   /**
    * Remove texture from repository.
    * Texture IS destructed.
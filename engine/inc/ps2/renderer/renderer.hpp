@@ -11,6 +11,7 @@
 #pragma once
 
 #include "./core/renderer_core.hpp"
+#include "./renderer_options.hpp"
 #include "./core/3d/camera_info_3d.hpp"
 #include "./3d/renderer_3d.hpp"
 #include "./2d/renderer_2d.hpp"
@@ -27,7 +28,7 @@ class Renderer {
 
   RendererCore core;
 
-  void init();
+  void init(const RendererOptions& t_options);
 
   /** World background color */
   void setClearScreenColor(const Color& color) {
@@ -44,7 +45,10 @@ class Renderer {
   /** Update view frustum for frustum culling. 3D support - on */
   void beginFrame(const CameraInfo3D& cameraInfo);
 
-  /** VSync and swap frame double buffer. */
+  /**
+   * VSync and swap frame double buffer.
+   * Triple buffering -> queue frame for next VSync.
+   */
   void endFrame();
 };
 
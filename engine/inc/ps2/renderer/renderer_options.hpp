@@ -0,0 +1,48 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+struct RendererOptions {
+  /**
+   * Third framebuffer, shown by VSync interrupt.
+   * EE can start next frame while GS still displays previous one, so
+   * frame which misses VSync by a bit doesn't stall EE for whole field.
+   * Costs one more framebuffer of VRAM (~0.9MB at 512x448x32).
+   * Ignored with field rendering.
+   */
+  bool tripleBuffering = false;
+
+  /**
+   * 3D is drawn into offscreen target, at resolution lowered when GS
+   * can't keep up, and stretched over the screen. 2D stays sharp.
+   * Costs one more framebuffer of VRAM.
+   */
+  bool dynamicResolution = false;
+
+  /** Lowest resolution scale, 0 - 1 */
+  float minResolutionScale = 0.5F;
+
+  /** Frame budget in microseconds. 0 -> 90% of video frame */
+  unsigned int targetFrameTime = 0;
+
+  /**
+   * Every frame is drawn at half height and shown as single interlaced
+   * field, so game should run at full field rate (50/60 fps).
+   * Halves fill rate and framebuffers VRAM, for cost of vertical
+   * resolution. 2D coordinates stay in full screen height.
+   * Can't be used with triple buffering.
+   */
+  bool fieldRendering = false;
+};
+
+}  // namespace Tyra
@@ -25,7 +25,8 @@ class RendererSettings {
         far(51200.0F),
         projectionScale(4096.0F),
         aspectRatio(width / height),
-        interlacedHeightUI(static_cast<unsigned int>(interlacedHeightF)) {}
+        interlacedHeightUI(static_cast<unsigned int>(interlacedHeightF)),
+        fieldRendering(false) {}
   ~RendererSettings();
 
   const float& getWidth() const { return width; }
@@ -39,6 +40,20 @@ class RendererSettings {
     return interlacedHeightUI;
   }
 
+  /**
+   * Height of framebuffers and 3D viewport.
+   * Interlaced height in field rendering mode, screen height otherwise.
+   * 2D coordinates are always in screen height.
+   */
+  const float& getFramebufferHeight() const {
+    return fieldRendering ? interlacedHeightF : height;
+  }
+
+  const bool& isFieldRendering() const { return fieldRendering; }
+  void setFieldRendering(const bool& t_fieldRendering) {
+    fieldRendering = t_fieldRendering;
+  }
+
   static void copy(RendererSettings* out, const RendererSettings* in);
   void set(const RendererSettings& v);
 
@@ -49,6 +64,7 @@ class RendererSettings {
   float width, height, interlacedHeightF, near, far, projectionScale,
       aspectRatio;
   unsigned int interlacedHeightUI;
+  bool fieldRendering;
 };
 
 }  // namespace Tyra
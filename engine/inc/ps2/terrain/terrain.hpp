@@ -0,0 +1,109 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "terrain/heightfield.hpp"
+#include "terrain/terrain_geomipmap.hpp"
+#include "math/vec4.hpp"
+#include "math/m4x4.hpp"
+#include "math/plane.hpp"
+#include "renderer/models/color.hpp"
+#include "renderer/core/3d/bbox/core_bbox.hpp"
+#include "renderer/core/texture/models/texture.hpp"
+#include "renderer/3d/pipeline/static/static_pipeline.hpp"
+#include <vector>
+
+namespace Tyra {
+
+struct TerrainOptions {
+  float cellSize = 1.0F;
+
+  /** World height = sample * heightScale + heightOffset */
+  float heightScale = 0.01F;
+  float heightOffset = 0.0F;
+
+  /** Cells per chunk side, power of 2 */
+  unsigned int chunkSize = 16;
+
+  /** Max is log2(chunkSize) + 1 */
+  unsigned int lodCount = 4;
+
+  /** Camera distance to chunk per LOD level */
+  float lodDistance = 48.0F;
+
+  /** Optional, stretched over whole terrain uvScale times */
+  Texture* texture = nullptr;
+  float uvScale = 1.0F;
+
+  Color color = Color(128.0F, 128.0F, 128.0F, 128.0F);
+};
+
+/**
+ * Heightfield terrain, rendered in chunks via static pipeline.
+ * Chunk LOD (geomipmapping) is picked by camera distance and chunk
+ * meshes are rebuilt only when their LOD or neighbors LOD changes,
+ * so cost follows what is near and visible, not map size.
+ */
+class Terrain {
+ public:
+  /** @param t_heights width * depth samples, copied */
+  Terrain(const unsigned short* t_heights, const unsigned int& t_width,
+          const unsigned int& t_depth, const TerrainOptions& t_options);
+  ~Terrain();
+
+  /** World position of sample (0, 0) */
+  Vec4 position;
+
+  const Heightfield& getHeightfield() const { return heightfield; }
+
+  /** Bilinear height at world XZ */
+  float getHeight(const Vec4& t_position) const;
+  Vec4 getNormal(const Vec4& t_position) const;
+  void getHeights(const Vec4* t_positions, const unsigned int& t_count,
+                  float* o_heights) const;
+
+  /** Selects LODs and rebuilds changed chunks. Call before render() */
+  void update(const Vec4& t_cameraPosition);
+
+  /**
+   * Chunks outside frustum are skipped.
+   * Static pipeline has to be in use (renderer3D.usePipeline()).
+   */
+  void render(StaticPipeline* t_pipeline, const Plane* t_frustumPlanes,
+              const StaPipOptions& t_options);
+
+  unsigned int getLastRenderedChunksCount() const {
+    return lastRenderedChunks;
+  }
+
+ private:
+  struct TerrainChunk {
+    unsigned int lod;
+    unsigned int neighborLods[TERRAIN_EDGES_COUNT];
+    unsigned int count;
+    Vec4 *vertices, *uvs;
+    CoreBBox* bbox;
+  };
+
+  Heightfield heightfield;
+  TerrainOptions options;
+  unsigned int chunksX, chunksZ;
+  std::vector<TerrainChunk> chunks;
+  std::vector<unsigned char> lods;
+  M4x4 model;
+  unsigned int lastRenderedChunks;
+
+  void buildChunk(const unsigned int& t_x, const unsigned int& t_z);
+  unsigned int getLod(const int& t_x, const int& t_z,
+                      const unsigned int& t_default) const;
+};
+
+}  // namespace Tyra
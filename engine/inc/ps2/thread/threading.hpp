@@ -19,9 +19,23 @@ class Threading {
   Threading();
   ~Threading();
 
+  /** Lower value = more important. */
+  static const int mainThreadPriority;
+
+  /**
+   * Move main thread below engine threads (audio, song reader, loaders),
+   * which are blocked on semaphores most of the time. Thanks to that they
+   * wake up as soon as they are signaled, without main thread sleeping.
+   */
+  static void init();
+
   static void sleep(const unsigned int& ms);
   static void sleep(const timespec& tv);
 
+  /**
+   * Sleep for 0.5ms, so lower priority threads can work.
+   * Prefer waiting on ThreadingSemaphore/ThreadingEvent/ThreadingVSync.
+   */
   static void switchThread();
 
  private:
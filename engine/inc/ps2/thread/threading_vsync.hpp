@@ -0,0 +1,42 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * VBlank start interrupt.
+ * Waiting threads are put to sleep and woken up by interrupt handler,
+ * so lower priority threads can work in the meantime.
+ */
+class ThreadingVSync {
+ public:
+  /** Install interrupt handler. Called automatically by first wait(). */
+  static void init();
+
+  /** Block current thread until next VBlank start. */
+  static void wait();
+
+  /** Amount of VBlanks since init(). */
+  static unsigned int getCount() { return count; }
+
+ private:
+  static const unsigned int maxWaiters = 8;
+
+  static int handlerId;
+  static volatile unsigned int count;
+  static volatile unsigned int waitersCount;
+  static int waiters[maxWaiters];
+
+  static int handler(int cause);
+};
+
+}  // namespace Tyra
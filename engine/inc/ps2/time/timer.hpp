@@ -19,10 +19,30 @@ class Timer {
   Timer();
   ~Timer();
 
+  /** @returns T3 ticks since prime() */
   unsigned int getTimeDelta();
   inline void prime() { lastTime = *T3_COUNT; }
 
+  /** T3 counts HBlanks, so rate depends on video mode (PAL/NTSC) */
+  static float getTicksPerSecond();
+
+  /** 50Hz PAL, 59.94Hz NTSC */
+  static float getRefreshRate();
+
+  static bool isPal();
+
+  static float toSeconds(const unsigned int& t_ticks) {
+    return t_ticks / getTicksPerSecond();
+  }
+
+  static unsigned int toMicroseconds(const unsigned int& t_ticks) {
+    return static_cast<unsigned int>(t_ticks * 1000000.0F /
+                                     getTicksPerSecond());
+  }
+
  private:
+  static int region;
+
   unsigned int lastTime, time, change;
 };
 
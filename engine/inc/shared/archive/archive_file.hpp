@@ -0,0 +1,113 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Tyra {
+
+enum ArchiveCompression { ARCHIVE_COMPRESSION_NONE, ARCHIVE_COMPRESSION_LZ };
+
+struct ArchiveHeader {
+  char magic[4];
+  unsigned int version;
+  unsigned int count;
+
+  /** Size of header + TOC, aligned to sector. Data starts here. */
+  unsigned int dataOffset;
+};
+
+struct ArchiveEntry {
+  /** Hash of normalized name, see ArchiveFile::getNameHash(). */
+  unsigned int nameHash;
+
+  /** Sector aligned offset from the start of the archive. */
+  unsigned int offset;
+
+  /** Stored (maybe compressed) size. */
+  unsigned int size;
+
+  unsigned int unpackedSize;
+  unsigned int compression;
+  unsigned int reserved[3];
+};
+
+struct ArchiveSource {
+  std::string name;
+  std::vector<unsigned char> data;
+  bool compress;
+};
+
+/** Single read of neighboring entries. */
+struct ArchiveReadSpan {
+  unsigned int offset;
+  unsigned int size;
+  std::vector<const ArchiveEntry*> entries;
+};
+
+/**
+ * Tyra archive container.
+ * Layout: header, TOC sorted by name hash, then sector aligned entries in
+ * packing order. Header and TOC fill whole sectors, so they can be read
+ * with one sector aligned read, before the data.
+ */
+class ArchiveFile {
+ public:
+  static const unsigned int version;
+  static const unsigned int sectorSize;
+
+  /** Compressed entry is stored only if it saves at least 1/x of size. */
+  static const unsigned int minCompressionGain;
+
+  /** Lower case, '/' separators, without "./" prefix. */
+  static std::string normalizeName(const std::string& t_name);
+
+  static unsigned int getNameHash(const std::string& t_name);
+
+  /** Checks magic and version. Needs only first sector. */
+  static bool validateHeader(const unsigned char* t_data,
+                             const unsigned int& t_size);
+
+  /**
+   * Checks header and TOC.
+   * @param t_size Size of header+TOC data (at least header->dataOffset).
+   * @param t_fileSize Size of whole archive.
+   */
+  static bool validate(const unsigned char* t_data, const unsigned int& t_size,
+                       const unsigned int& t_fileSize);
+
+  static const ArchiveHeader* getHeader(const unsigned char* t_data);
+
+  static const ArchiveEntry* getEntries(const unsigned char* t_data);
+
+  /** Binary search in TOC. @returns nullptr if not found. */
+  static const ArchiveEntry* find(const unsigned char* t_data,
+                                  const unsigned int& t_nameHash);
+
+  /**
+   * Groups entries into big sequential reads.
+   * Entries which are closer than maxGap bytes are read together, unless
+   * read would be bigger than maxSpanSize.
+   */
+  static std::vector<ArchiveReadSpan> planReads(
+      std::vector<const ArchiveEntry*> t_entries, const unsigned int& t_maxGap,
+      const unsigned int& t_maxSpanSize);
+
+  /** @returns Empty vector if names are duplicated (or hashes collide). */
+  static std::vector<unsigned char> build(
+      const std::vector<ArchiveSource>& t_sources);
+
+ private:
+  static unsigned int align(const unsigned int& value);
+};
+
+}  // namespace Tyra
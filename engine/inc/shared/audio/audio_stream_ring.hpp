@@ -0,0 +1,97 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./audio_stream_stats.hpp"
+#include "thread/threading_semaphore.hpp"
+
+namespace Tyra {
+
+struct AudioStreamSlot {
+  unsigned char* data;
+  unsigned int size;
+  unsigned int generation;
+
+  /** True if this slot contains end of the data. */
+  bool last;
+
+  /** True if reader already rewound to start after this slot. */
+  bool wrapped;
+};
+
+/**
+ * Slot ring of AudioStream, without file and thread handling.
+ * One producer (reader thread) fills slots and one consumer (playback)
+ * takes them in the same order. Every open()/rewind() of stream starts
+ * new generation, slots filled for older one are dropped by consumer.
+ */
+class AudioStreamRing {
+ public:
+  AudioStreamRing();
+  ~AudioStreamRing();
+
+  /**
+   * @param t_slots Owned by caller, at least 2.
+   * @param t_stats Underruns and min filled slots are updated by acquire().
+   */
+  void init(AudioStreamSlot* t_slots, const unsigned int& t_count,
+            AudioStreamStats* t_stats);
+
+  /** Start new generation. @returns Its number. */
+  unsigned int nextGeneration() { return ++generation; }
+
+  /** Newest generation, the one which consumer wants. */
+  unsigned int getGeneration() const { return generation; }
+
+  /** Producer: blocks until there is free slot. */
+  AudioStreamSlot* beginWrite();
+
+  /**
+   * Producer: slot from beginWrite() is filled, pass it to consumer.
+   * @param t_end Slot contains end of the data.
+   * @param t_loop Reader continues from the start after end of the data.
+   * @returns True if reader has to rewind to start.
+   */
+  bool endWrite(const unsigned int& t_generation, const bool& t_end,
+                const bool& t_loop);
+
+  /**
+   * Consumer: next slot of current generation. Blocks if producer is
+   * behind (underrun). Older slots are skipped.
+   */
+  AudioStreamSlot* acquire();
+
+  /** Consumer: oldest acquired slot can be filled again. */
+  void release();
+
+  /** False if slot was filled before last nextGeneration(). */
+  bool isCurrent(const AudioStreamSlot* t_slot) const {
+    return t_slot->generation == generation;
+  }
+
+  int getFilledCount() const { return filledSlots.getCount(); }
+  int getFreeCount() const { return freeSlots.getCount(); }
+
+ private:
+  AudioStreamSlot* slots;
+  unsigned int count, writeIndex, readIndex;
+  AudioStreamStats* stats;
+
+  ThreadingSemaphore freeSlots, filledSlots;
+
+  volatile unsigned int generation;
+  unsigned int consumerGeneration;
+
+  /** Playback got data, so empty ring from now on is an underrun. */
+  bool primed;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,32 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+struct AudioStreamStats {
+  /** How many times playback wanted data, but ring buffer was empty. */
+  unsigned int underruns;
+
+  /** Amount of read requests sent to device. */
+  unsigned int reads;
+
+  /** Total bytes read from device. */
+  unsigned int bytesRead;
+
+  /** Total bytes sent to audsrv. */
+  unsigned int bytesPlayed;
+
+  /** Lowest amount of filled slots seen by playback. */
+  unsigned int minFilledSlots;
+};
+
+}  // namespace Tyra
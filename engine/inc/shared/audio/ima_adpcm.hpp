@@ -0,0 +1,62 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * IMA ADPCM (WAV format 0x11) codec.
+ * 4 bits per sample, so 4x smaller than 16bit PCM.
+ * Block layout per channel: 16bit predictor, 8bit step index, 8bit zero,
+ * then interleaved 4 byte (8 samples) groups of every channel.
+ */
+class ImaAdpcm {
+ public:
+  /** Mono or stereo only, like audsrv. */
+  static const unsigned int maxChannels = 2;
+
+  /** Samples per channel in full block of given size. */
+  static unsigned int getSamplesPerBlock(const unsigned int& t_blockAlign,
+                                         const unsigned int& t_channels);
+
+  /**
+   * Decode single (possibly shorter, last) block into interleaved PCM.
+   * @param t_size Size of the block in bytes.
+   * @param o_samples Must fit getSamplesPerBlock() * channels samples.
+   * @returns Decoded samples per channel.
+   */
+  static unsigned int decodeBlock(const unsigned char* t_block,
+                                  const unsigned int& t_size,
+                                  const unsigned int& t_channels,
+                                  short* o_samples);
+
+  /**
+   * Encode interleaved PCM into single block.
+   * @param t_samples Samples per channel. Block is padded with silence if
+   * less than getSamplesPerBlock().
+   * @param io_indexes Step index per channel, carried between blocks.
+   */
+  static void encodeBlock(const short* t_pcm, const unsigned int& t_samples,
+                          const unsigned int& t_blockAlign,
+                          const unsigned int& t_channels,
+                          unsigned char* io_indexes, unsigned char* o_block);
+
+ private:
+  static const short stepTable[89];
+  static const signed char indexTable[16];
+
+  static short decodeNibble(const unsigned char& nibble, int* predictor,
+                            int* index);
+  static unsigned char encodeSample(const short& sample, int* predictor,
+                                    int* index);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,68 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Tyra {
+
+struct SoundBankHeader {
+  char magic[4];
+  unsigned int version;
+  unsigned int count;
+  unsigned int reserved;
+};
+
+struct SoundBankEntry {
+  /** FNV-1a hash of sound name (filename without extension). */
+  unsigned int nameHash;
+
+  /** Offset of ADPCM data from the start of the bank. */
+  unsigned int offset;
+
+  /** Size of ADPCM data (adpenc output with its header). */
+  unsigned int size;
+
+  unsigned int reserved;
+};
+
+struct SoundBankSource {
+  std::string name;
+  std::vector<unsigned char> data;
+};
+
+/**
+ * Sound bank container.
+ * Layout: header, entries table, then 64 byte aligned ADPCM samples.
+ * Whole bank can be loaded with single read.
+ */
+class SoundBankFile {
+ public:
+  static const unsigned int version;
+  static const unsigned int alignment;
+
+  /** @returns False if data is not a valid bank. */
+  static bool validate(const unsigned char* t_data, const unsigned int& t_size);
+
+  static unsigned int getCount(const unsigned char* t_data);
+
+  static const SoundBankEntry* getEntries(const unsigned char* t_data);
+
+  /** @returns nullptr if not found. */
+  static const SoundBankEntry* find(const unsigned char* t_data,
+                                    const unsigned int& t_nameHash);
+
+  static std::vector<unsigned char> build(
+      const std::vector<SoundBankSource>& t_sources);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,30 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/** Hardware side of VoiceManager. On PS2 it is implemented with audsrv. */
+class VoiceBackend {
+ public:
+  virtual ~VoiceBackend() {}
+
+  /** Start sample on channel. If channel is busy, sample is restarted. */
+  virtual bool play(const int& t_channel, void* t_sample) = 0;
+
+  virtual bool isPlaying(const int& t_channel, void* t_sample) = 0;
+
+  /** @param t_volume Value 0-100 */
+  virtual void setVolume(const int& t_channel,
+                         const unsigned char& t_volume) = 0;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,83 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./voice_backend.hpp"
+#include "./voice_request.hpp"
+
+namespace Tyra {
+
+/**
+ * Assigns sound effects to hardware channels.
+ * When channels are busy, the least important (then the oldest) voice
+ * is stolen. Backend is asked about finished voices only when needed,
+ * because on PS2 every query is an IOP call.
+ */
+class VoiceManager {
+ public:
+  static const unsigned int maxChannels = 24;
+  static const unsigned int maxCategories = 16;
+
+  VoiceManager();
+  ~VoiceManager();
+
+  /** Use channels from t_firstChannel to t_firstChannel + t_count - 1. */
+  void init(VoiceBackend* t_backend, const unsigned int& t_firstChannel,
+            const unsigned int& t_count);
+
+  /**
+   * Play sample.
+   * @param o_channel Optional, channel which was used.
+   */
+  VoiceResult play(void* t_sample, const VoiceRequest& t_request,
+                   int* o_channel = nullptr);
+
+  /** Max voices of given category playing at the same time. */
+  void setCategoryLimit(const unsigned char& t_category,
+                        const unsigned int& t_limit);
+
+  /** Voices below this volume (after distance falloff) are culled. */
+  void setMinAudibleVolume(const unsigned char& t_volume) {
+    minAudibleVolume = t_volume;
+  }
+
+  /** Ask backend which voices have finished. */
+  void refresh();
+
+  unsigned int getActiveCount() const;
+
+  const VoiceStats& getStats() const { return stats; }
+  void resetStats();
+
+ private:
+  struct Voice {
+    void* sample;
+    unsigned int startTick;
+    unsigned char priority;
+    unsigned char category;
+    bool active;
+  };
+
+  VoiceBackend* backend;
+  Voice voices[maxChannels];
+  unsigned int firstChannel, channelsCount;
+  unsigned int categoryLimits[maxCategories];
+  unsigned int tick;
+  unsigned char minAudibleVolume;
+  VoiceStats stats;
+
+  unsigned int getCategoryCount(const unsigned char& category) const;
+  int findFree() const;
+  int findVictim(const VoiceRequest& request, const bool& sameCategory) const;
+  unsigned char getAudibleVolume(const VoiceRequest& request) const;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,57 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+enum VoiceResult {
+  VOICE_PLAYED,
+
+  /** Played, but older/less important voice was cut. */
+  VOICE_STOLEN,
+
+  /** Too far away or too quiet to be heard. */
+  VOICE_CULLED,
+
+  /** All channels (or category slots) are used by more important voices. */
+  VOICE_REJECTED,
+
+  VOICE_ERROR
+};
+
+struct VoiceRequest {
+  /** Higher value = more important. */
+  unsigned char priority = 128;
+
+  /** Category id (0-15), for example weapons or footsteps. */
+  unsigned char category = 0;
+
+  /** Value 0-100 */
+  unsigned char volume = 100;
+
+  /** Distance from listener. */
+  float distance = 0.0F;
+
+  /**
+   * Distance where sound becomes silent (linear falloff).
+   * 0 means no falloff and no culling.
+   */
+  float maxDistance = 0.0F;
+};
+
+struct VoiceStats {
+  unsigned int played;
+  unsigned int stolen;
+  unsigned int culled;
+  unsigned int rejected;
+};
+
+}  // namespace Tyra
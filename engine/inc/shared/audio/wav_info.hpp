@@ -0,0 +1,39 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+enum WavFormat {
+  WAV_FORMAT_PCM = 0x0001,
+  WAV_FORMAT_IMA_ADPCM = 0x0011,
+};
+
+struct WavInfo {
+  unsigned short format;
+  unsigned short channels;
+  unsigned int sampleRate;
+  unsigned short bitsPerSample;
+
+  /** Size of single block (IMA ADPCM) or single frame (PCM) in bytes. */
+  unsigned short blockAlign;
+
+  /** IMA ADPCM only. Samples (per channel) in single block. */
+  unsigned short samplesPerBlock;
+
+  /** Offset of the first sample data byte in file. */
+  unsigned int dataOffset;
+
+  /** Size of sample data in bytes. */
+  unsigned int dataSize;
+};
+
+}  // namespace Tyra
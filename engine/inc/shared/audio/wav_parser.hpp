@@ -0,0 +1,44 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./wav_info.hpp"
+
+namespace Tyra {
+
+/** RIFF WAVE header parser. */
+class WavParser {
+ public:
+  /**
+   * Walk through RIFF chunks until "data" chunk is found.
+   * @param t_data Beginning of the file. Must contain everything up to
+   * "data" chunk header (first few KB is enough for almost every file).
+   * @param t_size Size of t_data.
+   * @param t_fileSize Real size of file, used for clamping data size of
+   * truncated or streamed files. 0 if unknown.
+   * @returns False if not a valid/supported WAV.
+   */
+  static bool parse(const unsigned char* t_data, const unsigned int& t_size,
+                    const unsigned int& t_fileSize, WavInfo* o_info);
+
+  /** Writes 44/48 byte header of PCM or IMA ADPCM file. */
+  static unsigned int write(const WavInfo& t_info, unsigned char* o_data);
+
+  static bool isSupported(const WavInfo& t_info);
+
+ private:
+  static unsigned int readU32(const unsigned char* data);
+  static unsigned short readU16(const unsigned char* data);
+  static void writeU32(unsigned char* data, const unsigned int& value);
+  static void writeU16(unsigned char* data, const unsigned short& value);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,86 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Binary angle: 65536 units = full turn, so wrapping is free (integer
+ * overflow) and sin/cos are table lookups with linear interpolation.
+ * Tables (4KB sin, 1KB atan) are built on first use.
+ *
+ * Max absolute error vs libm (see trig_tests.cpp):
+ * - sin/cos: 1e-5,
+ * - atan2: 1 unit (~0.0001 radians),
+ * - fromRadians: 0.5 unit (rounding).
+ */
+class FixedAngle {
+ public:
+  unsigned short value;
+
+  static constexpr unsigned int unitsPerTurn = 65536;
+
+  /** Initialize angle without setting default value */
+  FixedAngle() {}
+  explicit FixedAngle(const unsigned short& t_value) : value(t_value) {}
+
+  static FixedAngle fromRadians(const float& t_radians);
+  static FixedAngle fromDegrees(const float& t_degrees);
+
+  /** Direction of (x, y) vector */
+  static FixedAngle atan2(const float& t_y, const float& t_x);
+
+  /** <0, 2PI) */
+  float toRadians() const;
+  float toDegrees() const;
+
+  /** <-PI, PI) */
+  float toSignedRadians() const;
+
+  float sin() const;
+  float cos() const;
+  void sinCos(float* o_sin, float* o_cos) const;
+
+  /** Bulk sin/cos lookup */
+  static void sinCos(const FixedAngle* t_angles, float* o_sin, float* o_cos,
+                     const unsigned int& t_count);
+
+  FixedAngle operator+(const FixedAngle& v) const {
+    return FixedAngle(static_cast<unsigned short>(value + v.value));
+  }
+  FixedAngle operator-(const FixedAngle& v) const {
+    return FixedAngle(static_cast<unsigned short>(value - v.value));
+  }
+  void operator+=(const FixedAngle& v) { value += v.value; }
+  void operator-=(const FixedAngle& v) { value -= v.value; }
+  bool operator==(const FixedAngle& v) const { return value == v.value; }
+  bool operator!=(const FixedAngle& v) const { return value != v.value; }
+
+  /** Shortest signed distance to other angle, in units */
+  short deltaTo(const FixedAngle& v) const {
+    return static_cast<short>(v.value - value);
+  }
+
+ private:
+  static constexpr unsigned int sinTableBits = 10;
+  static constexpr unsigned int sinTableSize = 1 << sinTableBits;
+  static constexpr unsigned int atanTableSize = 256;
+
+  /** + 1 entry, so interpolation never wraps */
+  static float sinTable[sinTableSize + 1];
+  static float atanTable[atanTableSize + 1];
+  static bool areTablesInitialized;
+
+  static void initTables();
+  static float lookupSin(const unsigned short& t_value);
+};
+
+}  // namespace Tyra
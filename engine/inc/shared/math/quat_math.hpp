@@ -0,0 +1,67 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Host versions of quaternion operations used by Quat.
+ * Quaternion is float[4] (x, y, z, w), w is scalar part.
+ * Matrices are 16 floats, column major (like M4x4).
+ * Quat multiply uses VU0 on PS2, so keep multiply() in sync with it.
+ */
+class QuatMath {
+ public:
+  /** Hamilton product. o_result can be t_a or t_b */
+  static void multiply(float* o_result, const float* t_a, const float* t_b);
+
+  static float dot(const float* t_a, const float* t_b);
+
+  /** Zero length quaternion becomes identity */
+  static void normalize(float* t_quat);
+
+  /** Inverse of unit quaternion */
+  static void conjugate(float* o_result, const float* t_quat);
+
+  /** Rotate xyz of t_vector, w is copied */
+  static void rotate(float* o_result, const float* t_quat,
+                     const float* t_vector);
+
+  /** Normalized lerp, shortest path. Cheap, non constant speed */
+  static void nlerp(float* o_result, const float* t_a, const float* t_b,
+                    const float& t_interp);
+
+  /** Spherical lerp, shortest path. Falls back to nlerp for tiny angles */
+  static void slerp(float* o_result, const float* t_a, const float* t_b,
+                    const float& t_interp);
+
+  /** Axis does not have to be normalized */
+  static void fromAxisAngle(float* o_result, const float* t_axis,
+                            const float& t_radians);
+
+  /** Rotation part (upper 3x3) of matrix, without scale */
+  static void fromMatrix(float* o_result, const float* t_matrix);
+
+  /** Rotation matrix, translation is zero */
+  static void toMatrix(float* o_matrix, const float* t_quat);
+
+  /**
+   * Rotation which turns -Z (camera forward, like in M4x4::lookAt)
+   * into t_forward and keeps +Y as close to t_up as possible.
+   */
+  static void lookRotation(float* o_result, const float* t_forward,
+                           const float* t_up);
+
+ private:
+  static constexpr float slerpThreshold = 0.9995F;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,51 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Polynomial sin/cos/atan2 for bulk use (game logic, many entities).
+ * sinCos() gives both values from one range reduction. Array versions
+ * do 4 angles per VU0 (macro mode) pass on EE, elsewhere they fall back
+ * to the *Scalar() versions, which use the same algorithm.
+ *
+ * Max absolute error vs libm (see trig_tests.cpp):
+ * - sin/cos: 2e-6 for |x| <= 1024, 4e-6 on VU0 (no IEEE rounding),
+ * - atan2: 2e-5 radians.
+ */
+class TrigKernels {
+ public:
+  static void sinCos(const float& t_radians, float* o_sin, float* o_cos);
+
+  /**
+   * Fast path needs all 3 arrays qword aligned,
+   * otherwise everything is done by scalar code.
+   */
+  static void sinCos(const float* t_radians, float* o_sin, float* o_cos,
+                     const unsigned int& t_count);
+  static void sinCosScalar(const float* t_radians, float* o_sin,
+                           float* o_cos, const unsigned int& t_count);
+
+  /** Result in <-PI, PI>, atan2(0, 0) = 0 */
+  static float atan2(const float& t_y, const float& t_x);
+  static void atan2(const float* t_y, const float* t_x, float* o_radians,
+                    const unsigned int& t_count);
+
+ private:
+  TrigKernels();
+
+  /** sin() of angle already reduced to <-PI, PI> */
+  static float reducedSin(const float& t_radians);
+  static float reduce(const float& t_radians);
+};
+
+}  // namespace Tyra
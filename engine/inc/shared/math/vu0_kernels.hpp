@@ -0,0 +1,56 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Host (reference) versions of VU0 micro job kernels.
+ * Data layout is the same as in VU0 memory: vectors and boxes are
+ * arrays of 4 floats, matrices are 16 floats (column major, like M4x4).
+ * Results must match VU0 programs, so keep both in sync.
+ */
+class Vu0Kernels {
+ public:
+  /** out = matrix * vertex (full xyzw) */
+  static void transform(const float* t_matrix, const float* t_vertices,
+                        float* o_vertices, const unsigned int& t_count);
+
+  /**
+   * Transforms 8 corners of every box (min, max) into clip space.
+   * @param o_flags AND of corners clip flags (VU0 CLIP order).
+   * 0 -> box is (maybe) visible, otherwise all corners are behind one plane
+   */
+  static void cullBoxes(const float* t_matrix, const float* t_boxes,
+                        unsigned int* o_flags, const unsigned int& t_count);
+
+  /** out = from + (to - from) * interp */
+  static void morph(const float* t_from, const float* t_to,
+                    const float& t_interp, float* o_vertices,
+                    const unsigned int& t_count);
+
+  /**
+   * Linear blend skinning with up to 4 bones per vertex.
+   * out = sum(weight[i] * bones[index[i]] * position)
+   */
+  static void skin(const float* t_bones, const float* t_positions,
+                   const float* t_weights, const int* t_indices,
+                   float* o_positions, const unsigned int& t_count);
+
+  /** Clip flags of single vertex, as VU CLIP instruction sets them */
+  static unsigned int getClipFlags(const float* t_vertex);
+
+ private:
+  static void multiply(float* o_result, const float* t_matrix,
+                       const float* t_vertex);
+};
+
+}  // namespace Tyra
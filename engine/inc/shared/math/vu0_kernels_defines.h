@@ -0,0 +1,39 @@
+//
+// ______       ____   ___
+//   |     \/   ____| |___|
+//   |     |   |   \  |   |
+//-----------------------------------------------------------------------
+// Copyright 2022, tyra - https://github.com/h4570/tyra
+// Licensed under Apache License 2.0
+// Sandro Sobczyński <sandro.sobczynski@gmail.com>
+//
+
+
+// VU0 data memory layout of micro jobs, in qwords (VU0 has 256 of them).
+// Header qword: x = count (int), y = lerp value (float, morph only)
+
+#define VU0_MEMORY_SIZE 256
+
+// Transform - matrix * vertex
+#define VU0_TRANSFORM_MATRIX_ADDR 0
+#define VU0_TRANSFORM_HEADER_ADDR 4
+#define VU0_TRANSFORM_DATA_ADDR 5
+#define VU0_TRANSFORM_MAX_COUNT 124
+
+// Bounding box culling - in: min, max; out: AND of corners clip flags
+#define VU0_CULL_MATRIX_ADDR 0
+#define VU0_CULL_HEADER_ADDR 4
+#define VU0_CULL_DATA_ADDR 5
+#define VU0_CULL_MAX_COUNT 83
+
+// Morph - in: from, to; out: lerp
+#define VU0_MORPH_HEADER_ADDR 0
+#define VU0_MORPH_DATA_ADDR 1
+#define VU0_MORPH_MAX_COUNT 85
+
+// Skinning - in: position, weights, bone indices (int); out: position
+#define VU0_SKIN_BONES_ADDR 0
+#define VU0_SKIN_MAX_BONES 16
+#define VU0_SKIN_HEADER_ADDR 64
+#define VU0_SKIN_DATA_ADDR 65
+#define VU0_SKIN_MAX_COUNT 47
@@ -0,0 +1,116 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+enum MemoryCategory {
+  MEMORY_CATEGORY_TEXTURES,
+  MEMORY_CATEGORY_MESHES,
+  MEMORY_CATEGORY_PACKETS,
+  MEMORY_CATEGORY_AUDIO,
+  MEMORY_CATEGORY_GAME,
+  MEMORY_CATEGORIES_COUNT,
+};
+
+struct MemoryCategoryStats {
+  /** Requested bytes, without tracker overhead */
+  unsigned int liveBytes;
+  unsigned int peakBytes;
+  unsigned int liveCount;
+
+  /** Allocations since last endFrame() */
+  unsigned int frameCount;
+  unsigned int frameBytes;
+
+  unsigned int totalCount;
+
+  /** 0 -> no budget */
+  unsigned int budget;
+};
+
+/**
+ * Tagged heap allocations with per category counters and budgets.
+ * Every block has small header before it (size, category, offset to
+ * real block), so free needs only the pointer and all queries are O(1).
+ * Memory owned by other allocators (e.g. packet2) can be reported by
+ * track() / untrack().
+ */
+class MemoryTracker {
+ public:
+  MemoryTracker();
+  ~MemoryTracker();
+
+  /** Minimum alignment, header lives in this space */
+  static const unsigned int minAlignment;
+
+  /** Called when category goes over its budget */
+  void (*onBudgetExceeded)(const MemoryCategory& t_category,
+                           const MemoryCategoryStats& t_stats);
+
+  /** @returns nullptr if heap is exhausted */
+  void* allocate(const unsigned int& t_size, const MemoryCategory& t_category);
+  void* allocate(const unsigned int& t_size, const MemoryCategory& t_category,
+                 const unsigned int& t_alignment);
+
+  /**
+   * nullptr is ignored.
+   * @returns false if block was not allocated by tracker (not freed)
+   */
+  bool free(void* t_pointer);
+
+  /** For memory not allocated by tracker */
+  void track(const unsigned int& t_size, const MemoryCategory& t_category);
+  void untrack(const unsigned int& t_size, const MemoryCategory& t_category);
+
+  /** Requested size of tracked block */
+  static unsigned int getSize(const void* t_pointer);
+  static MemoryCategory getCategory(const void* t_pointer);
+
+  void setBudget(const MemoryCategory& t_category,
+                 const unsigned int& t_bytes);
+  bool isOverBudget(const MemoryCategory& t_category) const;
+
+  const MemoryCategoryStats& getStats(const MemoryCategory& t_category) const {
+    return stats[t_category];
+  }
+
+  unsigned int getLiveBytes() const { return liveBytes; }
+  unsigned int getPeakBytes() const { return peakBytes; }
+  unsigned int getLiveCount() const { return liveCount; }
+
+  /** Headers and alignment padding of live blocks */
+  unsigned int getOverheadBytes() const { return overheadBytes; }
+
+  /**
+   * Overhead / reserved bytes, 0 - 1.
+   * Heap fragmentation is Memory::getHeapFragmentation()
+   */
+  float getOverheadRatio() const;
+
+  /** Allocations of previous frame */
+  unsigned int getLastFrameCount() const { return lastFrameCount; }
+
+  /** Closes frame counters. Called by engine */
+  void endFrame();
+
+  static const char* getCategoryName(const MemoryCategory& t_category);
+
+ private:
+  MemoryCategoryStats stats[MEMORY_CATEGORIES_COUNT];
+  unsigned int liveBytes, peakBytes, liveCount, overheadBytes;
+  unsigned int frameCount, lastFrameCount;
+
+  void add(const unsigned int& t_size, const MemoryCategory& t_category);
+  void remove(const unsigned int& t_size, const MemoryCategory& t_category);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,57 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Stack (bump) allocator over fixed memory block.
+ * Used for EE scratchpad (16KB), but works on any memory, so it can be
+ * tested on host. Nothing is freed separately - release to marker.
+ */
+class ScratchpadArena {
+ public:
+  ScratchpadArena();
+  ~ScratchpadArena();
+
+  /** Default alignment = qword, required by DMA */
+  static const unsigned int defaultAlignment;
+
+  void init(unsigned char* t_base, const unsigned int& t_size);
+
+  /** @returns nullptr if there is not enough space */
+  void* allocate(const unsigned int& t_size);
+  void* allocate(const unsigned int& t_size, const unsigned int& t_alignment);
+
+  /** @returns current top, for release() */
+  unsigned int getMarker() const { return top; }
+
+  /** Frees everything allocated after marker */
+  void release(const unsigned int& t_marker);
+
+  void reset() { top = 0; }
+
+  bool contains(const void* t_pointer) const;
+
+  unsigned char* getBase() const { return base; }
+  unsigned int getSize() const { return size; }
+  unsigned int getUsed() const { return top; }
+  unsigned int getFree() const { return size - top; }
+
+  /** Highest usage since init() */
+  unsigned int getPeak() const { return peak; }
+
+ private:
+  unsigned char* base;
+  unsigned int size, top, peak;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,47 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./scratchpad_arena.hpp"
+
+namespace Tyra {
+
+/**
+ * Two halves allocated from arena. One is filled by CPU, while the other
+ * one is being read by DMA.
+ */
+class ScratchpadDoubleBuffer {
+ public:
+  ScratchpadDoubleBuffer();
+  ~ScratchpadDoubleBuffer();
+
+  /** @returns false if arena has not enough space */
+  bool init(ScratchpadArena* t_arena, const unsigned int& t_halfSize);
+
+  /** Switch to other half. @returns its memory */
+  unsigned char* swap();
+
+  unsigned char* getCurrent() const { return halves[index]; }
+  unsigned char* getHalf(const unsigned int& t_index) const {
+    return halves[t_index];
+  }
+
+  unsigned int getIndex() const { return index; }
+  unsigned int getHalfSize() const { return halfSize; }
+
+  bool isInitialized() const { return halves[0] != nullptr; }
+
+ private:
+  unsigned char* halves[2];
+  unsigned int index, halfSize;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,131 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Tyra {
+
+enum BinaryMeshArray {
+  BINARY_MESH_VERTICES,
+  BINARY_MESH_TEXTURE_COORDS,
+  BINARY_MESH_NORMALS,
+  BINARY_MESH_COLORS,
+  BINARY_MESH_ARRAYS_COUNT
+};
+
+enum BinaryMeshFlags {
+  BINARY_MESH_FLAG_NORMALS = 1,
+  BINARY_MESH_FLAG_LIGHTMAP = 2
+};
+
+struct BinaryMeshHeader {
+  char magic[4];
+  unsigned int version;
+  unsigned int materialsCount;
+  unsigned int framesCount;
+  unsigned int flags;
+  unsigned int stringsOffset;
+  unsigned int stringsSize;
+  unsigned int size;
+};
+
+struct BinaryMeshMaterial {
+  unsigned int nameOffset;
+
+  /** BinaryMeshFile::noString if material has no texture. */
+  unsigned int texturePathOffset;
+
+  unsigned int reserved[2];
+  float ambient[4];
+};
+
+struct BinaryMeshFrame {
+  unsigned int count;
+
+  /** Offsets of 16 bytes aligned xyzw arrays, 0 if array is missing. */
+  unsigned int offsets[BINARY_MESH_ARRAYS_COUNT];
+
+  unsigned int reserved[3];
+  float min[4];
+  float max[4];
+};
+
+struct BinaryMeshSourceFrame {
+  unsigned int count;
+
+  /** 4 floats per vertex, empty if missing. */
+  std::vector<float> arrays[BINARY_MESH_ARRAYS_COUNT];
+};
+
+struct BinaryMeshSourceMaterial {
+  std::string name;
+  std::optional<std::string> texturePath;
+  float ambient[4];
+  std::vector<BinaryMeshSourceFrame> frames;
+};
+
+struct BinaryMeshSource {
+  bool loadNormals, loadLightmap;
+  std::vector<BinaryMeshSourceMaterial> materials;
+};
+
+/**
+ * Precooked mesh (.tym).
+ * Layout: header, materials, frames (material major), strings, then
+ * 16 bytes aligned vertex arrays, ready to be copied into Vec4/Color.
+ */
+class BinaryMeshFile {
+ public:
+  static const unsigned int version;
+  static const unsigned int alignment;
+  static const unsigned int noString;
+
+  static bool validate(const unsigned char* t_data, const unsigned int& t_size);
+
+  static const BinaryMeshHeader* getHeader(const unsigned char* t_data);
+
+  static const BinaryMeshMaterial* getMaterial(const unsigned char* t_data,
+                                               const unsigned int& t_index);
+
+  static const BinaryMeshFrame* getFrame(const unsigned char* t_data,
+                                         const unsigned int& t_material,
+                                         const unsigned int& t_frame);
+
+  /** @returns nullptr for noString. */
+  static const char* getString(const unsigned char* t_data,
+                               const unsigned int& t_offset);
+
+  /** @returns nullptr if array is missing. */
+  static const float* getArray(const unsigned char* t_data,
+                               const BinaryMeshFrame* t_frame,
+                               const BinaryMeshArray& t_array);
+
+  /**
+   * Every material must have the same frames count.
+   * @returns Empty vector if source is invalid.
+   */
+  static std::vector<unsigned char> build(const BinaryMeshSource& t_source);
+
+  /**
+   * Reverse of build(), for tools.
+   * @returns False if data is invalid.
+   */
+  static bool read(const unsigned char* t_data, const unsigned int& t_size,
+                   BinaryMeshSource* o_source);
+
+ private:
+  static unsigned int align(const unsigned int& value);
+};
+
+}  // namespace Tyra
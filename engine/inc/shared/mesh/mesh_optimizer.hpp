@@ -0,0 +1,85 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./binary_mesh_file.hpp"
+#include <vector>
+
+namespace Tyra {
+
+struct MeshOptimizerOptions {
+  bool removeDegenerates = true;
+  bool mergeMaterials = true;
+
+  /** Sort triangles of every material in Morton (Z-curve) order. */
+  bool sortTriangles = true;
+
+  /**
+   * Vertices per render package, used only by statistics.
+   * Should match static pipeline package size (VU1 buffer).
+   */
+  unsigned int packageSize = 96;
+};
+
+struct MeshOptimizerStats {
+  unsigned int trianglesBefore, trianglesAfter;
+  unsigned int degeneratesRemoved;
+  unsigned int materialsMerged;
+  unsigned int packagesCount;
+
+  /**
+   * Average package bbox width (sum of extents) relative to its material
+   * bbox, before and after. Chance that random frustum plane crosses a
+   * box is proportional to its width, so (1 - spread) is a rough
+   * estimate of how many packages can be culled when the mesh is
+   * partially visible. Lower is better.
+   */
+  float packageSpreadBefore, packageSpreadAfter;
+};
+
+/**
+ * Optimization pass for triangle soup meshes, used by tools/meshcook and
+ * MeshBuilderOptimizer. Compact package bboxes make per-package frustum
+ * culling of static pipeline effective.
+ */
+class MeshOptimizer {
+ public:
+  static MeshOptimizerStats optimize(BinaryMeshSource& io_mesh,
+                                     const MeshOptimizerOptions& t_options);
+
+  /** @returns Average package spread of all materials (first frame). */
+  static float getPackageSpread(const BinaryMeshSource& t_mesh,
+                                const unsigned int& t_packageSize,
+                                unsigned int* o_packagesCount = nullptr);
+
+  /** True if triangle has (nearly) zero area. */
+  static bool isDegenerate(const float* t_a, const float* t_b,
+                           const float* t_c);
+
+  /** 30bit Morton code of point in [0, 1] cube. */
+  static unsigned int getMortonCode(const float& t_x, const float& t_y,
+                                    const float& t_z);
+
+ private:
+  static unsigned int removeDegenerates(BinaryMeshSource& mesh);
+  static unsigned int mergeMaterials(BinaryMeshSource& mesh);
+  static void sortTriangles(BinaryMeshSourceMaterial& material);
+
+  static void reorder(BinaryMeshSourceMaterial& material,
+                      const std::vector<unsigned int>& triangles);
+
+  static bool areEqual(const BinaryMeshSourceMaterial& a,
+                       const BinaryMeshSourceMaterial& b);
+
+  static unsigned int getTrianglesCount(const BinaryMeshSource& mesh);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,119 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+
+namespace Tyra {
+
+struct BroadphasePair {
+  /** a < b */
+  unsigned int a, b;
+};
+
+struct BroadphaseRayHit {
+  unsigned int proxy;
+
+  /** Entry distance into proxy box, 0 if ray starts inside */
+  float distance;
+};
+
+/**
+ * Broadphase for moving objects: AABB proxies in uniform grid, stored in
+ * spatial hash (unbounded world, fixed bucket count).
+ * update() touches hash only when proxy moves to other cells, so mostly
+ * it is just a bounds copy.
+ *
+ * Cell size should be close to typical object size. Huge proxies
+ * (many cells) work, but are slower.
+ *
+ * BBox proxy: bbox.getMinMax(&min, &max), then min.xyzw, max.xyzw.
+ */
+class Broadphase {
+ public:
+  /** @param t_bucketsCount Rounded up to power of 2 */
+  explicit Broadphase(const float& t_cellSize,
+                      const unsigned int& t_bucketsCount = 4096);
+  ~Broadphase();
+
+  static const unsigned int invalidProxy;
+
+  /** @returns Proxy id, ids of removed proxies are reused */
+  unsigned int add(const float* t_min, const float* t_max,
+                   const unsigned int& t_userData = 0);
+  void update(const unsigned int& t_proxy, const float* t_min,
+              const float* t_max);
+  void remove(const unsigned int& t_proxy);
+  void clear();
+
+  unsigned int getUserData(const unsigned int& t_proxy) const {
+    return proxies[t_proxy].userData;
+  }
+
+  unsigned int getProxiesCount() const { return proxiesCount; }
+
+  /** All overlapping pairs, each once. o_pairs is cleared first */
+  void findPairs(std::vector<BroadphasePair>& o_pairs) const;
+
+  /** Proxies overlapping box. o_proxies is cleared first */
+  void queryBox(const float* t_min, const float* t_max,
+                std::vector<unsigned int>& o_proxies) const;
+
+  /**
+   * Proxies hit by ray, nearest first. Cells are walked in ray order
+   * (3D DDA). o_hits is cleared first.
+   * @param t_direction Normalized.
+   */
+  void queryRay(const float* t_origin, const float* t_direction,
+                const float& t_maxDistance,
+                std::vector<BroadphaseRayHit>& o_hits) const;
+
+ private:
+  struct Proxy {
+    float min[3], max[3];
+
+    /** Inclusive cell range */
+    int cellMin[3], cellMax[3];
+
+    unsigned int userData;
+    bool isActive;
+
+    /** Query id of last visit, to report proxy once */
+    mutable unsigned int queryStamp;
+  };
+
+  struct Entry {
+    int cell[3];
+    unsigned int proxy;
+  };
+
+  float cellSize, invCellSize;
+  unsigned int bucketMask;
+  unsigned int proxiesCount;
+  mutable unsigned int queryStamp;
+
+  std::vector<Proxy> proxies;
+  std::vector<unsigned int> freeProxies;
+  std::vector<std::vector<Entry>> buckets;
+
+  int getCell(const float& t_value) const;
+  unsigned int getBucket(const int& t_x, const int& t_y, const int& t_z) const;
+
+  void insertCells(const unsigned int& t_proxy);
+  void removeCells(const unsigned int& t_proxy);
+
+  unsigned int nextQueryStamp() const;
+
+  /** Box around all proxies. False if there are none */
+  bool getBounds(float* o_min, float* o_max) const;
+};
+
+}  // namespace Tyra
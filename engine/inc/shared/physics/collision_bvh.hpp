@@ -0,0 +1,154 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+
+namespace Tyra {
+
+struct CollisionRay {
+  float origin[4];
+
+  /** Normalized */
+  float direction[4];
+
+  float maxDistance;
+};
+
+struct CollisionHit {
+  /** Along ray/sweep direction, or to closest point. -1 if no hit */
+  float distance;
+
+  /** Point on triangle */
+  float point[4];
+
+  /** Triangle normal for rays, contact normal for sweeps and closest */
+  float normal[4];
+
+  unsigned int triangle;
+};
+
+/** 32 bytes, 2 nodes per cache line */
+struct CollisionBvhNode {
+  float min[3];
+
+  /** Index of left child (right is next), or first triangle in leaf */
+  unsigned int index;
+
+  float max[3];
+
+  /** 0 -> inner node */
+  unsigned int count;
+};
+
+/** v1 = v0 + edge1, v2 = v0 + edge2 */
+struct CollisionTriangle {
+  float v0[4];
+  float edge1[4];
+  float edge2[4];
+
+  /** Normalized, counter clockwise winding */
+  float normal[4];
+};
+
+/**
+ * Bounding volume hierarchy over static level triangles.
+ * Build once at load (allocates), queries don't allocate and only walk
+ * nodes which can change the result.
+ *
+ * Sweeps move sphere/capsule along a direction and stop at first contact.
+ * Distance to one triangle is convex in time, so every candidate triangle
+ * is solved by Newton steps from the start (never past the contact).
+ */
+class CollisionBvh {
+ public:
+  CollisionBvh();
+  ~CollisionBvh();
+
+  static const unsigned int maxLeafTriangles;
+  static const unsigned int maxSweepIterations;
+  static const float sweepEpsilon;
+
+  /** Contacts with smaller -dot(direction, normal) are treated as sliding */
+  static const float sweepMinApproach;
+
+  /**
+   * Add triangles, call build() after all adds.
+   * @param t_vertices xyzw, 3 vertices per triangle.
+   * @param t_matrix Optional column major transform (like M4x4).
+   */
+  void addTriangles(const float* t_vertices, const unsigned int& t_count,
+                    const float* t_matrix = nullptr);
+
+  void build();
+  void clear();
+
+  /** Closest hit in ray maxDistance */
+  bool raycast(const CollisionRay& t_ray, CollisionHit* o_hit) const;
+
+  /** @returns Count of rays which hit something */
+  unsigned int raycast(const CollisionRay* t_rays, const unsigned int& t_count,
+                       CollisionHit* o_hits) const;
+
+  /** Any hit in ray maxDistance, faster than raycast() */
+  bool isOccluded(const CollisionRay& t_ray) const;
+
+  /**
+   * Sphere sweep. Hit distance is how far sphere can move.
+   * @param t_direction Normalized.
+   */
+  bool sweepSphere(const float* t_center, const float& t_radius,
+                   const float* t_direction, const float& t_distance,
+                   CollisionHit* o_hit) const;
+
+  /** Capsule (segment a-b + radius) sweep, as sweepSphere() */
+  bool sweepCapsule(const float* t_a, const float* t_b, const float& t_radius,
+                    const float* t_direction, const float& t_distance,
+                    CollisionHit* o_hit) const;
+
+  /** Closest point on any triangle, not further than t_maxDistance */
+  bool closestPoint(const float* t_point, const float& t_maxDistance,
+                    CollisionHit* o_hit) const;
+
+  const std::vector<CollisionBvhNode>& getNodes() const { return nodes; }
+  const std::vector<CollisionTriangle>& getTriangles() const {
+    return triangles;
+  }
+
+  /** Closest points of segment a-b and triangle, @returns distance */
+  static float getSegmentTriangleDistance(const float* t_a, const float* t_b,
+                                          const CollisionTriangle& t_triangle,
+                                          float* o_segmentPoint,
+                                          float* o_trianglePoint);
+
+ private:
+  std::vector<CollisionBvhNode> nodes;
+  std::vector<CollisionTriangle> triangles;
+
+  static const unsigned int maxStackSize;
+
+  void buildNode(const unsigned int& t_node,
+                 std::vector<unsigned int>& indices,
+                 const std::vector<float>& centroids,
+                 const unsigned int& t_first, const unsigned int& t_count);
+
+  bool sweepTriangle(const float* t_a, const float* t_b,
+                     const float& t_radius, const float* t_direction,
+                     const float& t_distance,
+                     const CollisionTriangle& t_triangle,
+                     CollisionHit* o_hit) const;
+
+  bool sweep(const float* t_a, const float* t_b, const float& t_radius,
+             const float* t_direction, const float& t_distance,
+             CollisionHit* o_hit) const;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,68 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Picks render scale from measured GPU busy time.
+ * Pixel cost grows with scale^2, so correction is square root of
+ * target/measured ratio, limited per frame and quantized, so resolution
+ * doesn't flicker between neighbour sizes.
+ */
+class DynamicResolution {
+ public:
+  DynamicResolution();
+  ~DynamicResolution();
+
+  /** Scales are quantized to this value */
+  static const float scaleStep;
+
+  /**
+   * @param t_targetTime Frame time budget in microseconds
+   * @param t_minScale Lowest allowed scale, 0 - 1
+   */
+  void init(const unsigned int& t_targetTime, const float& t_minScale);
+
+  /** Feed busy time of finished frame. @returns scale for next frame */
+  const float& update(const unsigned int& t_busyTime);
+
+  const float& getScale() const { return scale; }
+
+  /** Smoothed busy time in microseconds */
+  unsigned int getAverageTime() const {
+    return static_cast<unsigned int>(averageTime);
+  }
+
+  const unsigned int& getTargetTime() const { return targetTime; }
+
+  /**
+   * @returns Size scaled and rounded to multiple of t_alignment,
+   * not bigger than t_size
+   */
+  unsigned int getScaledSize(const unsigned int& t_size,
+                             const unsigned int& t_alignment) const;
+
+  void reset();
+
+ private:
+  /** Busy below this part of target -> scale up */
+  static const float upThreshold;
+  /** Max scale change per frame */
+  static const float maxChange;
+  /** Weight of newest frame in average */
+  static const float smoothing;
+
+  unsigned int targetTime;
+  float scale, minScale, averageTime;
+};
+
+}  // namespace Tyra
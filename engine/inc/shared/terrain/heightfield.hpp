@@ -0,0 +1,71 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+
+namespace Tyra {
+
+/**
+ * Compact 16-bit height grid (2 bytes per sample).
+ * Sample (x, z) is at world (x * cellSize, height, z * cellSize),
+ * height = sample * heightScale + heightOffset.
+ * Queries outside grid are clamped to its border.
+ */
+class Heightfield {
+ public:
+  /** @param t_data width * depth samples, row by row (z), copied */
+  Heightfield(const unsigned short* t_data, const unsigned int& t_width,
+              const unsigned int& t_depth, const float& t_cellSize,
+              const float& t_heightScale, const float& t_heightOffset);
+  ~Heightfield();
+
+  const unsigned int& getWidth() const { return width; }
+  const unsigned int& getDepth() const { return depth; }
+  const float& getCellSize() const { return cellSize; }
+
+  float getSizeX() const { return (width - 1) * cellSize; }
+  float getSizeZ() const { return (depth - 1) * cellSize; }
+
+  /** Height of grid sample, clamped */
+  float getSample(const int& t_x, const int& t_z) const;
+
+  /**
+   * Bilinear height. Rendered terrain is split into triangles,
+   * so it can differ from this by less than quad "bend".
+   */
+  float getHeight(const float& t_x, const float& t_z) const;
+
+  /** Normalized, from central differences of bilinear heights */
+  void getNormal(const float& t_x, const float& t_z, float* o_normal) const;
+
+  /**
+   * Batched getHeight().
+   * @param t_positions xyzw per position, only x and z are used.
+   */
+  void getHeights(const float* t_positions, const unsigned int& t_count,
+                  float* o_heights) const;
+
+  /** Min and max height of samples in (inclusive) range */
+  void getRange(const int& t_x0, const int& t_z0, const int& t_x1,
+                const int& t_z1, float* o_min, float* o_max) const;
+
+  bool isInside(const float& t_x, const float& t_z) const;
+
+  const std::vector<unsigned short>& getData() const { return data; }
+
+ private:
+  std::vector<unsigned short> data;
+  unsigned int width, depth;
+  float cellSize, invCellSize, heightScale, heightOffset;
+};
+
+}  // namespace Tyra
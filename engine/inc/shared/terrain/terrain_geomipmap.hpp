@@ -0,0 +1,83 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./heightfield.hpp"
+
+namespace Tyra {
+
+enum TerrainEdge {
+  TERRAIN_EDGE_LEFT,   // -X
+  TERRAIN_EDGE_RIGHT,  // +X
+  TERRAIN_EDGE_NEAR,   // -Z
+  TERRAIN_EDGE_FAR,    // +Z
+  TERRAIN_EDGES_COUNT
+};
+
+/**
+ * Geomipmapping of heightfield chunks (chunkSize x chunkSize cells).
+ * LOD n uses every 2^n-th sample. Seams: edge vertices next to coarser
+ * chunk are moved onto its straight edge, so there are no cracks and
+ * triangle count stays the same.
+ */
+class TerrainGeomipmap {
+ public:
+  /** @returns Chunks on X/Z axis. (size - 1) must divide by chunkSize */
+  static unsigned int getChunksCount(const unsigned int& t_samples,
+                                     const unsigned int& t_chunkSize);
+
+  /** @returns 0 (full detail) up to t_lodCount - 1 */
+  static unsigned int selectLod(const float& t_distance,
+                                const float& t_lodDistance,
+                                const unsigned int& t_lodCount);
+
+  /**
+   * LOD of every chunk (row by row), by XZ distance from point to
+   * chunk bounds.
+   */
+  static void selectLods(const Heightfield& t_heightfield,
+                         const unsigned int& t_chunkSize, const float& t_x,
+                         const float& t_z, const float& t_lodDistance,
+                         const unsigned int& t_lodCount,
+                         unsigned char* o_lods);
+
+  /** Triangle list size of chunk */
+  static unsigned int getVertexCount(const unsigned int& t_chunkSize,
+                                     const unsigned int& t_lod);
+
+  /**
+   * @param t_neighborLods LOD of neighbors, by TerrainEdge. Use own LOD
+   * if there is no neighbor.
+   * @param o_positions xyzw, getVertexCount() vertices.
+   * @param o_uvs Optional, (u, v, 1, 0). 0-1 over whole heightfield
+   * multiplied by t_uvScale.
+   */
+  static void buildChunk(const Heightfield& t_heightfield,
+                         const unsigned int& t_chunkX,
+                         const unsigned int& t_chunkZ,
+                         const unsigned int& t_chunkSize,
+                         const unsigned int& t_lod,
+                         const unsigned int* t_neighborLods,
+                         float* o_positions, float* o_uvs = nullptr,
+                         const float& t_uvScale = 1.0F);
+
+ private:
+  TerrainGeomipmap();
+
+  /** Sample height, snapped to coarser neighbor edges */
+  static float getVertexHeight(const Heightfield& t_heightfield,
+                               const int& t_x, const int& t_z,
+                               const int& t_x0, const int& t_z0,
+                               const int& t_chunkSize,
+                               const int* t_neighborSteps);
+};
+
+}  // namespace Tyra
@@ -0,0 +1,53 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./threading_semaphore.hpp"
+
+namespace Tyra {
+
+/**
+ * Auto-reset event for single waiting thread.
+ * set() wakes the waiting thread, or the next one which will call wait().
+ * Many set() calls before wait() are merged into one.
+ */
+class ThreadingEvent {
+ public:
+  ThreadingEvent();
+  ~ThreadingEvent();
+
+  void init();
+
+  void set() { sema.signal(); }
+
+  /** set() version which is safe to call from interrupt handler. */
+  void setFromInterrupt() { sema.signalFromInterrupt(); }
+
+  /** Block until event is set, and reset it. */
+  void wait() { sema.wait(); }
+
+  /** Reset without waiting. */
+  void reset() { sema.tryWait(); }
+
+  /**
+   * Block until condition is true.
+   * Condition is checked again after every set().
+   */
+  template <typename Condition>
+  void waitUntil(Condition condition) {
+    while (!condition()) wait();
+  }
+
+ private:
+  ThreadingSemaphore sema;
+};
+
+}  // namespace Tyra
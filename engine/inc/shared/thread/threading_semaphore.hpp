@@ -0,0 +1,65 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#ifndef __mips__
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace Tyra {
+
+/**
+ * Counting semaphore.
+ * EE kernel semaphore on PS2, std::mutex + std::condition_variable on host.
+ */
+class ThreadingSemaphore {
+ public:
+  ThreadingSemaphore();
+  ~ThreadingSemaphore();
+
+  void init(const int& t_initCount, const int& t_maxCount);
+
+  /** Block thread until count is bigger than 0, then decrement it. */
+  void wait();
+
+  /**
+   * Decrement count if bigger than 0.
+   * @returns False if it would block.
+   */
+  bool tryWait();
+
+  void signal();
+
+  /**
+   * signal() version which is safe to call from interrupt handler.
+   * Same as signal() on host.
+   */
+  void signalFromInterrupt();
+
+  int getCount() const;
+
+#ifdef __mips__
+  /** Kernel id, for APIs which expect raw semaphore. */
+  const int& getId() const { return id; }
+#endif
+
+ private:
+#ifdef __mips__
+  int id;
+#else
+  mutable std::mutex mutex;
+  std::condition_variable condition;
+  int count, maxCount;
+#endif
+};
+
+}  // namespace Tyra
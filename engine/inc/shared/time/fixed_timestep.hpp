@@ -0,0 +1,54 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Accumulator for fixed rate game updates.
+ * Real frame time is added once per frame, then step() is called until
+ * it returns false. Remaining time gives interpolation alpha for render.
+ */
+class FixedTimestep {
+ public:
+  FixedTimestep();
+  ~FixedTimestep();
+
+  /**
+   * @param t_rate Updates per second
+   * @param t_maxSteps Max updates per frame. Lag above is dropped,
+   * so slow frames don't snowball into even slower ones.
+   */
+  void init(const float& t_rate, const unsigned int& t_maxSteps);
+
+  void advance(const float& t_seconds);
+
+  /** @returns true if next update should run */
+  bool step();
+
+  /** Step length in seconds */
+  const float& getStep() const { return stepTime; }
+
+  /** Progress to next step, 0 - 1. For render interpolation */
+  float getAlpha() const { return accumulator / stepTime; }
+
+  /** Steps done since last advance() */
+  unsigned int getStepsCount() const { return steps; }
+
+  /** Total steps skipped because of maxSteps */
+  unsigned int getDroppedCount() const { return dropped; }
+
+ private:
+  float stepTime, accumulator;
+  unsigned int maxSteps, steps, dropped;
+};
+
+}  // namespace Tyra
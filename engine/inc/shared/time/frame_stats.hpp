@@ -0,0 +1,60 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Rolling window of frame times (microseconds).
+ * Average and histogram are updated per frame, percentiles are computed
+ * on request, so keep them out of hot paths.
+ */
+class FrameStats {
+ public:
+  /** @param t_bucketSize Histogram bucket width in microseconds */
+  explicit FrameStats(const unsigned int& t_bucketSize = 2000);
+  ~FrameStats();
+
+  static const unsigned int windowSize = 128;
+
+  /** Last bucket holds everything longer */
+  static const unsigned int bucketsCount = 24;
+
+  void add(const unsigned int& t_microseconds);
+  void reset();
+
+  /** Frames in window */
+  unsigned int getCount() const { return count; }
+
+  unsigned int getLast() const;
+  unsigned int getAverage() const;
+  unsigned int getMin() const;
+  unsigned int getMax() const;
+
+  /** @param t_percent 0 - 100, for example 99 -> 1% lows */
+  unsigned int getPercentile(const float& t_percent) const;
+
+  /** Frames in window per bucket, bucketsCount long */
+  const unsigned int* getHistogram() const { return histogram; }
+  unsigned int getBucketSize() const { return bucketSize; }
+
+  void print() const;
+
+ private:
+  unsigned int samples[windowSize];
+  unsigned int histogram[bucketsCount];
+  unsigned int bucketSize, count, next;
+  unsigned long long sum;
+
+  unsigned int getBucket(const unsigned int& t_microseconds) const;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,28 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+class Hash {
+ public:
+  /** 32bit FNV-1a hash of null terminated string. */
+  static unsigned int fnv1a(const char* t_text);
+
+  /** 32bit FNV-1a hash of data. */
+  static unsigned int fnv1a(const void* t_data, const unsigned int& t_size);
+
+ private:
+  static const unsigned int offsetBasis;
+  static const unsigned int prime;
+};
+
+}  // namespace Tyra
@@ -0,0 +1,44 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <vector>
+
+namespace Tyra {
+
+/**
+ * Small LZ77 codec (LZ4 like block format).
+ * Compression is slow-ish and meant for host tools,
+ * decompression is a simple byte copy loop, fast enough for EE.
+ */
+class Lz {
+ public:
+  static std::vector<unsigned char> compress(const unsigned char* t_data,
+                                             const unsigned int& t_size);
+
+  /**
+   * @param o_output Must have space for whole decompressed data.
+   * @returns False if data is corrupted or does not fit into output.
+   */
+  static bool decompress(const unsigned char* t_data,
+                         const unsigned int& t_size, unsigned char* o_output,
+                         const unsigned int& t_outputSize);
+
+ private:
+  static const unsigned int minMatch;
+  static const unsigned int maxOffset;
+  static const unsigned int hashBits;
+
+  static void writeLength(std::vector<unsigned char>& output,
+                          unsigned int length);
+};
+
+}  // namespace Tyra
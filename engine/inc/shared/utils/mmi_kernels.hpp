@@ -0,0 +1,94 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+namespace Tyra {
+
+/**
+ * Bulk pixel and vertex conversions.
+ * On EE main loops use MMI (128-bit integer SIMD) and VU0 macro mode,
+ * everywhere else (host) they fall back to the *Scalar() versions.
+ * Integer kernels must give exactly the same results as scalar ones,
+ * float kernels can differ in last bits (VU0 rounding) - see mmi_tests.cpp.
+ *
+ * Fast paths need qword aligned data, unaligned head/tail is done by
+ * scalar code.
+ */
+class MmiKernels {
+ public:
+  /** RGBA8 alpha rescale 0-255 -> 0-128 (GS), in place */
+  static void halveAlpha(unsigned char* t_pixels, const unsigned int& t_count);
+  static void halveAlphaScalar(unsigned char* t_pixels,
+                               const unsigned int& t_count);
+
+  /** RGBX (4 bytes per pixel) -> RGB (3 bytes) */
+  static void rgbxToRgb(unsigned char* o_pixels, const unsigned char* t_pixels,
+                        const unsigned int& t_count);
+  static void rgbxToRgbScalar(unsigned char* o_pixels,
+                              const unsigned char* t_pixels,
+                              const unsigned int& t_count);
+
+  /** RGB (3 bytes per pixel) -> RGBA with constant alpha */
+  static void rgbToRgba(unsigned char* o_pixels, const unsigned char* t_pixels,
+                        const unsigned int& t_count,
+                        const unsigned char& t_alpha);
+
+  /** 4bpp nibble order swap (PNG -> GS), in place */
+  static void swapNibbles(unsigned char* t_data, const unsigned int& t_size);
+  static void swapNibblesScalar(unsigned char* t_data,
+                                const unsigned int& t_size);
+
+  /**
+   * CSM1 CLUT order: entries 8-15 and 16-23 of every 32 are swapped.
+   * @param t_count Multiple of 32
+   */
+  static void swizzleClutCsm1(unsigned int* t_clut,
+                              const unsigned int& t_count);
+  static void swizzleClutCsm1Scalar(unsigned int* t_clut,
+                                    const unsigned int& t_count);
+
+  /**
+   * 4 bytes -> 4 floats, out = byte * scale + offset (per lane).
+   * Source doesn't need to be aligned, output, scale and offset must be
+   * qword aligned.
+   * @param t_count Count of 4 element vectors
+   */
+  static void bytesToFloats(float* o_vectors, const unsigned char* t_data,
+                            const unsigned int& t_count, const float* t_scale,
+                            const float* t_offset);
+  static void bytesToFloatsScalar(float* o_vectors,
+                                  const unsigned char* t_data,
+                                  const unsigned int& t_count,
+                                  const float* t_scale, const float* t_offset);
+
+  /** As bytesToFloats(), but for unsigned 16-bit data */
+  static void halfwordsToFloats(float* o_vectors,
+                                const unsigned short* t_data,
+                                const unsigned int& t_count,
+                                const float* t_scale, const float* t_offset);
+  static void halfwordsToFloatsScalar(float* o_vectors,
+                                      const unsigned short* t_data,
+                                      const unsigned int& t_count,
+                                      const float* t_scale,
+                                      const float* t_offset);
+
+  /** Copy/fill of qword aligned blocks */
+  static void copy128(void* o_data, const void* t_data,
+                      const unsigned int& t_qwords);
+  static void fill128(void* o_data, const unsigned int& t_value,
+                      const unsigned int& t_qwords);
+
+  static bool isAligned(const void* t_pointer, const unsigned int& t_align) {
+    return (reinterpret_cast<unsigned long>(t_pointer) & (t_align - 1)) == 0;
+  }
+};
+
+}  // namespace Tyra
@@ -0,0 +1,109 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace Tyra {
+
+struct WorldLayoutHeader {
+  char magic[4];
+  unsigned int version;
+  unsigned int cellsCount;
+  unsigned int texturesCount;
+  float cellSize;
+  unsigned int stringsOffset;
+  unsigned int stringsSize;
+  unsigned int size;
+};
+
+struct WorldLayoutTexture {
+  unsigned int nameOffset;
+
+  /** Texture memory (pixels + clut) in bytes */
+  unsigned int vramSize;
+};
+
+struct WorldLayoutCell {
+  int x, z;
+  unsigned int meshPathOffset;
+
+  /** Size of cell mesh arrays in RAM, in bytes */
+  unsigned int ramSize;
+
+  /** Range in texture indices table */
+  unsigned int firstTexture, texturesCount;
+
+  unsigned int reserved[2];
+  float min[4];
+  float max[4];
+};
+
+struct WorldLayoutSourceTexture {
+  std::string name;
+  unsigned int vramSize;
+};
+
+struct WorldLayoutSourceCell {
+  int x, z;
+  std::string meshPath;
+  unsigned int ramSize;
+
+  /** Indices of WorldLayoutSource::textures */
+  std::vector<unsigned int> textures;
+
+  float min[3];
+  float max[3];
+};
+
+struct WorldLayoutSource {
+  float cellSize;
+  std::vector<WorldLayoutSourceTexture> textures;
+  std::vector<WorldLayoutSourceCell> cells;
+};
+
+/**
+ * World split into cells (.tyw, tools/worldsplit output).
+ * Layout: header, cells, textures, texture indices table, strings.
+ * Paths are relative to layout file directory.
+ * Textures are shared between cells, so their memory can be refcounted.
+ */
+class WorldLayoutFile {
+ public:
+  static const unsigned int version;
+
+  static bool validate(const unsigned char* t_data, const unsigned int& t_size);
+
+  static const WorldLayoutHeader* getHeader(const unsigned char* t_data);
+
+  static const WorldLayoutCell* getCell(const unsigned char* t_data,
+                                        const unsigned int& t_index);
+
+  static const WorldLayoutTexture* getTexture(const unsigned char* t_data,
+                                              const unsigned int& t_index);
+
+  /** @returns index of t_index'th texture of cell */
+  static unsigned int getCellTexture(const unsigned char* t_data,
+                                     const WorldLayoutCell* t_cell,
+                                     const unsigned int& t_index);
+
+  static const char* getString(const unsigned char* t_data,
+                               const unsigned int& t_offset);
+
+  /** @returns Empty vector if source is invalid. */
+  static std::vector<unsigned char> build(const WorldLayoutSource& t_source);
+
+ private:
+  static unsigned int getIndicesOffset(const WorldLayoutHeader* header);
+};
+
+}  // namespace Tyra
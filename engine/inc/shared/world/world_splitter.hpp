@@ -0,0 +1,43 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "mesh/binary_mesh_file.hpp"
+#include <vector>
+
+namespace Tyra {
+
+struct WorldSplitCell {
+  int x, z;
+  BinaryMeshSource mesh;
+  float min[3];
+  float max[3];
+};
+
+/**
+ * Splits static level mesh into XZ grid cells, for world streaming.
+ * Triangles are assigned by their centroid, so they are not cut and
+ * cell bounds can slightly overlap.
+ */
+class WorldSplitter {
+ public:
+  /**
+   * Only first frame is used. Empty cells and materials are skipped.
+   * @returns Cells sorted by (z, x).
+   */
+  static std::vector<WorldSplitCell> split(const BinaryMeshSource& t_mesh,
+                                           const float& t_cellSize);
+
+  /** @returns Size of mesh arrays in bytes */
+  static unsigned int getArraysSize(const BinaryMeshSource& t_mesh);
+};
+
+}  // namespace Tyra
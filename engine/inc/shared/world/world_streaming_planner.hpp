@@ -0,0 +1,82 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#pragma once
+
+#include "./world_layout_file.hpp"
+#include <vector>
+
+namespace Tyra {
+
+enum WorldCellState {
+  WORLD_CELL_UNLOADED,
+  WORLD_CELL_LOADING,
+  WORLD_CELL_RESIDENT
+};
+
+struct WorldStreamingOptions {
+  /** Cells closer than this (XZ distance to cell bounds) are required */
+  float loadRadius = 150.0F;
+
+  /** Cells closer than this are loaded in advance, if budgets allow */
+  float prefetchRadius = 250.0F;
+
+  /** Resident cells further than this are unloaded. >= prefetchRadius */
+  float evictRadius = 300.0F;
+
+  /** Budget for cell meshes, in bytes */
+  unsigned int ramBudget = 8 * 1024 * 1024;
+
+  /** Budget for cell textures, in bytes */
+  unsigned int vramBudget = 2 * 1024 * 1024;
+
+  /** Cell loads in flight at once */
+  unsigned int maxLoadsInFlight = 2;
+};
+
+struct WorldStreamingPlan {
+  /** Cells to load, most important first */
+  std::vector<unsigned int> loads;
+
+  /** Resident cells to unload */
+  std::vector<unsigned int> evictions;
+
+  /** Required cells (in load radius) which didn't fit into budgets */
+  unsigned int overBudget;
+};
+
+/**
+ * Decides which world cells should be loaded and unloaded around camera.
+ * Memory of loading cells is reserved up front. Textures shared by many
+ * cells are counted once.
+ */
+class WorldStreamingPlanner {
+ public:
+  /** @returns XZ distance between point and cell bounds, 0 if inside */
+  static float getDistance(const WorldLayoutCell* t_cell, const float& t_x,
+                           const float& t_z);
+
+  /**
+   * @param t_states State of every layout cell.
+   * @param t_x Camera X.
+   * @param t_z Camera Z.
+   */
+  static WorldStreamingPlan plan(const unsigned char* t_layout,
+                                 const std::vector<WorldCellState>& t_states,
+                                 const float& t_x, const float& t_z,
+                                 const WorldStreamingOptions& t_options);
+
+  /** @returns RAM and VRAM used by loading and resident cells */
+  static void getUsage(const unsigned char* t_layout,
+                       const std::vector<WorldCellState>& t_states,
+                       unsigned int* o_ram, unsigned int* o_vram);
+};
+
+}  // namespace Tyra
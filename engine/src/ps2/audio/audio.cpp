@@ -10,7 +10,6 @@
 
 #include "audio/audio.hpp"
 #include "debug/debug.hpp"
-#include "thread/threading.hpp"
 #include <kernel.h>
 #include <malloc.h>
 
@@ -33,12 +32,24 @@ Audio::~Audio() {
   if (threadStack) delete[] threadStack;
 }
 
-void Audio::init() {
+void Audio::init() { init(AudioStreamOptions()); }
+
+void Audio::init(const AudioStreamOptions& songStreamOptions) {
+  init(songStreamOptions, AudioVoicesOptions());
+}
+
+void Audio::init(const AudioStreamOptions& songStreamOptions,
+                 const AudioVoicesOptions& voicesOptions) {
   initAUDSRV();
 
-  song.init();
+  song.init(songStreamOptions);
   adpcm.init();
 
+  // Opt-in, games can use explicit channels of AudioAdpcm
+  if (voicesOptions.channelsCount > 0) {
+    voices.init(voicesOptions.firstChannel, voicesOptions.channelsCount);
+  }
+
   initThread();
 
   TYRA_LOG("Audio initialized!");
@@ -62,10 +73,11 @@ void Audio::initThread() {
   StartThread(threadId, this);
 }
 
-void Audio::work() {
-  Threading::switchThread();
-
-  song.work();
-}
+/**
+ * Audio thread never sleeps for fixed time.
+ * It blocks in song.work(), on audsrv fill callback, read-ahead
+ * buffer, or (when song is not playing) on play event.
+ */
+void Audio::work() { song.work(); }
 
 }  // namespace Tyra
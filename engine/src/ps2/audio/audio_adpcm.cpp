@@ -15,7 +15,8 @@
 #include <kernel.h>
 #include <cstdlib>
 #include <audsrv.h>
-#include "thread/threading.hpp"
+#include "thread/threading_vsync.hpp"
+#include "memory/memory.hpp"
 
 namespace Tyra {
 
@@ -36,11 +37,30 @@ void AudioAdpcm::reset() { audsrv_adpcm_init(); }
 
 audsrv_adpcm_t* AudioAdpcm::load(const char* t_path) {
   FILE* file = fopen(t_path, "rb");
+  TYRA_ASSERT(file != nullptr, "Failed to open adpcm file: ", t_path);
+
   fseek(file, 0, SEEK_END);
   unsigned int adpcmFileSize = ftell(file);
-  unsigned char data[adpcmFileSize];
   rewind(file);
-  fread(data, sizeof(unsigned char), adpcmFileSize, file);
+
+  auto* data = static_cast<unsigned char*>(
+      Memory::allocate(adpcmFileSize, MEMORY_CATEGORY_AUDIO, 64));
+  TYRA_ASSERT(data != nullptr, "Failed to allocate ", adpcmFileSize,
+              " bytes for adpcm file: ", t_path);
+
+  auto readed = fread(data, sizeof(unsigned char), adpcmFileSize, file);
+  TYRA_ASSERT(readed == adpcmFileSize, "Failed to read ", adpcmFileSize,
+              " bytes from ", t_path);
+  fclose(file);
+
+  auto* result = load(data, adpcmFileSize);
+
+  Memory::free(data);
+  return result;
+}
+
+audsrv_adpcm_t* AudioAdpcm::load(const unsigned char* t_data,
+                                 const unsigned int& t_size) {
   auto* result = new audsrv_adpcm_t();
   result->size = 0;
   result->buffer = 0;
@@ -48,11 +68,10 @@ audsrv_adpcm_t* AudioAdpcm::load(const char* t_path) {
   result->pitch = 0;
   result->channels = 0;
 
-  if (audsrv_load_adpcm(result, data, adpcmFileSize)) {
+  if (audsrv_load_adpcm(result, const_cast<unsigned char*>(t_data), t_size)) {
     TYRA_ERROR("AUDSRV returned error string: ", audsrv_get_error_string());
   }
 
-  fclose(file);
   return result;
 }
 
@@ -60,6 +79,12 @@ audsrv_adpcm_t* AudioAdpcm::load(const std::string& t_path) {
   return load(t_path.c_str());
 }
 
+audsrv_adpcm_t* AudioAdpcm::load(ArchiveReader& t_archive,
+                                 const std::string& t_name) {
+  auto file = t_archive.read(t_name);
+  return load(file.data, file.size);
+}
+
 AdpcmResult AudioAdpcm::tryPlay(audsrv_adpcm_t* t_adpcm) {
   return tryPlay(t_adpcm, -1);
 }
@@ -86,7 +111,7 @@ void AudioAdpcm::playWait(audsrv_adpcm_t* t_adpcm, const char& t_ch) {
 
   while (res == AdpcmResult::ADPCM_NO_FREE_CHANNELS ||
          res == AdpcmResult::ADPCM_CHANNEL_USED) {
-    Threading::switchThread();
+    ThreadingVSync::wait();
     res = tryPlay(t_adpcm, t_ch);
   }
 }
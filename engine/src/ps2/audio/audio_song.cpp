@@ -10,17 +10,17 @@
 
 #include "audio/audio_song.hpp"
 #include "debug/debug.hpp"
+#include "audio/wav_parser.hpp"
 
-#include <malloc.h>
 #include <cstdlib>
 #include <audsrv.h>
 
 namespace Tyra {
 
 const unsigned short AudioSong::chunkSize = 4 * 1024;
+const unsigned int AudioSong::headerReadSize = 4 * 1024;
 
 AudioSong::AudioSong() {
-  chunkReadStatus = 0;
   tyraVolume = 0;
   audsrvVolume = 0;
 
@@ -29,26 +29,47 @@ AudioSong::AudioSong() {
   inLoop = false;
   songFinished = false;
 
-  chunk = nullptr;
+  slot = nullptr;
+  slotOffset = 0;
 }
 
-AudioSong::~AudioSong() {
-  if (chunk) delete[] chunk;
-}
+AudioSong::~AudioSong() {}
+
+void AudioSong::init() { init(AudioStreamOptions()); }
 
-void AudioSong::init() {
-  chunk = static_cast<char*>(memalign(sizeof(char), chunkSize));
+void AudioSong::init(const AudioStreamOptions& options) {
+  stream.init(options);
 
   initSema();
   initAUDSRV();
-  setSongFormat();
+  setSongFormat(16, 22050, 2);
 }
 
 void AudioSong::load(const char* t_path) {
   if (songLoaded) unloadSong();
-  wav = fopen(t_path, "rb");
+  FILE* wav = fopen(t_path, "rb");
   TYRA_ASSERT(wav != nullptr, "Failed to open wav file!");
-  rewindSongToStart();
+
+  fseek(wav, 0, SEEK_END);
+  long fileSize = ftell(wav);
+  rewind(wav);
+
+  auto* header = new unsigned char[headerReadSize];
+  unsigned int headerSize = fread(header, 1, headerReadSize, wav);
+
+  WavInfo info;
+  bool isValid = WavParser::parse(header, headerSize, fileSize, &info);
+  delete[] header;
+
+  TYRA_ASSERT(isValid, "Unsupported WAV file: ", t_path,
+              ". Only mono/stereo 8/16bit PCM or IMA ADPCM are supported");
+
+  setSongFormat(info.format == WAV_FORMAT_PCM ? info.bitsPerSample : 16,
+                info.sampleRate, info.channels);
+
+  // File is closed by the stream
+  stream.open(wav, info);
+  songFinished = false;
   songLoaded = true;
 }
 
@@ -60,6 +81,7 @@ void AudioSong::play() {
   tyraVolume = audsrvVolume;
   audsrv_set_volume(tyraVolume);
   songPlaying = true;
+  playEvent.set();
 }
 
 void AudioSong::stop() {
@@ -80,7 +102,7 @@ std::size_t AudioSong::getListenersCount() const {
 
 void AudioSong::initAUDSRV() {
   int ret = audsrv_on_fillbuf(chunkSize, (audsrv_callback_t)iSignalSema,
-                              (void*)fillbufferSema);
+                              (void*)fillbufferSema.getId());
 
   TYRA_ASSERT(ret >= 0,
               "AUDSRV returned error string:", audsrv_get_error_string());
@@ -90,34 +112,32 @@ void AudioSong::initAUDSRV() {
  * finished. */
 void AudioSong::initSema() {
   TYRA_LOG("Creating audio semaphore");
-  sema.init_count = 0;
-  sema.max_count = 1;
-  sema.option = 0;
-  fillbufferSema = CreateSema(&sema);
+  fillbufferSema.init(0, 1);
+  playEvent.init();
   TYRA_LOG("AudioSong semaphore created");
 }
 
-/**
- * Close file.
- * Delete song path from memory.
- */
+/** Stop streaming and close file. */
 void AudioSong::unloadSong() {
   songLoaded = false;
-  fclose(wav);
+  stream.close();
 }
 
-/** Fseek on wav. */
+/**
+ * Restart read-ahead from the start of the song.
+ * Already buffered slots are dropped by the audio thread.
+ */
 void AudioSong::rewindSongToStart() {
-  if (wav != nullptr) fseek(wav, 0x30, SEEK_SET);
-  chunkReadStatus = 0;
+  stream.rewind();
   songFinished = false;
 }
 
-/** Set WAV format to 16bit, 22050Hz, stereo. */
-void AudioSong::setSongFormat() {
-  format.bits = 16;
-  format.freq = 22050;
-  format.channels = 2;
+/** Set format of PCM data sent to audsrv. */
+void AudioSong::setSongFormat(const int& bits, const int& freq,
+                              const int& channels) {
+  format.bits = bits;
+  format.freq = freq;
+  format.channels = channels;
 
   if (audsrv_set_format(&format)) {
     TYRA_ERROR("AUDSRV returned error string: ", audsrv_get_error_string());
@@ -134,7 +154,11 @@ void AudioSong::setVolume(const unsigned char& t_vol) {
 }
 
 void AudioSong::work() {
-  if (!songPlaying || !songLoaded) return;
+  if (!songPlaying || !songLoaded) {
+    playEvent.wait();
+    return;
+  }
+
   if (songFinished) {
     if (inLoop) {
       for (unsigned int i = 0; i < getListenersCount(); i++)
@@ -146,16 +170,52 @@ void AudioSong::work() {
     }
   }
 
-  if (chunkReadStatus > 0) {
-    WaitSema(fillbufferSema);  // wait until previous chunk wasn't finished
-    audsrv_play_audio(chunk, chunkReadStatus);
+  stream.setLoop(inLoop);
+
+  if (slot && !stream.isCurrent(slot)) releaseSlot();
+
+  if (!slot) {
+    slot = stream.acquire();
+    slotOffset = 0;
+  }
+
+  unsigned int size = slot->size - slotOffset;
+  if (size > chunkSize) size = chunkSize;
+
+  if (size > 0) {
+    fillbufferSema.wait();  // wait until previous chunk wasn't finished
+    audsrv_play_audio(reinterpret_cast<char*>(slot->data + slotOffset), size);
+    stream.onPlayed(size);
+    slotOffset += size;
+
     for (unsigned int i = 0; i < getListenersCount(); i++)
       songListeners[i]->listener->onAudioTick();
   }
 
-  chunkReadStatus = fread(chunk, 1, chunkSize, wav);
+  if (slotOffset >= slot->size) onSlotFinished();
+}
+
+void AudioSong::onSlotFinished() {
+  const bool last = slot->last;
+  const bool wrapped = slot->wrapped;
+
+  releaseSlot();
+
+  if (!last) return;
+
+  // Reader already continues from the start, so loop is gapless
+  if (wrapped) {
+    for (unsigned int i = 0; i < getListenersCount(); i++)
+      songListeners[i]->listener->onAudioFinish();
+  } else {
+    songFinished = true;
+  }
+}
 
-  if (chunkReadStatus < (int)chunkSize) songFinished = true;
+void AudioSong::releaseSlot() {
+  stream.release();
+  slot = nullptr;
+  slotOffset = 0;
 }
 
 unsigned int AudioSong::addListener(AudioListener* t_listener) {
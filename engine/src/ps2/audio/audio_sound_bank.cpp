@@ -0,0 +1,72 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/audio_sound_bank.hpp"
+#include "audio/sound_bank_file.hpp"
+#include "utils/hash.hpp"
+#include "debug/debug.hpp"
+#include "memory/memory.hpp"
+#include <malloc.h>
+
+namespace Tyra {
+
+AudioSoundBank::AudioSoundBank() {}
+
+AudioSoundBank::~AudioSoundBank() { unload(); }
+
+void AudioSoundBank::load(AudioAdpcm* t_adpcm, const std::string& t_path) {
+  load(t_adpcm, t_path.c_str());
+}
+
+void AudioSoundBank::load(AudioAdpcm* t_adpcm, const char* t_path) {
+  FILE* file = fopen(t_path, "rb");
+  TYRA_ASSERT(file != nullptr, "Failed to open sound bank: ", t_path);
+
+  fseek(file, 0, SEEK_END);
+  unsigned int size = ftell(file);
+  rewind(file);
+
+  auto* data = static_cast<unsigned char*>(
+      Memory::allocate(size, MEMORY_CATEGORY_AUDIO, 64));
+  unsigned int readed = fread(data, sizeof(unsigned char), size, file);
+  fclose(file);
+
+  TYRA_ASSERT(readed == size && SoundBankFile::validate(data, size),
+              "Invalid sound bank: ", t_path);
+
+  const auto* entries = SoundBankFile::getEntries(data);
+  const unsigned int count = SoundBankFile::getCount(data);
+  samples.reserve(samples.size() + count);
+
+  for (unsigned int i = 0; i < count; i++) {
+    Sample sample;
+    sample.nameHash = entries[i].nameHash;
+    sample.adpcm = t_adpcm->load(data + entries[i].offset, entries[i].size);
+    samples.push_back(sample);
+  }
+
+  Memory::free(data);
+
+  TYRA_LOG("Sound bank loaded: ", t_path, " (", count, " samples)");
+}
+
+audsrv_adpcm_t* AudioSoundBank::get(const char* t_name) const {
+  const unsigned int hash = Hash::fnv1a(t_name);
+  for (const auto& sample : samples)
+    if (sample.nameHash == hash) return sample.adpcm;
+  return nullptr;
+}
+
+void AudioSoundBank::unload() {
+  for (auto& sample : samples) delete sample.adpcm;
+  samples.clear();
+}
+
+}  // namespace Tyra
@@ -0,0 +1,279 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/audio_stream.hpp"
+#include "debug/debug.hpp"
+#include "thread/threading.hpp"
+#include "audio/ima_adpcm.hpp"
+#include "memory/memory.hpp"
+#include <malloc.h>
+#include <cstring>
+
+extern void* _gp;
+
+void audioStreamThread(Tyra::AudioStream* stream) {
+  while (true) stream->readerWork();
+}
+
+namespace Tyra {
+
+const unsigned int AudioStream::threadStackSize = 8 * 1024;
+
+AudioStream::AudioStream() {
+  slots = nullptr;
+  compressed = nullptr;
+  compressedSize = 0;
+  file = nullptr;
+  requestedFile = nullptr;
+  memset(&info, 0, sizeof(WavInfo));
+  memset(&requestedInfo, 0, sizeof(WavInfo));
+  remaining = 0;
+  position = 0;
+  generation = 0;
+  loop = false;
+  endOfData = true;
+  threadId = -1;
+  threadStack = nullptr;
+  resetStats();
+}
+
+AudioStream::~AudioStream() {
+  if (threadId >= 0) {
+    TerminateThread(threadId);
+    DeleteThread(threadId);
+  }
+
+  if (threadStack) free(threadStack);
+
+  if (slots) {
+    for (unsigned int i = 0; i < options.slotsCount; i++) {
+      Memory::free(slots[i].data);
+    }
+    delete[] slots;
+  }
+
+  if (compressed) Memory::free(compressed);
+
+  if (file) fclose(file);
+}
+
+void AudioStream::init(const AudioStreamOptions& t_options) {
+  TYRA_ASSERT(t_options.slotsCount >= 2,
+              "Audio stream needs at least 2 slots!");
+  TYRA_ASSERT(t_options.readAlignment > 0 &&
+                  t_options.slotSize > t_options.readAlignment,
+              "Audio stream slot size must be bigger than read alignment!");
+
+  options = t_options;
+
+  slots = new AudioStreamSlot[options.slotsCount];
+  for (unsigned int i = 0; i < options.slotsCount; i++) {
+    slots[i].data = static_cast<unsigned char*>(
+        Memory::allocate(options.slotSize, MEMORY_CATEGORY_AUDIO, 64));
+  }
+  ring.init(slots, options.slotsCount, &stats);
+
+  // IMA ADPCM is 4x smaller than decoded PCM, so half of slot is plenty
+  compressedSize = options.slotSize / 2;
+  compressed = static_cast<unsigned char*>(
+      Memory::allocate(compressedSize, MEMORY_CATEGORY_AUDIO, 64));
+
+  requestEvent.init();
+  mutexSema.init(1, 1);
+
+  initThread();
+
+  TYRA_LOG("Audio stream initialized (", options.slotsCount, " x ",
+           options.slotSize / 1024, "KB)");
+}
+
+void AudioStream::initThread() {
+  threadStack = static_cast<unsigned char*>(memalign(16, threadStackSize));
+  thread.gp_reg = &_gp;
+  thread.func = reinterpret_cast<void*>(audioStreamThread);
+  thread.stack = threadStack;
+  thread.stack_size = threadStackSize;
+  thread.initial_priority = options.readerPriority;
+  thread.option = 0;
+  threadId = CreateThread(&thread);
+  TYRA_ASSERT(threadId >= 0, "Create audio stream thread failed!");
+  StartThread(threadId, this);
+}
+
+void AudioStream::open(FILE* t_file, const WavInfo& t_info) {
+  TYRA_ASSERT(t_file != nullptr, "Cant stream from null file!");
+  TYRA_ASSERT(t_info.blockAlign > 0, "Invalid WAV block align!");
+  TYRA_ASSERT(t_info.format != WAV_FORMAT_IMA_ADPCM ||
+                  t_info.samplesPerBlock * t_info.channels * 2u <=
+                      options.slotSize,
+              "IMA ADPCM block does not fit into audio stream slot!");
+
+  // Every fread() should go straight to the device, without
+  // additional copy into newlib's small FILE buffer.
+  setvbuf(t_file, nullptr, _IONBF, 0);
+
+  request(t_file, t_info);
+}
+
+void AudioStream::rewind() {
+  mutexSema.wait();
+  auto* reqFile = requestedFile;
+  auto reqInfo = requestedInfo;
+  mutexSema.signal();
+
+  request(reqFile, reqInfo);
+}
+
+void AudioStream::close() {
+  WavInfo empty;
+  memset(&empty, 0, sizeof(WavInfo));
+  request(nullptr, empty);
+}
+
+void AudioStream::request(FILE* t_file, const WavInfo& t_info) {
+  mutexSema.wait();
+
+  // Previous request was not picked up by the reader yet
+  if (requestedFile && requestedFile != t_file && requestedFile != file)
+    fclose(requestedFile);
+
+  requestedFile = t_file;
+  requestedInfo = t_info;
+  ring.nextGeneration();
+
+  mutexSema.signal();
+  requestEvent.set();
+}
+
+/** Called by reader thread only. */
+void AudioStream::applyRequest() {
+  mutexSema.wait();
+
+  if (generation == ring.getGeneration()) {
+    mutexSema.signal();
+    return;
+  }
+
+  if (file && file != requestedFile) fclose(file);
+
+  file = requestedFile;
+  info = requestedInfo;
+  generation = ring.getGeneration();
+
+  mutexSema.signal();
+
+  seekToStart();
+}
+
+void AudioStream::seekToStart() {
+  if (file) fseek(file, info.dataOffset, SEEK_SET);
+  position = info.dataOffset;
+  remaining = info.dataSize;
+  endOfData = file == nullptr || remaining <= 0;
+}
+
+void AudioStream::readerWork() {
+  auto* slot = ring.beginWrite();
+
+  applyRequest();
+  while (endOfData) {
+    requestEvent.wait();
+    applyRequest();
+  }
+
+  fillSlot(slot);
+}
+
+void AudioStream::fillSlot(AudioStreamSlot* slot) {
+  const long requested = info.format == WAV_FORMAT_IMA_ADPCM
+                             ? readImaAdpcm(slot)
+                             : readPcm(slot);
+
+  stats.reads++;
+  if (options.simulatedReadLatency > 0)
+    Threading::sleep(options.simulatedReadLatency);
+
+  const bool end = requested < 0 || remaining <= 0;
+  if (ring.endWrite(generation, end, loop)) {
+    seekToStart();
+  } else if (end) {
+    endOfData = true;
+  }
+}
+
+/**
+ * Read raw PCM directly into slot.
+ * First read after seek is shortened, so all next reads are aligned.
+ * @returns Bytes requested from device, -1 if device returned less.
+ */
+long AudioStream::readPcm(AudioStreamSlot* slot) {
+  long size = options.slotSize - (position % options.readAlignment);
+  size -= size % info.blockAlign;
+  if (size > remaining) size = remaining;
+
+  long bytes = fread(slot->data, 1, size, file);
+  if (bytes < 0) bytes = 0;
+
+  stats.bytesRead += bytes;
+  position += bytes;
+  remaining -= bytes;
+  slot->size = bytes;
+
+  return bytes < size ? -1 : size;
+}
+
+/**
+ * Read as many whole IMA ADPCM blocks as will fit into slot after
+ * decoding, and decode them into slot.
+ * @returns Bytes requested from device, -1 if device returned less.
+ */
+long AudioStream::readImaAdpcm(AudioStreamSlot* slot) {
+  const unsigned int decodedBlockSize =
+      info.samplesPerBlock * info.channels * sizeof(short);
+  unsigned int blocks = options.slotSize / decodedBlockSize;
+  if (blocks * info.blockAlign > compressedSize)
+    blocks = compressedSize / info.blockAlign;
+
+  long size = blocks * info.blockAlign;
+  if (size > remaining) size = remaining;
+
+  long bytes = fread(compressed, 1, size, file);
+  if (bytes < 0) bytes = 0;
+
+  stats.bytesRead += bytes;
+  position += bytes;
+  remaining -= bytes;
+
+  short* out = reinterpret_cast<short*>(slot->data);
+  unsigned int decoded = 0;
+  for (long offset = 0; offset < bytes; offset += info.blockAlign) {
+    long blockSize = bytes - offset;
+    if (blockSize > info.blockAlign) blockSize = info.blockAlign;
+
+    const unsigned int samples = ImaAdpcm::decodeBlock(
+        compressed + offset, blockSize, info.channels, out);
+    out += samples * info.channels;
+    decoded += samples * info.channels * sizeof(short);
+  }
+
+  slot->size = decoded;
+
+  return bytes < size ? -1 : size;
+}
+
+void AudioStream::resetStats() {
+  stats.underruns = 0;
+  stats.reads = 0;
+  stats.bytesRead = 0;
+  stats.bytesPlayed = 0;
+  stats.minFilledSlots = options.slotsCount;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,53 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/audio_voices.hpp"
+
+namespace Tyra {
+
+bool AudioVoicesBackend::play(const int& t_channel, void* t_sample) {
+  return audsrv_ch_play_adpcm(t_channel,
+                              static_cast<audsrv_adpcm_t*>(t_sample)) >= 0;
+}
+
+bool AudioVoicesBackend::isPlaying(const int& t_channel, void* t_sample) {
+  return audsrv_is_adpcm_playing(t_channel,
+                                 static_cast<audsrv_adpcm_t*>(t_sample)) > 0;
+}
+
+void AudioVoicesBackend::setVolume(const int& t_channel,
+                                   const unsigned char& t_volume) {
+  audsrv_adpcm_set_volume(t_channel, t_volume);
+}
+
+AudioVoices::AudioVoices() { listener = Vec4(0.0F, 0.0F, 0.0F, 1.0F); }
+
+AudioVoices::~AudioVoices() {}
+
+void AudioVoices::init() { init(0, VoiceManager::maxChannels); }
+
+void AudioVoices::init(const unsigned int& t_firstChannel,
+                       const unsigned int& t_count) {
+  manager.init(&backend, t_firstChannel, t_count);
+}
+
+VoiceResult AudioVoices::play(audsrv_adpcm_t* t_adpcm,
+                              const VoiceRequest& t_request) {
+  return manager.play(t_adpcm, t_request);
+}
+
+VoiceResult AudioVoices::play(audsrv_adpcm_t* t_adpcm, const Vec4& t_position,
+                              const VoiceRequest& t_request) {
+  VoiceRequest request = t_request;
+  request.distance = listener.distanceTo(t_position);
+  return manager.play(t_adpcm, request);
+}
+
+}  // namespace Tyra
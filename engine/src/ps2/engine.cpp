@@ -12,11 +12,11 @@
 
 namespace Tyra {
 
-Engine::Engine() { initAll(false); }
+Engine::Engine() { initAll(EngineOptions()); }
 
 Engine::Engine(const EngineOptions& options) {
   info.writeLogsToFile = options.writeLogsToFile;
-  initAll(options.loadUsbDriver);
+  initAll(options);
 }
 
 Engine::~Engine() {}
@@ -31,17 +31,40 @@ void Engine::run(Game* t_game) {
 
 void Engine::realLoop() {
   pad.update();
-  game->loop();
+  asyncLoader.update();
+
+  if (isFixedTimestep) {
+    fixedLoop();
+  } else {
+    game->loop();
+  }
+
   info.update();
 }
 
-void Engine::initAll(const bool& loadUsbDriver) {
+void Engine::fixedLoop() {
+  // Time of previous frame, so pace follows real display rate
+  timestep.advance(info.getFrameTime());
+  while (timestep.step()) game->update(timestep.getStep());
+  game->render(timestep.getAlpha());
+}
+
+void Engine::initAll(const EngineOptions& options) {
   srand(time(nullptr));
-  irx.loadAll(loadUsbDriver, info.writeLogsToFile);
-  renderer.init();
+  Memory::init();
+  Threading::init();
+  irx.loadAll(options.loadUsbDriver, info.writeLogsToFile);
+  renderer.init(options.renderer);
   banner.show(&renderer);
-  audio.init();
+  audio.init(options.songStream, options.audioVoices);
   pad.init();
+  asyncLoader.init(options.asyncLoader);
+  vu0Jobs.init();
+
+  isFixedTimestep = options.fixedTimestep;
+  timestep.init(options.fixedTimestepRate > 0.0F ? options.fixedTimestepRate
+                                                 : Timer::getRefreshRate(),
+                options.maxUpdatesPerFrame);
 }
 
 }  // namespace Tyra
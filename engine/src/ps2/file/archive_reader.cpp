@@ -0,0 +1,221 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "file/archive_reader.hpp"
+#include "utils/lz.hpp"
+#include "debug/debug.hpp"
+#include "memory/memory.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+const unsigned int ArchiveReader::preloadMaxGap = 64 * 1024;
+const unsigned int ArchiveReader::preloadMaxReadSize = 4 * 1024 * 1024;
+
+ArchiveData::ArchiveData() : data(nullptr), size(0) {}
+
+ArchiveData::ArchiveData(const unsigned int& t_size) : size(t_size) {
+  // Archive entries have no type, so they are counted as game data
+  data = static_cast<unsigned char*>(
+      Memory::allocate(size > 0 ? size : 64, MEMORY_CATEGORY_GAME, 64));
+  TYRA_ASSERT(data != nullptr, "Failed to allocate ", size, " bytes!");
+}
+
+ArchiveData::ArchiveData(ArchiveData&& other)
+    : data(other.data), size(other.size) {
+  other.data = nullptr;
+  other.size = 0;
+}
+
+ArchiveData& ArchiveData::operator=(ArchiveData&& other) {
+  if (this != &other) {
+    if (data) Memory::free(data);
+    data = other.data;
+    size = other.size;
+    other.data = nullptr;
+    other.size = 0;
+  }
+  return *this;
+}
+
+ArchiveData::~ArchiveData() {
+  if (data) Memory::free(data);
+}
+
+unsigned char* ArchiveData::release() {
+  auto* result = data;
+  data = nullptr;
+  size = 0;
+  return result;
+}
+
+ArchiveReader::ArchiveReader() {
+  file = nullptr;
+  fileSize = 0;
+  toc = nullptr;
+  stats.reads = 0;
+  stats.bytesRead = 0;
+}
+
+ArchiveReader::~ArchiveReader() { close(); }
+
+void ArchiveReader::open(const std::string& t_path) {
+  close();
+
+  path = t_path;
+  file = fopen(path.c_str(), "rb");
+  TYRA_ASSERT(file != nullptr, "Failed to open archive: ", path);
+
+  // Our reads are big and sector aligned, stdio buffer would only copy
+  setvbuf(file, nullptr, _IONBF, 0);
+
+  fseek(file, 0, SEEK_END);
+  fileSize = ftell(file);
+
+  auto* sector = static_cast<unsigned char*>(
+      Memory::allocate(ArchiveFile::sectorSize, MEMORY_CATEGORY_GAME, 64));
+  TYRA_ASSERT(sector != nullptr, "Failed to allocate archive header!");
+  readAt(0, sector, ArchiveFile::sectorSize);
+  TYRA_ASSERT(ArchiveFile::validateHeader(sector, ArchiveFile::sectorSize),
+              "Not a Tyra archive (or wrong version): ", path);
+
+  const unsigned int tocSize = ArchiveFile::getHeader(sector)->dataOffset;
+  TYRA_ASSERT(tocSize >= ArchiveFile::sectorSize && tocSize <= fileSize,
+              "Corrupted archive header: ", path);
+
+  toc = static_cast<unsigned char*>(
+      Memory::allocate(tocSize, MEMORY_CATEGORY_GAME, 64));
+  TYRA_ASSERT(toc != nullptr, "Failed to allocate archive TOC!");
+  memcpy(toc, sector, ArchiveFile::sectorSize);
+  Memory::free(sector);
+
+  if (tocSize > ArchiveFile::sectorSize)
+    readAt(ArchiveFile::sectorSize, toc + ArchiveFile::sectorSize,
+           tocSize - ArchiveFile::sectorSize);
+
+  TYRA_ASSERT(ArchiveFile::validate(toc, tocSize, fileSize),
+              "Corrupted archive TOC: ", path);
+
+  TYRA_LOG("Archive opened: ", path, " (",
+           ArchiveFile::getHeader(toc)->count, " entries)");
+}
+
+void ArchiveReader::close() {
+  releasePreloaded();
+
+  if (toc) {
+    Memory::free(toc);
+    toc = nullptr;
+  }
+
+  if (file) {
+    fclose(file);
+    file = nullptr;
+  }
+}
+
+const ArchiveEntry* ArchiveReader::find(const std::string& t_name) const {
+  TYRA_ASSERT(toc != nullptr, "Archive is not opened!");
+  return ArchiveFile::find(toc, ArchiveFile::getNameHash(t_name));
+}
+
+bool ArchiveReader::has(const std::string& t_name) const {
+  return find(t_name) != nullptr;
+}
+
+unsigned int ArchiveReader::getSize(const std::string& t_name) const {
+  const auto* entry = find(t_name);
+  TYRA_ASSERT(entry != nullptr, "Entry not found in archive: ", t_name);
+  return entry->unpackedSize;
+}
+
+ArchiveData ArchiveReader::read(const std::string& t_name) {
+  const auto* entry = find(t_name);
+  TYRA_ASSERT(entry != nullptr, "Entry not found in archive: ", t_name,
+              " (", path, ")");
+
+  // Nothing to read, and offset belongs to the next entry
+  if (entry->unpackedSize == 0) return ArchiveData();
+
+  auto it = preloaded.find(entry->nameHash);
+  if (it != preloaded.end()) {
+    const auto& span = spans[it->second];
+    return unpack(entry,
+                  span.data + (entry->offset - spanOffsets[it->second]),
+                  t_name);
+  }
+
+  if (entry->compression == ARCHIVE_COMPRESSION_NONE) {
+    ArchiveData result(entry->size);
+    readAt(entry->offset, result.data, entry->size);
+    return result;
+  }
+
+  ArchiveData stored(entry->size);
+  readAt(entry->offset, stored.data, entry->size);
+  return unpack(entry, stored.data, t_name);
+}
+
+ArchiveData ArchiveReader::unpack(const ArchiveEntry* entry,
+                                  const unsigned char* stored,
+                                  const std::string& name) {
+  ArchiveData result(entry->unpackedSize);
+
+  if (entry->compression == ARCHIVE_COMPRESSION_NONE) {
+    memcpy(result.data, stored, entry->size);
+  } else {
+    TYRA_ASSERT(Lz::decompress(stored, entry->size, result.data, result.size),
+                "Corrupted archive entry: ", name);
+  }
+
+  return result;
+}
+
+void ArchiveReader::preload(const std::vector<std::string>& t_names) {
+  std::vector<const ArchiveEntry*> entries;
+  for (const auto& name : t_names) {
+    const auto* entry = find(name);
+    TYRA_ASSERT(entry != nullptr, "Entry not found in archive: ", name);
+    if (entry->size > 0 && preloaded.find(entry->nameHash) == preloaded.end())
+      entries.push_back(entry);
+  }
+
+  auto plan =
+      ArchiveFile::planReads(entries, preloadMaxGap, preloadMaxReadSize);
+
+  for (const auto& span : plan) {
+    ArchiveData data(span.size);
+    readAt(span.offset, data.data, span.size);
+
+    for (const auto* entry : span.entries)
+      preloaded[entry->nameHash] = spans.size();
+
+    spanOffsets.push_back(span.offset);
+    spans.push_back(std::move(data));
+  }
+}
+
+void ArchiveReader::releasePreloaded() {
+  spans.clear();
+  spanOffsets.clear();
+  preloaded.clear();
+}
+
+void ArchiveReader::readAt(const unsigned int& offset, unsigned char* output,
+                           const unsigned int& size) {
+  fseek(file, offset, SEEK_SET);
+  auto readed = fread(output, sizeof(unsigned char), size, file);
+  TYRA_ASSERT(readed == size, "Failed to read ", size, " bytes from ", path);
+
+  stats.reads++;
+  stats.bytesRead += size;
+}
+
+}  // namespace Tyra
@@ -9,8 +9,7 @@
 */
 
 #include "info/info.hpp"
-#include "strings.h"
-#include <stdlib.h>
+#include "memory/memory.hpp"
 
 namespace Tyra {
 
@@ -19,89 +18,36 @@ bool Info::writeLogsToFile = false;
 Info::Info() {
   fps = 0;
   fpsDelayer = 0;
+  frameTime = 0.0F;
 }
 
 Info::~Info() {}
 
 void Info::update() {
+  const auto timeDelta = timer.getTimeDelta();
+  timer.prime();
+
+  frameTime = Timer::toSeconds(timeDelta);
+  frameStats.add(Timer::toMicroseconds(timeDelta));
+
   if (fpsDelayer++ >= 4) {
-    fps = calcFps();
+    fps = static_cast<unsigned int>(calcFps() + 0.5F);
     fpsDelayer = 0;
   }
-  timer.prime();
+
+  Memory::onFrameEnd();
 }
 
 float Info::calcFps() {
-  unsigned int timeDelta = timer.getTimeDelta();
+  const auto average = frameStats.getAverage();
 
-  if (timeDelta == 0) return -1.0F;
+  if (average == 0) return 0.0F;
 
-  return 15625.0F / (float)timeDelta;  // PAL
+  return 1000000.0F / average;
 }
 
 float Info::getAvailableRAM() {
-  size_t bits = getFreeRAMSize();
-  return bits / 1024.0F / 1024.0F;
-}
-
-void* Info::allocateLargestFreeRAMBlock(size_t* Size) {
-  size_t s0, s1;
-  void* p;
-
-  s0 = ~(size_t)0 ^ (~(size_t)0 >> 1);
-
-  while (s0 && (p = malloc(s0)) == nullptr) s0 >>= 1;
-
-  if (p) free(p);
-
-  s1 = s0 >> 1;
-
-  while (s1) {
-    if ((p = malloc(s0 + s1)) != nullptr) {
-      s0 += s1;
-      free(p);
-    }
-    s1 >>= 1;
-  }
-
-  while (s0 && (p = malloc(s0)) == nullptr) s0 ^= s0 & -s0;
-
-  *Size = s0;
-  return p;
-}
-
-size_t Info::getFreeRAMSize() {
-  size_t total = 0;
-  void* pFirst = nullptr;
-  void* pLast = nullptr;
-
-  for (;;) {
-    size_t largest;
-    void* p = allocateLargestFreeRAMBlock(&largest);
-
-    if (largest < sizeof(void*)) {
-      if (p != nullptr) free(p);
-      break;
-    }
-
-    *(void**)p = nullptr;
-
-    total += largest;
-
-    if (pFirst == nullptr) pFirst = p;
-
-    if (pLast != nullptr) *(void**)pLast = p;
-
-    pLast = p;
-  }
-
-  while (pFirst != nullptr) {
-    void* p = *(void**)pFirst;
-    free(pFirst);
-    pFirst = p;
-  }
-
-  return total;
+  return Memory::getFreeRAM() / 1024.0F / 1024.0F;
 }
 
 }  // Namespace Tyra
\ No newline at end of file
@@ -0,0 +1,126 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "loaders/3d/binary_mesh_loader/binary_mesh_loader.hpp"
+#include "mesh/binary_mesh_file.hpp"
+#include "debug/debug.hpp"
+#include "file/file_utils.hpp"
+#include "memory/memory.hpp"
+#include <malloc.h>
+#include <stdio.h>
+#include <cstring>
+
+namespace Tyra {
+
+static_assert(sizeof(Vec4) == 4 * sizeof(float), "Vec4 must be xyzw floats");
+static_assert(sizeof(Color) == 4 * sizeof(float), "Color must be rgba floats");
+
+std::unique_ptr<MeshBuilderData> BinaryMeshLoader::load(
+    const std::string& fullpath) {
+  return load(fullpath.c_str());
+}
+
+std::unique_ptr<MeshBuilderData> BinaryMeshLoader::load(const char* fullpath) {
+  std::string path = fullpath;
+  TYRA_ASSERT(!path.empty(), "Provided path is empty!");
+
+  auto filename = FileUtils::getFilenameFromPath(path);
+
+  FILE* file = fopen(fullpath, "rb");
+  TYRA_ASSERT(file != nullptr, "Failed to load: ", filename);
+  setvbuf(file, nullptr, _IONBF, 0);
+
+  fseek(file, 0, SEEK_END);
+  unsigned int size = ftell(file);
+  rewind(file);
+
+  auto* data = static_cast<unsigned char*>(
+      Memory::allocate(size, MEMORY_CATEGORY_MESHES, 64));
+  auto readed = fread(data, sizeof(unsigned char), size, file);
+  fclose(file);
+  TYRA_ASSERT(readed == size, "Failed to read: ", filename);
+
+  auto result = load(data, size, filename);
+  Memory::free(data);
+
+  return result;
+}
+
+std::unique_ptr<MeshBuilderData> BinaryMeshLoader::load(
+    ArchiveReader& archive, const std::string& name) {
+  auto file = archive.read(name);
+  return load(file.data, file.size, name);
+}
+
+std::unique_ptr<MeshBuilderData> BinaryMeshLoader::load(
+    const unsigned char* data, const unsigned int& size,
+    const std::string& name) {
+  TYRA_ASSERT(BinaryMeshFile::validate(data, size),
+              "This file is not a valid binary mesh (or wrong version): ",
+              name, ". Please cook it again with tools/meshcook");
+
+  const auto* header = BinaryMeshFile::getHeader(data);
+
+  auto result = std::make_unique<MeshBuilderData>();
+  result->loadNormals = header->flags & BINARY_MESH_FLAG_NORMALS;
+  result->loadLightmap = header->flags & BINARY_MESH_FLAG_LIGHTMAP;
+
+  for (unsigned int i = 0; i < header->materialsCount; i++) {
+    const auto* input = BinaryMeshFile::getMaterial(data, i);
+    auto* material = new MeshBuilderMaterialData();
+
+    material->name = BinaryMeshFile::getString(data, input->nameOffset);
+
+    const auto* texturePath =
+        BinaryMeshFile::getString(data, input->texturePathOffset);
+    if (texturePath) material->texturePath = texturePath;
+
+    material->ambient.set(input->ambient[0], input->ambient[1],
+                          input->ambient[2], input->ambient[3]);
+
+    for (unsigned int j = 0; j < header->framesCount; j++) {
+      const auto* inputFrame = BinaryMeshFile::getFrame(data, i, j);
+      auto* frame = new MeshBuilderMaterialFrameData();
+
+      frame->count = inputFrame->count;
+      frame->vertices = copyArray<Vec4>(
+          BinaryMeshFile::getArray(data, inputFrame, BINARY_MESH_VERTICES),
+          frame->count);
+      frame->textureCoords = copyArray<Vec4>(
+          BinaryMeshFile::getArray(data, inputFrame,
+                                   BINARY_MESH_TEXTURE_COORDS),
+          frame->count);
+      frame->normals = copyArray<Vec4>(
+          BinaryMeshFile::getArray(data, inputFrame, BINARY_MESH_NORMALS),
+          frame->count);
+      frame->colors = copyArray<Color>(
+          BinaryMeshFile::getArray(data, inputFrame, BINARY_MESH_COLORS),
+          frame->count);
+
+      material->frames.push_back(frame);
+    }
+
+    result->materials.push_back(material);
+  }
+
+  return result;
+}
+
+/** Mesh frees arrays by delete[], so they can't point into file data. */
+template <typename T>
+T* BinaryMeshLoader::copyArray(const float* source, const unsigned int& count) {
+  if (source == nullptr) return nullptr;
+
+  auto* result = new T[count];
+  memcpy(static_cast<void*>(result), source, count * sizeof(T));
+  return result;
+}
+
+}  // namespace Tyra
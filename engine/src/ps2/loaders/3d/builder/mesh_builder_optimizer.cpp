@@ -0,0 +1,132 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "loaders/3d/builder/mesh_builder_optimizer.hpp"
+#include "debug/debug.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+MeshOptimizerStats MeshBuilderOptimizer::optimize(MeshBuilderData* t_data) {
+  return optimize(t_data, MeshOptimizerOptions());
+}
+
+MeshOptimizerStats MeshBuilderOptimizer::optimize(
+    MeshBuilderData* t_data, const MeshOptimizerOptions& t_options) {
+  BinaryMeshSource source;
+  toSource(t_data, source);
+
+  auto stats = MeshOptimizer::optimize(source, t_options);
+
+  fromSource(source, t_data);
+
+  TYRA_LOG("Mesh optimized. Triangles: ", stats.trianglesBefore, " -> ",
+           stats.trianglesAfter, ", merged materials: ",
+           stats.materialsMerged, ", package spread: ",
+           stats.packageSpreadBefore, " -> ", stats.packageSpreadAfter);
+
+  return stats;
+}
+
+/** Moves data into source, builder arrays are freed. */
+void MeshBuilderOptimizer::toSource(MeshBuilderData* data,
+                                    BinaryMeshSource& output) {
+  output.loadNormals = data->loadNormals;
+  output.loadLightmap = data->loadLightmap;
+
+  auto copy = [](const float* input, const unsigned int& count,
+                 std::vector<float>& array) {
+    if (input) array.assign(input, input + count * 4);
+  };
+
+  for (auto* material : data->materials) {
+    BinaryMeshSourceMaterial outMaterial;
+    outMaterial.name = material->name;
+    outMaterial.texturePath = material->texturePath;
+    memcpy(outMaterial.ambient, material->ambient.rgba,
+           sizeof(outMaterial.ambient));
+
+    for (auto* frame : material->frames) {
+      BinaryMeshSourceFrame outFrame;
+      outFrame.count = frame->count;
+
+      copy(frame->vertices->xyzw, frame->count,
+           outFrame.arrays[BINARY_MESH_VERTICES]);
+      if (frame->textureCoords)
+        copy(frame->textureCoords->xyzw, frame->count,
+             outFrame.arrays[BINARY_MESH_TEXTURE_COORDS]);
+      if (frame->normals)
+        copy(frame->normals->xyzw, frame->count,
+             outFrame.arrays[BINARY_MESH_NORMALS]);
+      if (frame->colors)
+        copy(frame->colors->rgba, frame->count,
+             outFrame.arrays[BINARY_MESH_COLORS]);
+
+      delete[] frame->vertices;
+      if (frame->textureCoords) delete[] frame->textureCoords;
+      if (frame->normals) delete[] frame->normals;
+      if (frame->colors) delete[] frame->colors;
+      delete frame;
+
+      outMaterial.frames.push_back(std::move(outFrame));
+    }
+
+    material->frames.clear();
+    delete material;
+    output.materials.push_back(std::move(outMaterial));
+  }
+
+  data->materials.clear();
+}
+
+void MeshBuilderOptimizer::fromSource(const BinaryMeshSource& source,
+                                      MeshBuilderData* output) {
+  auto copy = [](const std::vector<float>& array, float* out) {
+    memcpy(out, array.data(), array.size() * sizeof(float));
+  };
+
+  for (const auto& material : source.materials) {
+    auto* outMaterial = new MeshBuilderMaterialData();
+    outMaterial->name = material.name;
+    outMaterial->texturePath = material.texturePath;
+    outMaterial->ambient.set(material.ambient[0], material.ambient[1],
+                             material.ambient[2], material.ambient[3]);
+
+    for (const auto& frame : material.frames) {
+      auto* outFrame = new MeshBuilderMaterialFrameData();
+      outFrame->count = frame.count;
+
+      outFrame->vertices = new Vec4[frame.count];
+      copy(frame.arrays[BINARY_MESH_VERTICES], outFrame->vertices->xyzw);
+
+      if (!frame.arrays[BINARY_MESH_TEXTURE_COORDS].empty()) {
+        outFrame->textureCoords = new Vec4[frame.count];
+        copy(frame.arrays[BINARY_MESH_TEXTURE_COORDS],
+             outFrame->textureCoords->xyzw);
+      }
+
+      if (!frame.arrays[BINARY_MESH_NORMALS].empty()) {
+        outFrame->normals = new Vec4[frame.count];
+        copy(frame.arrays[BINARY_MESH_NORMALS], outFrame->normals->xyzw);
+      }
+
+      if (!frame.arrays[BINARY_MESH_COLORS].empty()) {
+        outFrame->colors = new Color[frame.count];
+        copy(frame.arrays[BINARY_MESH_COLORS], outFrame->colors->rgba);
+      }
+
+      outMaterial->frames.push_back(outFrame);
+    }
+
+    output->materials.push_back(outMaterial);
+  }
+}
+
+}  // namespace Tyra
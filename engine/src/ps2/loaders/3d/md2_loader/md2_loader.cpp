@@ -10,10 +10,12 @@
 
 #include "loaders/3d/md2_loader/md2_loader.hpp"
 #include <stdio.h>
+#include <cstring>
 #include <string>
 #include "debug/debug.hpp"
 #include "loaders/3d/md2_loader/anorms.hpp"
 #include "file/file_utils.hpp"
+#include "utils/mmi_kernels.hpp"
 
 namespace Tyra {
 
@@ -92,9 +94,41 @@ std::unique_ptr<MeshBuilderData> MD2Loader::load(const char* fullpath,
 
   FILE* file = fopen(fullpath, "rb");
   TYRA_ASSERT(file != nullptr, "Failed to load: ", filename);
+
+  // Single read instead of seeking for every section
+  fseek(file, 0, SEEK_END);
+  unsigned int size = ftell(file);
+  rewind(file);
+
+  auto* data = new unsigned char[size];
+  auto readed = fread(data, sizeof(unsigned char), size, file);
+  fclose(file);
+  TYRA_ASSERT(readed == size, "Failed to read: ", filename);
+
+  auto result = load(data, size, filename, options);
+  delete[] data;
+
+  return result;
+}
+
+std::unique_ptr<MeshBuilderData> MD2Loader::load(ArchiveReader& archive,
+                                                 const std::string& name,
+                                                 MD2LoaderOptions options) {
+  auto file = archive.read(name);
+  return load(file.data, file.size, FileUtils::getFilenameFromPath(name),
+              options);
+}
+
+std::unique_ptr<MeshBuilderData> MD2Loader::load(const unsigned char* data,
+                                                 const unsigned int& size,
+                                                 const std::string& name,
+                                                 MD2LoaderOptions options) {
+  auto filename = FileUtils::getFilenameFromPath(name);
+
+  TYRA_ASSERT(size >= sizeof(md2_t), "MD2 data is too small: ", filename);
   md2_t header;
 
-  fread(reinterpret_cast<char*>(&header), sizeof(md2_t), 1, file);
+  memcpy(&header, data, sizeof(md2_t));
 
   TYRA_ASSERT((header.ident == MD2_IDENT) && (header.version == MD2_VERSION),
               "This MD2 file is not in correct format!");
@@ -105,19 +139,23 @@ std::unique_ptr<MeshBuilderData> MD2Loader::load(const char* fullpath,
   unsigned int trianglesCount = header.num_tris;
 
   auto framesBufferSize = framesCount * header.framesize;
-  auto framesBuffer = new char[framesBufferSize];
-  fseek(file, header.ofs_frames, SEEK_SET);
-  fread(framesBuffer, framesBufferSize, 1, file);
+  auto stsBufferSize = stsCount * sizeof(texCoord_t);
+  auto trianglesBufferSize = trianglesCount * sizeof(triangle_t);
 
-  auto stsBuffer = new char[stsCount * sizeof(texCoord_t)];
-  fseek(file, header.ofs_st, SEEK_SET);
-  fread(stsBuffer, stsCount * sizeof(texCoord_t), 1, file);
+  TYRA_ASSERT(header.ofs_frames + framesBufferSize <= size &&
+                  header.ofs_st + stsBufferSize <= size &&
+                  header.ofs_tris + trianglesBufferSize <= size,
+              "MD2 data is truncated: ", filename);
 
-  auto trianglesBuffer = new char[trianglesCount * sizeof(triangle_t)];
-  fseek(file, header.ofs_tris, SEEK_SET);
-  fread(trianglesBuffer, trianglesCount * sizeof(triangle_t), 1, file);
+  // Copied, because MD2 sections do not have to be aligned
+  auto framesBuffer = new char[framesBufferSize];
+  memcpy(framesBuffer, data + header.ofs_frames, framesBufferSize);
 
-  fclose(file);
+  auto stsBuffer = new char[stsBufferSize];
+  memcpy(stsBuffer, data + header.ofs_st, stsBufferSize);
+
+  auto trianglesBuffer = new char[trianglesBufferSize];
+  memcpy(trianglesBuffer, data + header.ofs_tris, trianglesBufferSize);
 
   auto result = std::make_unique<MeshBuilderData>();
 
@@ -145,24 +183,27 @@ std::unique_ptr<MeshBuilderData> MD2Loader::load(const char* fullpath,
 
   Vec4 temp(0.0F, 0.0F, 0.0F, 1.0F);
 
+  alignas(16) float vertexScale[4];
+  alignas(16) float vertexOffset[4];
+
   for (unsigned int frameIndex = 0; frameIndex < framesCount; frameIndex++) {
     auto* frame = reinterpret_cast<frame_t*>(
         &framesBuffer[header.framesize * frameIndex]);
 
+    // x,y,z,normalIndex bytes -> (v * scale + translate) * options.scale, 1
+    for (unsigned int i = 0; i < 3; i++) {
+      vertexScale[i] = frame->scale[i] * options.scale;
+      vertexOffset[i] = frame->translate[i] * options.scale;
+    }
+    vertexScale[3] = 0.0F;
+    vertexOffset[3] = 1.0F;
+
+    MmiKernels::bytesToFloats(tempVertices[frameIndex][0].xyzw,
+                              frame->verts[0].v, vertexCount, vertexScale,
+                              vertexOffset);
+
     for (unsigned int vertexIndex = 0; vertexIndex < vertexCount;
          vertexIndex++) {
-      temp.set(((frame->verts[vertexIndex].v[0] * frame->scale[0]) +
-                frame->translate[0]) *
-                   options.scale,
-               ((frame->verts[vertexIndex].v[1] * frame->scale[1]) +
-                frame->translate[1]) *
-                   options.scale,
-               ((frame->verts[vertexIndex].v[2] * frame->scale[2]) +
-                frame->translate[2]) *
-                   options.scale);
-
-      tempVertices[frameIndex][vertexIndex].set(temp);
-
       temp.set(ANORMS[frame->verts[vertexIndex].lightnormalindex][0],
                ANORMS[frame->verts[vertexIndex].lightnormalindex][1],
                ANORMS[frame->verts[vertexIndex].lightnormalindex][2]);
@@ -44,59 +44,138 @@ std::unique_ptr<MeshBuilderData> ObjLoader::load(
 
   TYRA_ASSERT(!path.empty(), "Provided path is empty!");
 
-  auto rawFilename = FileUtils::getFilenameWithoutExtension(path);
-  auto extension = FileUtils::getExtensionOfFilename(path);
   auto result = std::make_unique<MeshBuilderData>();
 
+  auto readerConfig = getReaderConfig(options);
+  readerConfig.mtl_search_path = basePath;
+
+  for (auto i = 1; i <= options.animation.count; i++) {
+    auto filePath = getFramePath(path, i, options.animation.count);
+
+    tinyobj::ObjReader reader;
+    auto parsed = reader.ParseFromFile(filePath, readerConfig);
+
+    processFrame(result.get(), reader, parsed, i, options);
+  }
+
+  if (options.optimize) MeshBuilderOptimizer::optimize(result.get());
+
+  return result;
+}
+
+std::unique_ptr<MeshBuilderData> ObjLoader::load(
+    ArchiveReader& archive, const std::string& name,
+    const ObjLoaderOptions& options) {
+  TYRA_ASSERT(!name.empty(), "Provided name is empty!");
+
+  auto slash = name.find_last_of("/\\");
+  auto directory = slash == std::string::npos ? "" : name.substr(0, slash + 1);
+
+  auto result = std::make_unique<MeshBuilderData>();
+  auto readerConfig = getReaderConfig(options);
+  std::string mtlText;
+
+  for (auto i = 1; i <= options.animation.count; i++) {
+    auto file = archive.read(getFramePath(name, i, options.animation.count));
+    std::string objText(reinterpret_cast<const char*>(file.data), file.size);
+
+    // All frames share one mtl file
+    if (i == 1) {
+      auto mtlName = getMtlLibName(objText);
+      TYRA_ASSERT(!mtlName.empty(), "No mtllib found in: ", name);
+
+      auto mtl = archive.read(directory + mtlName);
+      mtlText.assign(reinterpret_cast<const char*>(mtl.data), mtl.size);
+    }
+
+    tinyobj::ObjReader reader;
+    auto parsed = reader.ParseFromString(objText, mtlText, readerConfig);
+
+    processFrame(result.get(), reader, parsed, i, options);
+  }
+
+  if (options.optimize) MeshBuilderOptimizer::optimize(result.get());
+
+  return result;
+}
+
+tinyobj::ObjReaderConfig ObjLoader::getReaderConfig(
+    const ObjLoaderOptions& options) {
   tinyobj::ObjReaderConfig readerConfig;
   readerConfig.triangulate = options.animation.count == 1;
   readerConfig.triangulation_method =
       options.animation.count == 1 ? "earcut" : "simple";
-  readerConfig.mtl_search_path = basePath;
+  return readerConfig;
+}
 
-  for (auto i = 1; i <= options.animation.count; i++) {
-    int indexStringLength = std::to_string(i).length();
-    auto numbersWithLeadingZeros =
-        std::string(6 - std::min(6, indexStringLength), '0') +
-        std::to_string(i);
+std::string ObjLoader::getFramePath(const std::string& path,
+                                    const unsigned short& index,
+                                    const unsigned short& count) {
+  if (count == 1) return path;
 
-    std::string filePath =
-        rawFilename + "_" + numbersWithLeadingZeros + "." + extension;
-    if (options.animation.count == 1) filePath = path;
+  auto rawFilename = FileUtils::getFilenameWithoutExtension(path);
+  auto extension = FileUtils::getExtensionOfFilename(path);
 
-    tinyobj::ObjReader reader;
+  int indexStringLength = std::to_string(index).length();
+  auto numbersWithLeadingZeros =
+      std::string(6 - std::min(6, indexStringLength), '0') +
+      std::to_string(index);
 
-    if (!reader.ParseFromFile(filePath, readerConfig)) {
-      if (!reader.Error().empty()) {
-        TYRA_TRAP("TinyObjLoader: ", reader.Error());
-      }
-      TYRA_TRAP("Unknown TinyObjLoader error!");
-    }
+  return rawFilename + "_" + numbersWithLeadingZeros + "." + extension;
+}
 
-    if (!reader.Warning().empty()) {
-      TYRA_WARN("TinyObjReader: ", reader.Warning());
+std::string ObjLoader::getMtlLibName(const std::string& objText) {
+  size_t lineStart = 0;
+  while (lineStart < objText.size()) {
+    auto lineEnd = objText.find('\n', lineStart);
+    if (lineEnd == std::string::npos) lineEnd = objText.size();
+
+    if (objText.compare(lineStart, 7, "mtllib ") == 0) {
+      auto result = objText.substr(lineStart + 7, lineEnd - lineStart - 7);
+      while (!result.empty() &&
+             (result.back() == '\r' || result.back() == ' '))
+        result.pop_back();
+      return result;
     }
 
-    auto& attrib = reader.GetAttrib();
-    auto& shapes = reader.GetShapes();
-    auto& materials = reader.GetMaterials();
+    lineStart = lineEnd + 1;
+  }
 
-    TYRA_ASSERT(
-        materials.size() > 0,
-        "No material data found! Please add .mtl file(s) and assign them via "
-        "mtlib in obj file");
+  return "";
+}
 
-    if (i == 1) {
-      auto scanResult = scan(shapes, materials);
-      addOutputMaterialsAndFrames(result.get(), attrib, shapes, materials,
-                                  options.animation.count, scanResult);
+void ObjLoader::processFrame(MeshBuilderData* output,
+                             const tinyobj::ObjReader& reader,
+                             const bool& parsed, const unsigned short& index,
+                             const ObjLoaderOptions& options) {
+  if (!parsed) {
+    if (!reader.Error().empty()) {
+      TYRA_TRAP("TinyObjLoader: ", reader.Error());
     }
+    TYRA_TRAP("Unknown TinyObjLoader error!");
+  }
 
-    importFrame(result.get(), attrib, shapes, materials, i - 1, options.scale,
-                options.flipUVs, options.animation.count);
+  if (!reader.Warning().empty()) {
+    TYRA_WARN("TinyObjReader: ", reader.Warning());
   }
 
-  return result;
+  auto& attrib = reader.GetAttrib();
+  auto& shapes = reader.GetShapes();
+  auto& materials = reader.GetMaterials();
+
+  TYRA_ASSERT(
+      materials.size() > 0,
+      "No material data found! Please add .mtl file(s) and assign them via "
+      "mtlib in obj file");
+
+  if (index == 1) {
+    auto scanResult = scan(shapes, materials);
+    addOutputMaterialsAndFrames(output, attrib, shapes, materials,
+                                options.animation.count, scanResult);
+  }
+
+  importFrame(output, attrib, shapes, materials, index - 1, options.scale,
+              options.flipUVs, options.animation.count);
 }
 
 std::vector<MaterialVertexCount> ObjLoader::scan(
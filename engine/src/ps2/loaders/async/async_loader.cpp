@@ -0,0 +1,298 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "loaders/async/async_loader.hpp"
+#include "debug/debug.hpp"
+#include "memory/memory.hpp"
+#include "thread/threading.hpp"
+#include <malloc.h>
+#include <cstdio>
+
+extern void* _gp;
+
+void asyncLoaderThread(Tyra::AsyncLoader* loader) {
+  while (true) loader->loaderWork();
+}
+
+namespace Tyra {
+
+AsyncLoader::AsyncLoader() {
+  lastId = 0;
+  pendingCount = 0;
+  inFlightMemory = 0;
+  threadId = -1;
+  threadStack = nullptr;
+}
+
+AsyncLoader::~AsyncLoader() {
+  if (threadId >= 0) {
+    TerminateThread(threadId);
+    DeleteThread(threadId);
+  }
+  if (threadStack) free(threadStack);
+}
+
+void AsyncLoader::init() { init(AsyncLoaderOptions()); }
+
+void AsyncLoader::init(const AsyncLoaderOptions& t_options) {
+  options = t_options;
+
+  mutex.init(1, 1);
+  queuedSema.init(0, 0x7FFFFFFF);
+  memoryReleasedEvent.init();
+
+  initThread();
+
+  TYRA_LOG("Async loader initialized!");
+}
+
+void AsyncLoader::initThread() {
+  threadStack = static_cast<unsigned char*>(
+      memalign(16, options.threadStackSize));
+  TYRA_ASSERT(threadStack != nullptr, "Failed to allocate loader stack!");
+
+  thread.gp_reg = &_gp;
+  thread.func = reinterpret_cast<void*>(asyncLoaderThread);
+  thread.stack = threadStack;
+  thread.stack_size = options.threadStackSize;
+  thread.initial_priority = options.threadPriority;
+  threadId = CreateThread(&thread);
+  TYRA_ASSERT(threadId >= 0, "Create async loader thread failed!");
+  StartThread(threadId, this);
+}
+
+AsyncLoaderHandle AsyncLoader::add(
+    std::function<void()> t_work, std::function<void()> t_finalize,
+    const int& t_priority, std::function<unsigned int()> t_estimateMemory) {
+  TYRA_ASSERT(threadId >= 0, "Async loader is not initialized!");
+
+  auto job = std::make_shared<AsyncLoaderJob>();
+  job->priority = t_priority;
+  job->work = t_work;
+  job->finalize = t_finalize;
+  job->estimateMemory = t_estimateMemory;
+  job->memoryCost = 0;
+  job->state = ASYNC_JOB_QUEUED;
+
+  mutex.wait();
+  job->id = ++lastId;
+  queue.push_back(job);
+  pendingCount++;
+  mutex.signal();
+
+  queuedSema.signal();
+
+  return job;
+}
+
+bool AsyncLoader::cancel(const AsyncLoaderHandle& t_job) {
+  bool result = false;
+
+  mutex.wait();
+  for (auto it = queue.begin(); it != queue.end(); it++) {
+    if (*it == t_job) {
+      t_job->state = ASYNC_JOB_CANCELLED;
+      queue.erase(it);
+      pendingCount--;
+      result = true;
+      break;
+    }
+  }
+  mutex.signal();
+
+  // load<T>() finalize holds result, which holds the job, so this cycle
+  // has to be broken here, as it is in update() for finished jobs.
+  // Copy, because t_job can be owned by that result.
+  if (result) {
+    AsyncLoaderHandle job = t_job;
+    releaseClosures(job);
+  }
+
+  // Semaphore count stays, loader thread will skip empty queue once.
+  return result;
+}
+
+void AsyncLoader::update() {
+  // Loader thread is below main thread, so it works only when main thread
+  // blocks. Without frame limit (no VSync wait) it would never run.
+  if (pendingCount > 0 && isLoaderStarved()) Threading::switchThread();
+
+  std::vector<AsyncLoaderHandle> toFinalize;
+
+  mutex.wait();
+  auto count = loaded.size() < options.maxFinalizationsPerUpdate
+                   ? loaded.size()
+                   : options.maxFinalizationsPerUpdate;
+  toFinalize.assign(loaded.begin(), loaded.begin() + count);
+  loaded.erase(loaded.begin(), loaded.begin() + count);
+  mutex.signal();
+
+  if (toFinalize.empty()) return;
+
+  for (auto& job : toFinalize) {
+    if (job->finalize) job->finalize();
+    job->state = ASYNC_JOB_DONE;
+
+    mutex.wait();
+    inFlightMemory -= job->memoryCost;
+    pendingCount--;
+    mutex.signal();
+
+    // Release closures (and data captured by them) now, not with handle
+    releaseClosures(job);
+  }
+
+  memoryReleasedEvent.set();
+}
+
+void AsyncLoader::loaderWork() {
+  queuedSema.wait();
+
+  mutex.wait();
+  auto job = popMostImportant();
+  if (job) job->state = ASYNC_JOB_LOADING;
+  mutex.signal();
+
+  if (!job) return;  // Cancelled
+
+  if (job->estimateMemory) job->memoryCost = job->estimateMemory();
+
+  memoryReleasedEvent.waitUntil(
+      [this, &job]() { return fitsIntoBudget(job->memoryCost); });
+
+  mutex.wait();
+  inFlightMemory += job->memoryCost;
+  mutex.signal();
+
+  job->work();
+
+  mutex.wait();
+  job->state = ASYNC_JOB_LOADED;
+  loaded.push_back(job);
+  mutex.signal();
+}
+
+void AsyncLoader::releaseClosures(const AsyncLoaderHandle& t_job) {
+  t_job->work = nullptr;
+  t_job->finalize = nullptr;
+  t_job->estimateMemory = nullptr;
+}
+
+AsyncLoaderHandle AsyncLoader::popMostImportant() {
+  if (queue.empty()) return nullptr;
+
+  // Queue is short, linear scan keeps FIFO order for equal priorities
+  auto best = queue.begin();
+  for (auto it = queue.begin() + 1; it != queue.end(); it++)
+    if ((*it)->priority > (*best)->priority) best = it;
+
+  auto result = *best;
+  queue.erase(best);
+  return result;
+}
+
+bool AsyncLoader::isLoaderStarved() const {
+  // Ready = has work to do, but CPU is taken by higher priority thread
+  ee_thread_status_t status;
+  if (ReferThreadStatus(threadId, &status) < 0) return false;
+  return status.status == THS_READY;
+}
+
+bool AsyncLoader::fitsIntoBudget(const unsigned int& cost) const {
+  return inFlightMemory == 0 || inFlightMemory + cost <= options.memoryBudget;
+}
+
+std::shared_ptr<AsyncLoaderResult<MeshBuilderData>> AsyncLoader::loadObj(
+    const std::string& t_path, const ObjLoaderOptions& t_options,
+    const int& t_priority) {
+  return load<MeshBuilderData>(
+      [t_path, t_options]() { return ObjLoader::load(t_path, t_options); },
+      nullptr, t_priority,
+      // Text is bigger than parsed data, but tinyobj keeps both at once
+      [t_path]() { return getFileSize(t_path) * 2; });
+}
+
+std::shared_ptr<AsyncLoaderResult<MeshBuilderData>> AsyncLoader::loadMd2(
+    const std::string& t_path, const MD2LoaderOptions& t_options,
+    const int& t_priority) {
+  return load<MeshBuilderData>(
+      [t_path, t_options]() { return MD2Loader::load(t_path, t_options); },
+      nullptr, t_priority,
+      // Compressed frames are unpacked into floats
+      [t_path]() { return getFileSize(t_path) * 4; });
+}
+
+AsyncLoaderHandle AsyncLoader::loadTexture(
+    const std::string& t_path, TextureRepository* t_repository,
+    std::function<void(Texture*)> t_onLoaded, const int& t_priority) {
+  auto data = std::make_shared<TextureBuilderData*>(nullptr);
+
+  return add(
+      [this, t_path, data]() {
+        *data = textureLoaderSelector.getLoaderByFileName(t_path).load(t_path);
+      },
+      [t_repository, t_onLoaded, data]() {
+        auto* texture = new Texture(*data);
+        delete *data;
+        *data = nullptr;
+        t_repository->add(texture);
+        if (t_onLoaded) t_onLoaded(texture);
+      },
+      t_priority,
+      // PNG is compressed, so decoded pixels are a few times bigger
+      [t_path]() { return getFileSize(t_path) * 4; });
+}
+
+AsyncLoaderHandle AsyncLoader::loadAdpcm(
+    const std::string& t_path, AudioAdpcm* t_adpcm,
+    std::function<void(audsrv_adpcm_t*)> t_onLoaded, const int& t_priority) {
+  struct FileData {
+    unsigned char* data = nullptr;
+    unsigned int size = 0;
+  };
+  auto file = std::make_shared<FileData>();
+
+  return add(
+      [t_path, file]() {
+        FILE* handle = fopen(t_path.c_str(), "rb");
+        TYRA_ASSERT(handle != nullptr, "Failed to open adpcm file: ", t_path);
+
+        fseek(handle, 0, SEEK_END);
+        file->size = ftell(handle);
+        rewind(handle);
+
+        file->data = static_cast<unsigned char*>(
+            Memory::allocate(file->size, MEMORY_CATEGORY_AUDIO, 64));
+        TYRA_ASSERT(file->data != nullptr, "Failed to allocate ", file->size,
+                    " bytes for adpcm file: ", t_path);
+        fread(file->data, sizeof(unsigned char), file->size, handle);
+        fclose(handle);
+      },
+      [t_adpcm, t_onLoaded, file]() {
+        auto* sample = t_adpcm->load(file->data, file->size);
+        Memory::free(file->data);
+        file->data = nullptr;
+        if (t_onLoaded) t_onLoaded(sample);
+      },
+      t_priority, [t_path]() { return getFileSize(t_path); });
+}
+
+unsigned int AsyncLoader::getFileSize(const std::string& path) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (file == nullptr) return 0;
+
+  fseek(file, 0, SEEK_END);
+  unsigned int result = ftell(file);
+  fclose(file);
+
+  return result;
+}
+
+}  // namespace Tyra
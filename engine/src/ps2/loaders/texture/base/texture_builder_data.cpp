@@ -25,6 +25,8 @@ TextureBuilderData::TextureBuilderData() {
   clutHeight = 0;
   clutBpp = bpp32;
   clutGsComponents = TEXTURE_COMPONENTS_RGBA;
+
+  isMemoryTracked = false;
 }
 
 TextureBuilderData::~TextureBuilderData() {}
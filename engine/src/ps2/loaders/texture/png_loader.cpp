@@ -17,6 +17,8 @@
 #include <draw_buffers.h>
 #include "loaders/texture/png_loader.hpp"
 #include "file/file_utils.hpp"
+#include "utils/mmi_kernels.hpp"
+#include "memory/memory.hpp"
 
 namespace Tyra {
 
@@ -28,6 +30,22 @@ struct PngClut {
   unsigned char r, g, b, a;
 };
 
+struct PngMemoryReader {
+  const unsigned char* data;
+  unsigned int size;
+  unsigned int offset;
+};
+
+static void readPngFromMemory(png_structp pngPtr, png_bytep output,
+                              png_size_t length) {
+  auto* reader = static_cast<PngMemoryReader*>(png_get_io_ptr(pngPtr));
+  if (length > reader->size - reader->offset)
+    png_error(pngPtr, "Read beyond the end of data");
+
+  memcpy(output, reader->data + reader->offset, length);
+  reader->offset += length;
+}
+
 /** Based on GsKit texture loading - thank you guys! */
 TextureBuilderData* PngLoader::load(const char* fullPath) {
   std::string path = fullPath;
@@ -40,11 +58,8 @@ TextureBuilderData* PngLoader::load(const char* fullPath) {
 
   png_structp pngPtr;
   png_infop infoPtr;
-  png_uint_32 width, height;
-  png_bytep* rowPointers = nullptr;
 
   unsigned int sigRead = 0;
-  int bitDepth, colorType, interlaceType;
 
   pngPtr = png_create_read_struct(PNG_LIBPNG_VER_STRING, (png_voidp) nullptr,
                                   nullptr, nullptr);
@@ -57,6 +72,52 @@ TextureBuilderData* PngLoader::load(const char* fullPath) {
 
   png_init_io(pngPtr, file);
   png_set_sig_bytes(pngPtr, sigRead);
+
+  auto* result = read(pngPtr, infoPtr, filename);
+
+  png_destroy_read_struct(&pngPtr, &infoPtr, nullptr);
+  fclose(file);
+
+  return result;
+}
+
+TextureBuilderData* PngLoader::load(const unsigned char* data,
+                                    const unsigned int& size,
+                                    const std::string& name) {
+  auto filename = FileUtils::getFilenameFromPath(name);
+
+  TYRA_ASSERT(png_sig_cmp(data, 0, size < 8 ? size : 8) == 0,
+              "Not a PNG data: ", filename);
+
+  PngMemoryReader reader = {data, size, 0};
+
+  png_structp pngPtr;
+  png_infop infoPtr;
+
+  pngPtr = png_create_read_struct(PNG_LIBPNG_VER_STRING, (png_voidp) nullptr,
+                                  nullptr, nullptr);
+  TYRA_ASSERT(pngPtr, "PNG read struct init failed for: ", filename);
+
+  infoPtr = png_create_info_struct(pngPtr);
+  TYRA_ASSERT(infoPtr, "PNG read struct init failed for: ", filename);
+
+  TYRA_ASSERT(!setjmp(png_jmpbuf(pngPtr)), "PNG read error for: ", filename);
+
+  png_set_read_fn(pngPtr, &reader, readPngFromMemory);
+
+  auto* result = read(pngPtr, infoPtr, filename);
+
+  png_destroy_read_struct(&pngPtr, &infoPtr, nullptr);
+
+  return result;
+}
+
+TextureBuilderData* PngLoader::read(png_structp pngPtr, png_infop infoPtr,
+                                    const std::string& filename) {
+  png_uint_32 width, height;
+  png_bytep* rowPointers = nullptr;
+  int bitDepth, colorType, interlaceType;
+
   png_read_info(pngPtr, infoPtr);
   png_get_IHDR(pngPtr, infoPtr, &width, &height, &bitDepth, &colorType,
                &interlaceType, nullptr, nullptr);
@@ -72,6 +133,7 @@ TextureBuilderData* PngLoader::load(const char* fullPath) {
   result->width = width;
   result->height = height;
   result->name = filename;
+  result->isMemoryTracked = true;
 
   auto updatedColorType = png_get_color_type(pngPtr, infoPtr);
 
@@ -85,8 +147,6 @@ TextureBuilderData* PngLoader::load(const char* fullPath) {
     TYRA_TRAP("This texture depth is not supported!");
 
   png_read_end(pngPtr, nullptr);
-  png_destroy_read_struct(&pngPtr, &infoPtr, nullptr);
-  fclose(file);
 
   return result;
 }
@@ -97,32 +157,14 @@ void PngLoader::handle32bpp(TextureBuilderData* result, png_structp pngPtr,
 
   result->gsComponents = TEXTURE_COMPONENTS_RGBA;
   result->bpp = bpp32;
-  result->data = static_cast<unsigned char*>(memalign(
-      128, getTextureSize(result->width, result->height, result->bpp)));
+  result->data = static_cast<unsigned char*>(Memory::allocate(
+      getTextureSize(result->width, result->height, result->bpp),
+      MEMORY_CATEGORY_TEXTURES, 128));
 
-  rowPointers =
-      static_cast<png_bytep*>(calloc(result->height, sizeof(png_bytep)));
-
-  for (int row = 0; row < result->height; row++)
-    rowPointers[row] = static_cast<png_bytep>(malloc(rowBytes));
-
-  png_read_image(pngPtr, rowPointers);
-
-  struct PngPixel4* pixels = (struct PngPixel4*)result->data;
-
-  int k = 0;
-  for (int i = 0; i < result->height; i++) {
-    for (int j = 0; j < result->width; j++) {
-      pixels[k].r = rowPointers[i][4 * j];
-      pixels[k].g = rowPointers[i][4 * j + 1];
-      pixels[k].b = rowPointers[i][4 * j + 2];
-      pixels[k++].a = ((int)rowPointers[i][4 * j + 3] * 128 / 255);
-    }
-  }
-
-  for (int row = 0; row < result->height; row++) free(rowPointers[row]);
+  readImage(pngPtr, result->data, result->height, rowBytes,
+            result->width * 4);
 
-  free(rowPointers);
+  MmiKernels::halveAlpha(result->data, result->width * result->height);
 }
 
 void PngLoader::handle24bpp(TextureBuilderData* result, png_structp pngPtr,
@@ -131,26 +173,22 @@ void PngLoader::handle24bpp(TextureBuilderData* result, png_structp pngPtr,
 
   result->gsComponents = TEXTURE_COMPONENTS_RGB;
   result->bpp = bpp24;
-  result->data = static_cast<unsigned char*>(memalign(
-      128, getTextureSize(result->width, result->height, result->bpp)));
+  result->data = static_cast<unsigned char*>(Memory::allocate(
+      getTextureSize(result->width, result->height, result->bpp),
+      MEMORY_CATEGORY_TEXTURES, 128));
 
   rowPointers =
       static_cast<png_bytep*>(calloc(result->height, sizeof(png_bytep)));
 
   for (int row = 0; row < result->height; row++)
-    rowPointers[row] = static_cast<png_bytep>(malloc(rowBytes));
+    rowPointers[row] = static_cast<png_bytep>(memalign(16, rowBytes));
 
   png_read_image(pngPtr, rowPointers);
 
-  struct PngPixel3* pixels = (struct PngPixel3*)result->data;
-
-  int k = 0;
-  for (int i = 0; i < result->height; i++) {
-    for (int j = 0; j < result->width; j++) {
-      pixels[k].r = rowPointers[i][4 * j];
-      pixels[k].g = rowPointers[i][4 * j + 1];
-      pixels[k++].b = rowPointers[i][4 * j + 2];
-    }
+  // Filler is added by libpng, so rows are RGBX
+  for (int row = 0; row < result->height; row++) {
+    MmiKernels::rgbxToRgb(result->data + row * result->width * 3,
+                          rowPointers[row], result->width);
   }
 
   for (int row = 0; row < result->height; row++) free(rowPointers[row]);
@@ -193,56 +231,26 @@ void PngLoader::handle8bppPalletized(TextureBuilderData* result,
   result->clutHeight = 16;
 
   result->gsComponents = TEXTURE_COMPONENTS_RGBA;
-  result->data = static_cast<unsigned char*>(memalign(
-      128, getTextureSize(result->width, result->height, result->bpp)));
+  result->data = static_cast<unsigned char*>(Memory::allocate(
+      getTextureSize(result->width, result->height, result->bpp),
+      MEMORY_CATEGORY_TEXTURES, 128));
 
-  rowPointers =
-      static_cast<png_bytep*>(calloc(result->height, sizeof(png_bytep)));
+  readImage(pngPtr, result->data, result->height, rowBytes, result->width);
 
-  for (int row = 0; row < result->height; row++)
-    rowPointers[row] = static_cast<png_bytep>(malloc(rowBytes));
+  result->clut = static_cast<unsigned char*>(Memory::allocate(
+      getTextureSize(16, 16, bpp32), MEMORY_CATEGORY_TEXTURES, 128));
+  MmiKernels::fill128(result->clut, 0, getTextureSize(16, 16, bpp32) / 16);
 
-  png_read_image(pngPtr, rowPointers);
-
-  result->clut =
-      static_cast<unsigned char*>(memalign(128, getTextureSize(16, 16, bpp32)));
-  memset(result->clut, 0, getTextureSize(16, 16, bpp32));
-
-  auto* pixel = static_cast<unsigned char*>(result->data);
   struct PngClut* clut = (struct PngClut*)result->clut;
 
-  for (int i = numPallete; i < 256; i++) {
-    memset(&clut[i], 0, sizeof(clut[i]));
-  }
-
-  for (int i = 0; i < numPallete; i++) {
-    clut[i].r = palette[i].red;
-    clut[i].g = palette[i].green;
-    clut[i].b = palette[i].blue;
-    clut[i].a = 0x80;
-  }
+  MmiKernels::rgbToRgba(result->clut,
+                        reinterpret_cast<unsigned char*>(palette), numPallete,
+                        0x80);
 
   for (int i = 0; i < numTrans; i++) clut[i].a = trans[i] >> 1;
 
-  // rotate clut
-  for (int i = 0; i < numPallete; i++) {
-    if ((i & 0x18) == 8) {
-      struct PngClut tmp = clut[i];
-      clut[i] = clut[i + 8];
-      clut[i + 8] = tmp;
-    }
-  }
-
-  int k = 0;
-  for (int i = 0; i < result->height; i++) {
-    for (int j = 0; j < result->width; j++) {
-      memcpy(&pixel[k++], &rowPointers[i][1 * j], 1);
-    }
-  }
-
-  for (int row = 0; row < result->height; row++) free(rowPointers[row]);
-
-  free(rowPointers);
+  MmiKernels::swizzleClutCsm1(reinterpret_cast<unsigned int*>(result->clut),
+                              256);
 }
 
 void PngLoader::handle4bppPalletized(TextureBuilderData* result,
@@ -255,52 +263,61 @@ void PngLoader::handle4bppPalletized(TextureBuilderData* result,
   result->clutWidth = 8;
   result->clutHeight = 2;
   result->gsComponents = TEXTURE_COMPONENTS_RGBA;
-  result->data = static_cast<unsigned char*>(memalign(
-      128, getTextureSize(result->width, result->height, result->bpp)));
+  result->data = static_cast<unsigned char*>(Memory::allocate(
+      getTextureSize(result->width, result->height, result->bpp),
+      MEMORY_CATEGORY_TEXTURES, 128));
 
-  rowPointers =
-      static_cast<png_bytep*>(calloc(result->height, sizeof(png_bytep)));
+  readImage(pngPtr, result->data, result->height, rowBytes,
+            result->width / 2);
 
-  for (int row = 0; row < result->height; row++)
-    rowPointers[row] = static_cast<png_bytep>(malloc(rowBytes));
+  result->clut = static_cast<unsigned char*>(Memory::allocate(
+      getTextureSize(8, 2, bpp32), MEMORY_CATEGORY_TEXTURES, 128));
+  MmiKernels::fill128(result->clut, 0, getTextureSize(8, 2, bpp32) / 16);
 
-  png_read_image(pngPtr, rowPointers);
+  struct PngClut* clut = (struct PngClut*)result->clut;
 
-  result->clut =
-      static_cast<unsigned char*>(memalign(128, getTextureSize(8, 2, bpp32)));
-  memset(result->clut, 0, getTextureSize(8, 2, bpp32));
+  MmiKernels::rgbToRgba(result->clut,
+                        reinterpret_cast<unsigned char*>(palette), numPallete,
+                        0x80);
 
-  auto* pixel = static_cast<unsigned char*>(result->data);
-  struct PngClut* clut = (struct PngClut*)result->clut;
+  for (int i = 0; i < numTrans; i++) clut[i].a = trans[i] >> 1;
 
-  for (int i = numPallete; i < 16; i++) {
-    memset(&clut[i], 0, sizeof(clut[i]));
-  }
+  MmiKernels::swapNibbles(
+      result->data,
+      getTextureSize(result->width, result->height, result->bpp));
+}
 
-  for (int i = 0; i < numPallete; i++) {
-    clut[i].r = palette[i].red;
-    clut[i].g = palette[i].green;
-    clut[i].b = palette[i].blue;
-    clut[i].a = 0x80;
-  }
+void PngLoader::readImage(png_structp pngPtr, unsigned char* data,
+                          const int& height, const int& rowBytes,
+                          const int& stride) {
+  auto* rowPointers =
+      static_cast<png_bytep*>(calloc(height, sizeof(png_bytep)));
 
-  for (int i = 0; i < numTrans; i++) clut[i].a = trans[i] >> 1;
+  if (rowBytes == stride) {
+    // Rows are decoded straight into texture data
+    for (int row = 0; row < height; row++)
+      rowPointers[row] = data + row * stride;
 
-  int k = 0;
-  for (int i = 0; i < result->height; i++) {
-    for (int j = 0; j < result->width / 2; j++)
-      memcpy(&pixel[k++], &rowPointers[i][1 * j], 1);
+    png_read_image(pngPtr, rowPointers);
+    free(rowPointers);
+    return;
   }
-  unsigned char* tmpdst = (unsigned char*)result->data;
-  unsigned char* tmpsrc = (unsigned char*)pixel;
 
-  for (unsigned int byte = 0;
-       byte < getTextureSize(result->width, result->height, result->bpp);
-       byte++)
-    tmpdst[byte] = (tmpsrc[byte] << 4) | (tmpsrc[byte] >> 4);
+  TYRA_WARN("Unexpected PNG row size: ", rowBytes, ", expected: ", stride,
+            ". Row ends are cut");
 
-  for (int row = 0; row < result->height; row++) free(rowPointers[row]);
+  // Whole image, because interlaced passes are merged into these rows
+  auto* rows = static_cast<unsigned char*>(memalign(16, height * rowBytes));
+  for (int row = 0; row < height; row++)
+    rowPointers[row] = rows + row * rowBytes;
+
+  png_read_image(pngPtr, rowPointers);
+
+  const int copySize = rowBytes < stride ? rowBytes : stride;
+  for (int row = 0; row < height; row++)
+    memcpy(data + row * stride, rowPointers[row], copySize);
 
+  free(rows);
   free(rowPointers);
 }
 
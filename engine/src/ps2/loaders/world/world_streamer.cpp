@@ -0,0 +1,309 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "loaders/world/world_streamer.hpp"
+#include "loaders/3d/binary_mesh_loader/binary_mesh_loader.hpp"
+#include "file/file_utils.hpp"
+#include "debug/debug.hpp"
+#include <malloc.h>
+#include <stdio.h>
+
+namespace Tyra {
+
+WorldStreamer::WorldStreamer() {
+  layout = nullptr;
+  loader = nullptr;
+  repository = nullptr;
+  frame = 0;
+  latencySum = 0;
+  loadedCount = 0;
+  stats = WorldStreamerStats();
+}
+
+WorldStreamer::~WorldStreamer() { free(); }
+
+void WorldStreamer::init(const std::string& t_layoutPath,
+                         AsyncLoader* t_loader,
+                         TextureRepository* t_repository) {
+  init(t_layoutPath, t_loader, t_repository, WorldStreamingOptions());
+}
+
+void WorldStreamer::init(const std::string& t_layoutPath,
+                         AsyncLoader* t_loader,
+                         TextureRepository* t_repository,
+                         const WorldStreamingOptions& t_options) {
+  TYRA_ASSERT(layout == nullptr, "World streamer is already initialized");
+  TYRA_ASSERT(t_options.evictRadius >= t_options.prefetchRadius &&
+                  t_options.prefetchRadius >= t_options.loadRadius,
+              "Radiuses must be: load <= prefetch <= evict");
+
+  FILE* file = fopen(t_layoutPath.c_str(), "rb");
+  TYRA_ASSERT(file != nullptr, "Failed to open world layout: ", t_layoutPath);
+
+  fseek(file, 0, SEEK_END);
+  unsigned int size = ftell(file);
+  rewind(file);
+
+  layout = static_cast<unsigned char*>(memalign(64, size));
+  auto readed = fread(layout, sizeof(unsigned char), size, file);
+  fclose(file);
+
+  TYRA_ASSERT(readed == size && WorldLayoutFile::validate(layout, size),
+              "Invalid world layout: ", t_layoutPath);
+
+  directory = FileUtils::getPathFromFilename(t_layoutPath);
+  loader = t_loader;
+  repository = t_repository;
+  options = t_options;
+  alive = std::make_shared<bool>(true);
+
+  const auto* header = WorldLayoutFile::getHeader(layout);
+  states.assign(header->cellsCount, WORLD_CELL_UNLOADED);
+  cells.assign(header->cellsCount, {nullptr, nullptr, 0, 0, {}});
+  textures.assign(header->texturesCount, {nullptr, 0, nullptr});
+
+  TYRA_LOG("World layout loaded. Cells: ", header->cellsCount,
+           ", textures: ", header->texturesCount);
+}
+
+unsigned int WorldStreamer::getCellsCount() const {
+  return static_cast<unsigned int>(states.size());
+}
+
+void WorldStreamer::update(const Vec4& t_cameraPosition) {
+  TYRA_ASSERT(layout != nullptr, "World streamer is not initialized");
+
+  frame++;
+
+  auto plan = WorldStreamingPlanner::plan(
+      layout, states, t_cameraPosition.x, t_cameraPosition.z, options);
+
+  for (const auto& index : plan.evictions) evict(index);
+
+  // Plan is sorted, first = most important
+  int priority = plan.loads.size();
+  for (const auto& index : plan.loads) load(index, priority--);
+
+  stats.overBudget = plan.overBudget;
+  stats.loadingCells = 0;
+  for (const auto& state : states)
+    if (state == WORLD_CELL_LOADING) stats.loadingCells++;
+  stats.residentCells = meshes.size();
+  WorldStreamingPlanner::getUsage(layout, states, &stats.ramUsed,
+                                  &stats.vramUsed);
+}
+
+void WorldStreamer::load(const unsigned int& index, const int& priority) {
+  const auto* layoutCell = WorldLayoutFile::getCell(layout, index);
+  auto& cell = cells[index];
+
+  states[index] = WORLD_CELL_LOADING;
+  cell.requestFrame = frame;
+  stats.loadsCount++;
+
+  for (unsigned int i = 0; i < layoutCell->texturesCount; i++)
+    acquireTexture(WorldLayoutFile::getCellTexture(layout, layoutCell, i),
+                   priority);
+
+  auto path =
+      directory + WorldLayoutFile::getString(layout, layoutCell->meshPathOffset);
+  auto ramSize = layoutCell->ramSize;
+  auto token = alive;
+  auto generation = cell.generation;
+
+  cell.job = loader->load<MeshBuilderData>(
+      [path]() { return BinaryMeshLoader::load(path); },
+      [this, index, token,
+       generation](AsyncLoaderResult<MeshBuilderData>& result) {
+        if (!*token || cells[index].generation != generation) {
+          // Mesh takes ownership of arrays, so it frees them
+          StaticMesh orphan(result.value.get());
+          return;
+        }
+
+        cells[index].mesh = new StaticMesh(result.value.get());
+        cells[index].job = nullptr;
+        tryToFinish(index);
+      },
+      priority, [ramSize]() { return ramSize; });
+}
+
+void WorldStreamer::evict(const unsigned int& index) {
+  const auto* layoutCell = WorldLayoutFile::getCell(layout, index);
+  auto& cell = cells[index];
+
+  TYRA_ASSERT(states[index] == WORLD_CELL_RESIDENT,
+              "Only resident cells can be evicted");
+
+  for (auto& link : cell.links) link.first->removeLinkById(link.second);
+  cell.links.clear();
+
+  for (unsigned int i = 0; i < meshes.size(); i++) {
+    if (meshes[i] == cell.mesh) {
+      meshes.erase(meshes.begin() + i);
+      break;
+    }
+  }
+
+  delete cell.mesh;
+  cell.mesh = nullptr;
+
+  for (unsigned int i = 0; i < layoutCell->texturesCount; i++)
+    releaseTexture(WorldLayoutFile::getCellTexture(layout, layoutCell, i));
+
+  states[index] = WORLD_CELL_UNLOADED;
+  stats.evictionsCount++;
+}
+
+void WorldStreamer::acquireTexture(const unsigned int& index,
+                                   const int& priority) {
+  auto& slot = textures[index];
+  if (slot.refs++ > 0 || slot.texture || slot.job) return;
+
+  auto name = WorldLayoutFile::getString(
+      layout, WorldLayoutFile::getTexture(layout, index)->nameOffset);
+  auto token = alive;
+
+  slot.job = loader->loadTexture(
+      directory + name, repository,
+      [this, index, token](Texture* texture) {
+        if (!*token) return;  // Repository owns it anyway
+        onTextureLoaded(index, texture);
+      },
+      priority);
+}
+
+void WorldStreamer::releaseTexture(const unsigned int& index) {
+  auto& slot = textures[index];
+  TYRA_ASSERT(slot.refs > 0, "Texture is not acquired");
+
+  if (--slot.refs > 0) return;
+
+  if (slot.texture) {
+    repository->free(slot.texture);
+    slot.texture = nullptr;
+  } else if (slot.job && loader->cancel(slot.job)) {
+    slot.job = nullptr;
+  }
+  // Otherwise texture is being loaded, will be freed in onTextureLoaded()
+}
+
+void WorldStreamer::onTextureLoaded(const unsigned int& index,
+                                    Texture* texture) {
+  auto& slot = textures[index];
+  slot.job = nullptr;
+
+  if (slot.refs == 0) {
+    repository->free(texture);
+    return;
+  }
+
+  slot.texture = texture;
+
+  for (unsigned int i = 0; i < states.size(); i++)
+    if (states[i] == WORLD_CELL_LOADING) tryToFinish(i);
+}
+
+void WorldStreamer::tryToFinish(const unsigned int& index) {
+  const auto* layoutCell = WorldLayoutFile::getCell(layout, index);
+  auto& cell = cells[index];
+
+  if (!cell.mesh) return;
+
+  for (unsigned int i = 0; i < layoutCell->texturesCount; i++) {
+    auto texture = WorldLayoutFile::getCellTexture(layout, layoutCell, i);
+    if (!textures[texture].texture) return;
+  }
+
+  linkTextures(index);
+
+  states[index] = WORLD_CELL_RESIDENT;
+  meshes.push_back(cell.mesh);
+
+  auto latency = frame - cell.requestFrame;
+  latencySum += latency;
+  loadedCount++;
+  stats.lastLatency = latency;
+  if (latency > stats.maxLatency) stats.maxLatency = latency;
+  stats.averageLatency = static_cast<float>(latencySum) / loadedCount;
+}
+
+void WorldStreamer::linkTextures(const unsigned int& index) {
+  const auto* layoutCell = WorldLayoutFile::getCell(layout, index);
+  auto& cell = cells[index];
+
+  for (auto* material : cell.mesh->materials) {
+    if (!material->textureName.has_value()) continue;
+
+    for (unsigned int i = 0; i < layoutCell->texturesCount; i++) {
+      auto texture = WorldLayoutFile::getCellTexture(layout, layoutCell, i);
+      std::string name = WorldLayoutFile::getString(
+          layout, WorldLayoutFile::getTexture(layout, texture)->nameOffset);
+
+      if (FileUtils::getFilenameWithoutExtension(name) ==
+          material->textureName.value()) {
+        textures[texture].texture->addLink(material->id);
+        cell.links.push_back({textures[texture].texture, material->id});
+        break;
+      }
+    }
+  }
+}
+
+void WorldStreamer::unloadAll() {
+  for (unsigned int i = 0; i < states.size(); i++) {
+    if (states[i] == WORLD_CELL_RESIDENT) {
+      evict(i);
+    } else if (states[i] == WORLD_CELL_LOADING) {
+      auto& cell = cells[i];
+
+      // Started load can't be cancelled, so its mesh is dropped when
+      // finalized, instead of making cell resident
+      if (cell.job) loader->cancel(cell.job->job);
+      cell.job = nullptr;
+      cell.generation++;
+
+      // Mesh loaded, but textures not yet
+      if (cell.mesh) {
+        delete cell.mesh;
+        cell.mesh = nullptr;
+      }
+
+      const auto* layoutCell = WorldLayoutFile::getCell(layout, i);
+      for (unsigned int j = 0; j < layoutCell->texturesCount; j++)
+        releaseTexture(WorldLayoutFile::getCellTexture(layout, layoutCell, j));
+
+      states[i] = WORLD_CELL_UNLOADED;
+    }
+  }
+
+  stats.residentCells = 0;
+}
+
+void WorldStreamer::free() {
+  if (!layout) return;
+
+  unloadAll();
+  *alive = false;
+
+  // Meshes still in flight are freed by their jobs
+  for (auto& slot : textures)
+    if (slot.texture) repository->free(slot.texture);
+
+  cells.clear();
+  textures.clear();
+  states.clear();
+  meshes.clear();
+
+  ::free(layout);
+  layout = nullptr;
+}
+
+}  // namespace Tyra
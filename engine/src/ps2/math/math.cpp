@@ -13,6 +13,7 @@
 #endif
 
 #include "math/math.hpp"
+#include "math/trig_kernels.hpp"
 #include <stdlib.h>
 
 extern volatile const unsigned int TYRA_MATH_ATAN_TABLE[9] alignas(
@@ -93,6 +94,10 @@ float Math::cos(float x) {
   return r;
 }
 
+void Math::sinCos(const float& x, float* o_sin, float* o_cos) {
+  TrigKernels::sinCos(x, o_sin, o_cos);
+}
+
 float Math::invSqrt(const float& x) { return 1.0F / sqrt(x); }
 
 float Math::atan2(float y, float x) {
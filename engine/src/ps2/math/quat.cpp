@@ -0,0 +1,138 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/quat.hpp"
+#include "math/quat_math.hpp"
+#include <iomanip>
+#include <sstream>
+#include <cmath>
+
+namespace Tyra {
+
+const Quat Quat::Identity = Quat(0.0F, 0.0F, 0.0F, 1.0F);
+
+Quat::Quat(const M4x4& matrix) { QuatMath::fromMatrix(xyzw, matrix.data); }
+
+Quat Quat::fromAxisAngle(const Vec4& axis, const float& radians) {
+  Quat result;
+  QuatMath::fromAxisAngle(result.xyzw, axis.xyzw, radians);
+  return result;
+}
+
+Quat Quat::lookRotation(const Vec4& forward, const Vec4& up) {
+  Quat result;
+  QuatMath::lookRotation(result.xyzw, forward.xyzw, up.xyzw);
+  return result;
+}
+
+Quat Quat::operator*(const Quat& v) const {
+  Quat res;
+  // xyz = a.w * b.xyz + b.w * a.xyz + a.xyz x b.xyz
+  // w = a.w * b.w - a.xyz . b.xyz
+  asm volatile(
+      "lqc2         $vf4, 0x00(%1)          \n\t"
+      "lqc2         $vf5, 0x00(%2)          \n\t"
+      "vopmula.xyz  $ACC, $vf4, $vf5        \n\t"
+      "vopmsub.xyz  $vf6, $vf5, $vf4        \n\t"
+      "vmulaw.xyz   $ACC, $vf5, $vf4w       \n\t"
+      "vmaddaw.xyz  $ACC, $vf4, $vf5w       \n\t"
+      "vmaddw.xyz   $vf7, $vf6, $vf0w       \n\t"
+      "vmul.xyz     $vf8, $vf4, $vf5        \n\t"
+      "vaddy.x      $vf8, $vf8, $vf8y       \n\t"
+      "vaddz.x      $vf8, $vf8, $vf8z       \n\t"
+      "vmulw.w      $vf9, $vf4, $vf5w       \n\t"
+      "vsubx.w      $vf7, $vf9, $vf8x       \n\t"
+      "sqc2         $vf7, 0x00(%0)          \n\t"
+      :
+      : "r"(res.xyzw), "r"(this->xyzw), "r"(v.xyzw)
+      : "memory");
+  return res;
+}
+
+void Quat::operator*=(const Quat& v) { set(*this * v); }
+
+Vec4 Quat::operator*(const Vec4& v) const {
+  Vec4 result;
+  QuatMath::rotate(result.xyzw, xyzw, v.xyzw);
+  return result;
+}
+
+void Quat::set(const Quat& v) {
+  asm volatile(
+      "lqc2   $vf1, 0x00(%1)  \n\t"
+      "sqc2   $vf1, 0x00(%0)  \n\t"
+      :
+      : "r"(this->xyzw), "r"(v.xyzw)
+      : "memory");
+}
+
+void Quat::set(const float& t_x, const float& t_y, const float& t_z,
+               const float& t_w) {
+  x = t_x;
+  y = t_y;
+  z = t_z;
+  w = t_w;
+}
+
+Quat Quat::conjugate() const { return Quat(-x, -y, -z, w); }
+
+float Quat::dot(const Quat& v) const { return QuatMath::dot(xyzw, v.xyzw); }
+
+float Quat::length() const { return sqrtf(dot(*this)); }
+
+void Quat::normalize() { QuatMath::normalize(xyzw); }
+
+Quat Quat::getNormalized() const {
+  Quat result(*this);
+  result.normalize();
+  return result;
+}
+
+M4x4 Quat::toM4x4() const {
+  M4x4 result;
+  QuatMath::toMatrix(result.data, xyzw);
+  return result;
+}
+
+Quat Quat::nlerp(const Quat& from, const Quat& to, const float& interp) {
+  Quat result;
+  QuatMath::nlerp(result.xyzw, from.xyzw, to.xyzw, interp);
+  return result;
+}
+
+Quat Quat::slerp(const Quat& from, const Quat& to, const float& interp) {
+  Quat result;
+  QuatMath::slerp(result.xyzw, from.xyzw, to.xyzw, interp);
+  return result;
+}
+
+void Quat::print() const {
+  auto text = getPrint(nullptr);
+  printf("%s\n", text.c_str());
+}
+
+void Quat::print(const char* name) const {
+  auto text = getPrint(name);
+  printf("%s\n", text.c_str());
+}
+
+std::string Quat::getPrint(const char* name) const {
+  std::stringstream res;
+  if (name) {
+    res << name << "(";
+  } else {
+    res << "Quat(";
+  }
+  res << std::fixed << std::setprecision(4);
+  res << x << ", " << y << ", " << z << ", " << w << ")";
+  return res.str();
+}
+
+}  // namespace Tyra
@@ -0,0 +1,74 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/transform_hierarchy.hpp"
+#include "debug/debug.hpp"
+#include <algorithm>
+
+namespace Tyra {
+
+TransformHierarchy::TransformHierarchy() {
+  isOrderDirty = false;
+  lastUpdatedCount = 0;
+}
+
+TransformHierarchy::~TransformHierarchy() { clear(); }
+
+void TransformHierarchy::add(TransformNode* t_node) {
+  TYRA_ASSERT(t_node->hierarchy == nullptr,
+              "Transform node is already in hierarchy");
+
+  t_node->hierarchy = this;
+  nodes.push_back(t_node);
+  isOrderDirty = true;
+}
+
+void TransformHierarchy::remove(TransformNode* t_node) {
+  if (t_node->hierarchy != this) return;
+
+  t_node->hierarchy = nullptr;
+  nodes.erase(std::remove(nodes.begin(), nodes.end(), t_node), nodes.end());
+}
+
+void TransformHierarchy::clear() {
+  for (auto* node : nodes) node->hierarchy = nullptr;
+  nodes.clear();
+}
+
+void TransformHierarchy::update() {
+  if (isOrderDirty) sort();
+
+  lastUpdatedCount = 0;
+  for (auto* node : nodes) {
+    if (!node->isWorldMatrixDirty) continue;
+
+    // Parent is earlier in list, so it is already up to date
+    node->updateWorld();
+    lastUpdatedCount++;
+  }
+}
+
+void TransformHierarchy::sort() {
+  std::vector<std::pair<unsigned int, TransformNode*>> sorted;
+  sorted.reserve(nodes.size());
+  for (auto* node : nodes) sorted.push_back({node->getDepth(), node});
+
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const std::pair<unsigned int, TransformNode*>& a,
+                      const std::pair<unsigned int, TransformNode*>& b) {
+                     return a.first < b.first;
+                   });
+
+  for (unsigned int i = 0; i < sorted.size(); i++) nodes[i] = sorted[i].second;
+
+  isOrderDirty = false;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,158 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/transform_node.hpp"
+#include "math/transform_hierarchy.hpp"
+#include "math/quat_math.hpp"
+#include "debug/debug.hpp"
+#include <algorithm>
+
+namespace Tyra {
+
+TransformNode::TransformNode() {
+  parent = nullptr;
+  hierarchy = nullptr;
+  position = Vec4(0.0F, 0.0F, 0.0F, 1.0F);
+  scale = Vec4(1.0F, 1.0F, 1.0F, 1.0F);
+  rotation = M4x4::Identity;
+  localMatrix = M4x4::Identity;
+  worldMatrix = M4x4::Identity;
+  isLocalMatrixDirty = false;
+  isWorldMatrixDirty = false;
+  worldVersion = 0;
+}
+
+TransformNode::~TransformNode() {
+  if (hierarchy) hierarchy->remove(this);
+
+  setParent(nullptr);
+
+  while (!children.empty()) children.back()->setParent(nullptr);
+}
+
+void TransformNode::setParent(TransformNode* t_parent) {
+  if (parent == t_parent) return;
+
+  for (auto* node = t_parent; node != nullptr; node = node->parent) {
+    TYRA_ASSERT(node != this, "Transform node can't be its own ancestor");
+  }
+
+  if (parent) {
+    auto& siblings = parent->children;
+    siblings.erase(std::remove(siblings.begin(), siblings.end(), this),
+                   siblings.end());
+  }
+
+  parent = t_parent;
+  if (parent) parent->children.push_back(this);
+
+  // Depth of whole subtree was changed
+  std::vector<TransformNode*> stack = {this};
+  while (!stack.empty()) {
+    auto* node = stack.back();
+    stack.pop_back();
+    if (node->hierarchy) node->hierarchy->isOrderDirty = true;
+    stack.insert(stack.end(), node->children.begin(), node->children.end());
+  }
+
+  markWorldDirty();
+}
+
+void TransformNode::setPosition(const Vec4& t_position) {
+  position.set(t_position);
+  onLocalChanged();
+}
+
+void TransformNode::setRotation(const M4x4& t_rotation) {
+  rotation = t_rotation;
+  onLocalChanged();
+}
+
+void TransformNode::setRotation(const Quat& t_rotation) {
+  QuatMath::toMatrix(rotation.data, t_rotation.xyzw);
+  onLocalChanged();
+}
+
+void TransformNode::setScale(const Vec4& t_scale) {
+  scale.set(t_scale);
+  onLocalChanged();
+}
+
+void TransformNode::setScale(const float& t_scale) {
+  scale = Vec4(t_scale, t_scale, t_scale, 1.0F);
+  onLocalChanged();
+}
+
+const M4x4& TransformNode::getLocalMatrix() const {
+  if (!isLocalMatrixDirty) return localMatrix;
+
+  // T * R * S without full multiplies - rotation columns scaled,
+  // position in last column. Rotation has no translation.
+  for (unsigned int column = 0; column < 3; column++) {
+    for (unsigned int row = 0; row < 4; row++) {
+      localMatrix.data[column * 4 + row] =
+          rotation.data[column * 4 + row] * scale.xyzw[column];
+    }
+  }
+
+  localMatrix.data[12] = position.x;
+  localMatrix.data[13] = position.y;
+  localMatrix.data[14] = position.z;
+  localMatrix.data[15] = 1.0F;
+
+  isLocalMatrixDirty = false;
+  return localMatrix;
+}
+
+const M4x4& TransformNode::getWorldMatrix() const {
+  if (isWorldMatrixDirty) updateWorld();
+  return worldMatrix;
+}
+
+Vec4 TransformNode::getWorldPosition() const {
+  const auto& world = getWorldMatrix();
+  return Vec4(world.data[12], world.data[13], world.data[14], 1.0F);
+}
+
+Vec4 TransformNode::toWorld(const Vec4& t_local) const {
+  return getWorldMatrix() * t_local;
+}
+
+unsigned int TransformNode::getDepth() const {
+  unsigned int result = 0;
+  for (auto* node = parent; node != nullptr; node = node->parent) result++;
+  return result;
+}
+
+void TransformNode::onLocalChanged() {
+  isLocalMatrixDirty = true;
+  markWorldDirty();
+}
+
+void TransformNode::markWorldDirty() {
+  // Descendants of dirty node are always dirty too
+  if (isWorldMatrixDirty) return;
+
+  isWorldMatrixDirty = true;
+  for (auto* child : children) child->markWorldDirty();
+}
+
+void TransformNode::updateWorld() const {
+  if (parent) {
+    worldMatrix = parent->getWorldMatrix() * getLocalMatrix();
+  } else {
+    worldMatrix = getLocalMatrix();
+  }
+
+  isWorldMatrixDirty = false;
+  worldVersion++;
+}
+
+}  // namespace Tyra
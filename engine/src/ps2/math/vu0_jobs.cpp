@@ -0,0 +1,321 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/vu0_jobs.hpp"
+#include "math/vu0_kernels_defines.h"
+#include "packet2/packet2_memory.hpp"
+#include "debug/debug.hpp"
+#include <dma.h>
+#include <packet2_utils.h>
+#include <cstring>
+
+extern unsigned int VU0Transform_CodeStart __attribute__((section(".vudata")));
+extern unsigned int VU0Transform_CodeEnd __attribute__((section(".vudata")));
+extern unsigned int VU0Cull_CodeStart __attribute__((section(".vudata")));
+extern unsigned int VU0Cull_CodeEnd __attribute__((section(".vudata")));
+extern unsigned int VU0Morph_CodeStart __attribute__((section(".vudata")));
+extern unsigned int VU0Morph_CodeEnd __attribute__((section(".vudata")));
+extern unsigned int VU0Skin_CodeStart __attribute__((section(".vudata")));
+extern unsigned int VU0Skin_CodeEnd __attribute__((section(".vudata")));
+
+namespace Tyra {
+
+/** VU0 data memory, as seen by EE */
+static const unsigned char* const vu0Memory =
+    reinterpret_cast<const unsigned char*>(0x11004000);
+
+/** VIF0 DMA channel control and VIF0 status registers */
+static volatile unsigned int* const vif0DmaChcr =
+    reinterpret_cast<volatile unsigned int*>(0x10008000);
+static volatile unsigned int* const vif0Stat =
+    reinterpret_cast<volatile unsigned int*>(0x10003800);
+
+Vu0Jobs::Vu0Jobs() {
+  packet = nullptr;
+  chunkCount = 0;
+  isChunkInFlight = false;
+}
+
+Vu0Jobs::~Vu0Jobs() {
+  if (packet) packet2_free(packet);
+}
+
+void Vu0Jobs::init() {
+  dma_channel_initialize(DMA_CHANNEL_VIF0, nullptr, 0);
+  dma_channel_fast_waits(DMA_CHANNEL_VIF0);
+
+  packet = Packet2Memory::create(32, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, true);
+  uploadPrograms();
+
+  TYRA_LOG("VU0 jobs initialized");
+}
+
+void Vu0Jobs::uploadPrograms() {
+  unsigned int* starts[VU0_JOB_KERNELS_COUNT] = {
+      &VU0Transform_CodeStart, &VU0Cull_CodeStart, &VU0Morph_CodeStart,
+      &VU0Skin_CodeStart};
+  unsigned int* ends[VU0_JOB_KERNELS_COUNT] = {
+      &VU0Transform_CodeEnd, &VU0Cull_CodeEnd, &VU0Morph_CodeEnd,
+      &VU0Skin_CodeEnd};
+
+  unsigned int packetSize = 1;  // + end tag
+  for (unsigned int i = 0; i < VU0_JOB_KERNELS_COUNT; i++) {
+    packetSize += packet2_utils_get_packet_size_for_program(starts[i], ends[i]);
+  }
+
+  auto* programs = Packet2Memory::create(packetSize, PACKET2_MEMORY_CACHED,
+                                         P2_MODE_CHAIN, true);
+
+  unsigned int address = 0;
+  for (unsigned int i = 0; i < VU0_JOB_KERNELS_COUNT; i++) {
+    programAddresses[i] = address;
+    packet2_vif_add_micro_program(programs, address, starts[i], ends[i]);
+    address += (ends[i] - starts[i]) / 2;
+  }
+
+  // VU0 micro memory - 4KB = 512 instructions
+  TYRA_ASSERT(address <= 512, "VU0 programs don't fit into micro memory");
+
+  packet2_utils_vu_add_end_tag(programs);
+
+  dma_channel_wait(DMA_CHANNEL_VIF0, 0);
+  Packet2Memory::send(programs, DMA_CHANNEL_VIF0, PACKET2_FLUSH_PACKET);
+  dma_channel_wait(DMA_CHANNEL_VIF0, 0);
+
+  packet2_free(programs);
+}
+
+void Vu0Jobs::transform(const float* t_matrix, const float* t_vertices,
+                        float* o_vertices, const unsigned int& t_count) {
+  Vu0Job job;
+  job.kernel = VU0_JOB_TRANSFORM;
+  job.matrix = t_matrix;
+  job.bonesCount = 0;
+  job.inputs[0] = t_vertices;
+  job.output = o_vertices;
+  job.interp = 0.0F;
+  job.count = t_count;
+  add(job);
+}
+
+void Vu0Jobs::cullBoxes(const float* t_matrix, const float* t_boxes,
+                        unsigned int* o_flags, const unsigned int& t_count) {
+  Vu0Job job;
+  job.kernel = VU0_JOB_CULL;
+  job.matrix = t_matrix;
+  job.bonesCount = 0;
+  job.inputs[0] = t_boxes;
+  job.output = o_flags;
+  job.interp = 0.0F;
+  job.count = t_count;
+  add(job);
+}
+
+void Vu0Jobs::morph(const float* t_from, const float* t_to,
+                    const float& t_interp, float* o_vertices,
+                    const unsigned int& t_count) {
+  Vu0Job job;
+  job.kernel = VU0_JOB_MORPH;
+  job.matrix = nullptr;
+  job.bonesCount = 0;
+  job.inputs[0] = t_from;
+  job.inputs[1] = t_to;
+  job.output = o_vertices;
+  job.interp = t_interp;
+  job.count = t_count;
+  add(job);
+}
+
+void Vu0Jobs::skin(const float* t_bones, const unsigned int& t_bonesCount,
+                   const float* t_positions, const float* t_weights,
+                   const int* t_indices, float* o_positions,
+                   const unsigned int& t_count) {
+  TYRA_ASSERT(t_bonesCount <= VU0_SKIN_MAX_BONES, "Too many bones: ",
+              t_bonesCount, ", max: ", VU0_SKIN_MAX_BONES);
+
+  Vu0Job job;
+  job.kernel = VU0_JOB_SKIN;
+  job.matrix = t_bones;
+  job.bonesCount = t_bonesCount;
+  job.inputs[0] = t_positions;
+  job.inputs[1] = t_weights;
+  job.inputs[2] = reinterpret_cast<const float*>(t_indices);
+  job.output = o_positions;
+  job.interp = 0.0F;
+  job.count = t_count;
+  add(job);
+}
+
+void Vu0Jobs::add(const Vu0Job& t_job) {
+  TYRA_ASSERT(packet != nullptr, "Vu0Jobs are not initialized");
+  if (t_job.count == 0) return;
+
+  jobs.push_back(t_job);
+  jobs.back().done = 0;
+  poll();
+}
+
+bool Vu0Jobs::poll() {
+  if (isChunkInFlight) {
+    if (isVu0Busy()) return false;
+    collect(&jobs.front());
+    isChunkInFlight = false;
+  }
+
+  while (!jobs.empty() && jobs.front().done == jobs.front().count) {
+    jobs.erase(jobs.begin());
+  }
+
+  if (jobs.empty()) return true;
+
+  kick(jobs.front());
+  isChunkInFlight = true;
+
+  return false;
+}
+
+void Vu0Jobs::wait() {
+  while (!poll()) {
+  }
+}
+
+void Vu0Jobs::kick(const Vu0Job& t_job) {
+  const auto left = t_job.count - t_job.done;
+  const auto max = getMaxCount(t_job.kernel);
+  chunkCount = left < max ? left : max;
+
+  const auto n = chunkCount;
+  const auto offset = t_job.done * 4;
+  const bool isFirstChunk = t_job.done == 0;
+
+  packet2_reset(packet, false);
+
+  switch (t_job.kernel) {
+    case VU0_JOB_TRANSFORM:
+      if (isFirstChunk) addData(VU0_TRANSFORM_MATRIX_ADDR, t_job.matrix, 4);
+      addHeader(VU0_TRANSFORM_HEADER_ADDR, t_job.interp);
+      addData(VU0_TRANSFORM_DATA_ADDR, t_job.inputs[0] + offset, n);
+      break;
+
+    case VU0_JOB_CULL:
+      if (isFirstChunk) addData(VU0_CULL_MATRIX_ADDR, t_job.matrix, 4);
+      addHeader(VU0_CULL_HEADER_ADDR, t_job.interp);
+      addData(VU0_CULL_DATA_ADDR, t_job.inputs[0] + offset * 2, n * 2);
+      break;
+
+    case VU0_JOB_MORPH:
+      addHeader(VU0_MORPH_HEADER_ADDR, t_job.interp);
+      addData(VU0_MORPH_DATA_ADDR, t_job.inputs[0] + offset, n);
+      addData(VU0_MORPH_DATA_ADDR + n, t_job.inputs[1] + offset, n);
+      break;
+
+    case VU0_JOB_SKIN:
+      if (isFirstChunk) {
+        addData(VU0_SKIN_BONES_ADDR, t_job.matrix, t_job.bonesCount * 4);
+      }
+      addHeader(VU0_SKIN_HEADER_ADDR, t_job.interp);
+      addData(VU0_SKIN_DATA_ADDR, t_job.inputs[0] + offset, n);
+      addData(VU0_SKIN_DATA_ADDR + n, t_job.inputs[1] + offset, n);
+      addData(VU0_SKIN_DATA_ADDR + n * 2, t_job.inputs[2] + offset, n);
+      break;
+
+    default:
+      TYRA_TRAP("Unknown VU0 job kernel");
+      break;
+  }
+
+  packet2_utils_vu_add_start_program(packet, programAddresses[t_job.kernel]);
+  packet2_utils_vu_add_end_tag(packet);
+
+  // Packet is UCAB and inputs were written back by addData()
+  Packet2Memory::send(packet, DMA_CHANNEL_VIF0, PACKET2_FLUSH_NONE);
+}
+
+void Vu0Jobs::collect(Vu0Job* t_job) {
+  const auto address = getOutputAddress(t_job->kernel, chunkCount);
+  const auto* result = vu0Memory + address * 16;
+
+  if (t_job->kernel == VU0_JOB_CULL) {
+    auto* flags = static_cast<unsigned int*>(t_job->output) + t_job->done;
+    for (unsigned int i = 0; i < chunkCount; i++) {
+      flags[i] = *reinterpret_cast<const unsigned int*>(result + i * 16);
+    }
+  } else {
+    auto* vertices = static_cast<float*>(t_job->output) + t_job->done * 4;
+    memcpy(vertices, result, chunkCount * 16);
+  }
+
+  t_job->done += chunkCount;
+}
+
+void Vu0Jobs::addData(const unsigned int& t_address, const void* t_data,
+                      const unsigned int& t_qwords) {
+  const auto* data = static_cast<const unsigned char*>(t_data);
+  Packet2Memory::flushRange(data, data + t_qwords * 16);
+  packet2_utils_vu_add_unpack_data(packet, t_address, const_cast<void*>(t_data),
+                                   t_qwords, false);
+}
+
+void Vu0Jobs::addHeader(const unsigned int& t_address, const float& t_interp) {
+  packet2_utils_vu_open_unpack(packet, t_address, false);
+  {
+    packet2_add_u32(packet, chunkCount);
+    packet2_add_float(packet, t_interp);
+    packet2_add_u32(packet, 0);
+    packet2_add_u32(packet, 0);
+  }
+  packet2_utils_vu_close_unpack(packet);
+}
+
+bool Vu0Jobs::isVu0Busy() const {
+  // DMA transfer is still running (STR bit)
+  if (*vif0DmaChcr & 0x100) return true;
+
+  // VIF0 is still working (VPS) or has data in FIFO (FQC)
+  if (*vif0Stat & 0x0F000003) return true;
+
+  // Micro program is running (VPU-STAT VBS0)
+  unsigned int vpuStat;
+  asm volatile("cfc2 %0, $vi29" : "=r"(vpuStat));
+  return vpuStat & 1;
+}
+
+unsigned int Vu0Jobs::getMaxCount(const Vu0JobKernel& t_kernel) {
+  switch (t_kernel) {
+    case VU0_JOB_TRANSFORM:
+      return VU0_TRANSFORM_MAX_COUNT;
+    case VU0_JOB_CULL:
+      return VU0_CULL_MAX_COUNT;
+    case VU0_JOB_MORPH:
+      return VU0_MORPH_MAX_COUNT;
+    case VU0_JOB_SKIN:
+      return VU0_SKIN_MAX_COUNT;
+    default:
+      return 0;
+  }
+}
+
+unsigned int Vu0Jobs::getOutputAddress(const Vu0JobKernel& t_kernel,
+                                       const unsigned int& t_count) {
+  switch (t_kernel) {
+    case VU0_JOB_TRANSFORM:
+      return VU0_TRANSFORM_DATA_ADDR + t_count;
+    case VU0_JOB_CULL:
+      return VU0_CULL_DATA_ADDR + t_count * 2;
+    case VU0_JOB_MORPH:
+      return VU0_MORPH_DATA_ADDR + t_count * 2;
+    case VU0_JOB_SKIN:
+      return VU0_SKIN_DATA_ADDR + t_count * 3;
+    default:
+      return 0;
+  }
+}
+
+}  // namespace Tyra
@@ -0,0 +1,120 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "memory/memory.hpp"
+#include "debug/debug.hpp"
+#include <kernel.h>
+#include <malloc.h>
+#include <unistd.h>
+#include <stdio.h>
+
+namespace Tyra {
+
+MemoryTracker Memory::tracker;
+ThreadingSemaphore Memory::lock;
+bool Memory::isInitialized = false;
+
+void Memory::init() {
+  TYRA_ASSERT(!isInitialized, "Memory was already initialized!");
+  lock.init(1, 1);
+  tracker.onBudgetExceeded = onBudgetExceeded;
+  isInitialized = true;
+}
+
+// Before init() there is only main thread, so nothing to lock
+void Memory::wait() {
+  if (isInitialized) lock.wait();
+}
+
+void Memory::signal() {
+  if (isInitialized) lock.signal();
+}
+
+void* Memory::allocate(const unsigned int& t_size,
+                       const MemoryCategory& t_category) {
+  wait();
+  auto* result = tracker.allocate(t_size, t_category);
+  signal();
+  return result;
+}
+
+void* Memory::allocate(const unsigned int& t_size,
+                       const MemoryCategory& t_category,
+                       const unsigned int& t_alignment) {
+  wait();
+  auto* result = tracker.allocate(t_size, t_category, t_alignment);
+  signal();
+  return result;
+}
+
+void Memory::free(void* t_pointer) {
+  wait();
+  const auto isFreed = tracker.free(t_pointer);
+  signal();
+  TYRA_ASSERT(isFreed, "Memory was not allocated by Memory::allocate()");
+}
+
+void Memory::setBudget(const MemoryCategory& t_category,
+                       const unsigned int& t_bytes) {
+  wait();
+  tracker.setBudget(t_category, t_bytes);
+  signal();
+}
+
+unsigned int Memory::getFreeRAM() {
+  // Heap grows by sbrk() up to EndOfHeap(), freed chunks stay in malloc
+  auto* heapTop = static_cast<unsigned char*>(sbrk(0));
+  auto* heapEnd = static_cast<unsigned char*>(EndOfHeap());
+  return (heapEnd - heapTop) + mallinfo().fordblks;
+}
+
+float Memory::getHeapFragmentation() {
+  auto info = mallinfo();
+  auto* heapTop = static_cast<unsigned char*>(sbrk(0));
+  auto* heapEnd = static_cast<unsigned char*>(EndOfHeap());
+
+  // Top chunk (keepcost) is contiguous with unclaimed heap
+  const unsigned int largest = (heapEnd - heapTop) + info.keepcost;
+  const unsigned int total = (heapEnd - heapTop) + info.fordblks;
+  if (total == 0) return 0.0F;
+
+  return 1.0F - static_cast<float>(largest) / total;
+}
+
+void Memory::onFrameEnd() {
+  wait();
+  tracker.endFrame();
+  signal();
+}
+
+void Memory::print() {
+  const auto& memory = tracker;
+
+  printf("Memory: live %u KB, peak %u KB, free %u KB, blocks %u\n",
+         memory.getLiveBytes() / 1024, memory.getPeakBytes() / 1024,
+         getFreeRAM() / 1024, memory.getLiveCount());
+
+  for (unsigned int i = 0; i < MEMORY_CATEGORIES_COUNT; i++) {
+    const auto category = static_cast<MemoryCategory>(i);
+    const auto& stats = memory.getStats(category);
+    printf("  %-9s live %6u KB, peak %6u KB, budget %6u KB, blocks %u\n",
+           MemoryTracker::getCategoryName(category), stats.liveBytes / 1024,
+           stats.peakBytes / 1024, stats.budget / 1024, stats.liveCount);
+  }
+}
+
+void Memory::onBudgetExceeded(const MemoryCategory& t_category,
+                              const MemoryCategoryStats& t_stats) {
+  TYRA_TRAP("Memory budget exceeded: ",
+            MemoryTracker::getCategoryName(t_category), " ",
+            t_stats.liveBytes, "/", t_stats.budget, " bytes");
+}
+
+}  // namespace Tyra
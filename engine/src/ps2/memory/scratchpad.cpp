@@ -0,0 +1,81 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "memory/scratchpad.hpp"
+#include "debug/debug.hpp"
+#include <dma.h>
+#include <kernel.h>
+
+namespace Tyra {
+
+const unsigned int Scratchpad::address = 0x70000000;
+const unsigned int Scratchpad::size = 16 * 1024;
+
+ScratchpadArena Scratchpad::arena;
+bool Scratchpad::isInitialized = false;
+
+/** SPR address registers of fromSPR (8) and toSPR (9) DMA channels */
+static volatile unsigned int* const fromSprSadr =
+    reinterpret_cast<volatile unsigned int*>(0x1000D080);
+static volatile unsigned int* const toSprSadr =
+    reinterpret_cast<volatile unsigned int*>(0x1000D480);
+
+void Scratchpad::init() {
+  arena.init(reinterpret_cast<unsigned char*>(address), size);
+
+  dma_channel_initialize(DMA_CHANNEL_fromSPR, nullptr, 0);
+  dma_channel_initialize(DMA_CHANNEL_toSPR, nullptr, 0);
+  dma_channel_fast_waits(DMA_CHANNEL_fromSPR);
+  dma_channel_fast_waits(DMA_CHANNEL_toSPR);
+
+  isInitialized = true;
+}
+
+ScratchpadArena& Scratchpad::getArena() {
+  if (!isInitialized) init();
+  return arena;
+}
+
+unsigned int Scratchpad::getOffset(const void* t_pointer) {
+  const auto pointer = reinterpret_cast<unsigned int>(t_pointer);
+  TYRA_ASSERT(pointer >= address && pointer < address + size,
+              "Pointer is not in scratchpad");
+  return pointer - address;
+}
+
+void Scratchpad::copyTo(void* t_spr, const void* t_ram,
+                        const unsigned int& t_qwords) {
+  if (!isInitialized) init();
+
+  const auto* ram = static_cast<const unsigned char*>(t_ram);
+  SyncDCache(const_cast<unsigned char*>(ram),
+             const_cast<unsigned char*>(ram + t_qwords * 16));
+
+  *toSprSadr = getOffset(t_spr);
+  dma_channel_send_normal(DMA_CHANNEL_toSPR, const_cast<void*>(t_ram),
+                          t_qwords, 0, 0);
+  dma_channel_wait(DMA_CHANNEL_toSPR, 0);
+}
+
+void Scratchpad::copyFrom(void* t_ram, const void* t_spr,
+                          const unsigned int& t_qwords) {
+  if (!isInitialized) init();
+
+  auto* ram = static_cast<unsigned char*>(t_ram);
+
+  *fromSprSadr = getOffset(t_spr);
+  dma_channel_receive_normal(DMA_CHANNEL_fromSPR, t_ram, t_qwords * 16, 0, 0);
+  dma_channel_wait(DMA_CHANNEL_fromSPR, 0);
+
+  // CPU could have stale lines of this memory
+  InvalidDCache(ram, ram + t_qwords * 16);
+}
+
+}  // namespace Tyra
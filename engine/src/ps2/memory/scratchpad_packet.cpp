@@ -0,0 +1,64 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "memory/scratchpad_packet.hpp"
+#include "debug/debug.hpp"
+#include <dma.h>
+
+namespace Tyra {
+
+ScratchpadPacket::ScratchpadPacket() { marker = 0; }
+
+ScratchpadPacket::~ScratchpadPacket() {}
+
+void ScratchpadPacket::init(const unsigned short& t_qwords) {
+  auto& arena = Scratchpad::getArena();
+  marker = arena.getMarker();
+
+  auto initialized = buffer.init(&arena, t_qwords * sizeof(qword_t));
+  TYRA_ASSERT(initialized, "Not enough scratchpad memory. Free: ",
+              arena.getFree(), "B, required: ", t_qwords * 2 * 16, "B");
+
+  for (unsigned int i = 0; i < 2; i++) {
+    auto* base = reinterpret_cast<qword_t*>(buffer.getHalf(i));
+    packet2_create_from(&packets[i], base, base, t_qwords, P2_TYPE_NORMAL,
+                        P2_MODE_CHAIN, true);
+  }
+}
+
+void ScratchpadPacket::free() {
+  auto& arena = Scratchpad::getArena();
+  TYRA_ASSERT(arena.getUsed() == marker + buffer.getHalfSize() * 2 ||
+                  !buffer.isInitialized(),
+              "Scratchpad packet is not the last allocation");
+
+  arena.release(marker);
+  buffer = ScratchpadDoubleBuffer();
+}
+
+packet2_t* ScratchpadPacket::next() {
+  buffer.swap();
+  auto* packet = get();
+  packet2_reset(packet, false);
+  return packet;
+}
+
+void ScratchpadPacket::send(const int& t_channel) {
+  auto* packet = get();
+
+  // SPR flag set - chain is read by DMA from scratchpad, not from RAM
+  dma_channel_send_chain(t_channel,
+                         reinterpret_cast<void*>(Scratchpad::getOffset(
+                             packet->base)),
+                         packet2_get_qw_count(packet), DMA_FLAG_TRANSFERTAG,
+                         1);
+}
+
+}  // namespace Tyra
@@ -0,0 +1,81 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "packet2/packet2_memory.hpp"
+#include "debug/debug.hpp"
+#include <dma.h>
+#include <kernel.h>
+
+namespace Tyra {
+
+/** Bigger than EE D-cache (8KB), so full writeback is cheaper */
+const unsigned int Packet2Memory::maxRangeFlushSize = 8 * 1024;
+
+Packet2MemoryStats Packet2Memory::current = {0, 0, 0, 0};
+Packet2MemoryStats Packet2Memory::lastFrame = {0, 0, 0, 0};
+
+packet2_t* Packet2Memory::create(const unsigned short& t_qwords,
+                                 const Packet2MemoryType& t_type,
+                                 const Packet2Mode& t_mode,
+                                 const unsigned char& t_tte) {
+  auto type =
+      t_type == PACKET2_MEMORY_UCAB ? P2_TYPE_UNCACHED_ACCL : P2_TYPE_NORMAL;
+  return packet2_create(t_qwords, type, t_mode, t_tte);
+}
+
+void Packet2Memory::send(packet2_t* t_packet, const int& t_channel,
+                         const Packet2FlushType& t_flush) {
+  TYRA_ASSERT(t_flush != PACKET2_FLUSH_NONE || isUcab(t_packet),
+              "Cached packet can't be sent without flush");
+
+  if (t_flush == PACKET2_FLUSH_ALL) {
+    FlushCache(0);
+    current.fullFlushes++;
+  } else if (t_flush == PACKET2_FLUSH_PACKET && !isUcab(t_packet)) {
+    flushRange(t_packet->base, t_packet->next);
+  } else {
+    // Drain write-back buffer, so DMA will see all UCAB writes
+    asm volatile("sync.l");
+    current.skippedFlushes++;
+  }
+
+  current.sends++;
+  dma_channel_send_packet2(t_packet, t_channel, false);
+}
+
+void Packet2Memory::flushRange(const void* t_start, const void* t_end) {
+  auto start = reinterpret_cast<unsigned int>(t_start);
+  auto end = reinterpret_cast<unsigned int>(t_end);
+
+  if (end - start > maxRangeFlushSize) {
+    FlushCache(0);
+    current.fullFlushes++;
+    return;
+  }
+
+  SyncDCache(const_cast<void*>(t_start), const_cast<void*>(t_end));
+  current.rangeFlushes++;
+}
+
+void Packet2Memory::onFrameEnd() {
+  lastFrame = current;
+  current = {0, 0, 0, 0};
+}
+
+const Packet2MemoryStats& Packet2Memory::getLastFrameStats() {
+  return lastFrame;
+}
+
+bool Packet2Memory::isUcab(const packet2_t* t_packet) {
+  return t_packet->type == P2_TYPE_UNCACHED_ACCL ||
+         t_packet->type == P2_TYPE_UNCACHED;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,79 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "physics/collision_world.hpp"
+
+namespace Tyra {
+
+CollisionWorld::CollisionWorld() {}
+
+CollisionWorld::~CollisionWorld() {}
+
+void CollisionWorld::add(const StaticMesh* t_mesh) {
+  const auto model = t_mesh->getModelMatrix();
+
+  for (auto* material : t_mesh->materials) {
+    auto* frame = material->frames[0];
+    bvh.addTriangles(reinterpret_cast<const float*>(frame->vertices),
+                     frame->count, model.data);
+  }
+}
+
+void CollisionWorld::build() { bvh.build(); }
+
+void CollisionWorld::clear() { bvh.clear(); }
+
+bool CollisionWorld::raycast(const Ray& t_ray, const float& t_maxDistance,
+                             CollisionHit* o_hit) const {
+  CollisionRay ray;
+  Vec4::copy(reinterpret_cast<Vec4*>(ray.origin), t_ray.origin);
+  Vec4::copy(reinterpret_cast<Vec4*>(ray.direction), t_ray.direction);
+  ray.maxDistance = t_maxDistance;
+
+  return bvh.raycast(ray, o_hit);
+}
+
+bool CollisionWorld::isOccluded(const Vec4& t_from, const Vec4& t_to) const {
+  const auto direction = t_to - t_from;
+  const float distance = direction.length();
+  if (distance <= 0.0F) return false;
+
+  CollisionRay ray = {{t_from.x, t_from.y, t_from.z, 1.0F},
+                      {direction.x / distance, direction.y / distance,
+                       direction.z / distance, 0.0F},
+                      distance};
+
+  return bvh.isOccluded(ray);
+}
+
+bool CollisionWorld::sweepSphere(const Vec4& t_center, const float& t_radius,
+                                 const Vec4& t_direction,
+                                 const float& t_distance,
+                                 CollisionHit* o_hit) const {
+  return bvh.sweepSphere(t_center.xyzw, t_radius, t_direction.xyzw,
+                         t_distance, o_hit);
+}
+
+bool CollisionWorld::sweepCapsule(const Vec4& t_a, const Vec4& t_b,
+                                  const float& t_radius,
+                                  const Vec4& t_direction,
+                                  const float& t_distance,
+                                  CollisionHit* o_hit) const {
+  return bvh.sweepCapsule(t_a.xyzw, t_b.xyzw, t_radius, t_direction.xyzw,
+                          t_distance, o_hit);
+}
+
+bool CollisionWorld::closestPoint(const Vec4& t_point,
+                                  const float& t_maxDistance,
+                                  CollisionHit* o_hit) const {
+  return bvh.closestPoint(t_point.xyzw, t_maxDistance, o_hit);
+}
+
+}  // namespace Tyra
@@ -26,6 +26,9 @@ void Renderer2D::render(const Sprite& sprite) {
       texture, "Texture for sprite with id: ", sprite.id,
       "Was not found in texture repository! Did you forget to add texture?");
 
+  // HUD is drawn over upscaled 3D, in full resolution
+  core->resolve3D();
+
   auto texBuffers = core->texture.useTexture(texture);
   core->texture.updateClutBuffer(texBuffers.clut);
   core->renderer2D.render(sprite, texBuffers, texture);
@@ -10,6 +10,7 @@
 */
 
 #include "renderer/3d/mesh/mesh.hpp"
+#include <cstring>
 
 namespace Tyra {
 
@@ -44,7 +45,35 @@ Mesh::Mesh(const Mesh& mesh) {
   isMother = false;
 }
 
-M4x4 Mesh::getModelMatrix() const { return translation * rotation * scale; }
+const M4x4& Mesh::getModelMatrix() const {
+  if (!isModelMatrixDirty()) return modelMatrix;
+
+  modelMatrix = translation * rotation * scale;
+  if (transform) modelMatrix = transform->getWorldMatrix() * modelMatrix;
+
+  cachedTranslation = translation;
+  cachedRotation = rotation;
+  cachedScale = scale;
+  cachedTransform = transform;
+  cachedTransformVersion = transform ? transform->getWorldVersion() : 0;
+  isModelMatrixValid = true;
+
+  return modelMatrix;
+}
+
+bool Mesh::isModelMatrixDirty() const {
+  if (!isModelMatrixValid || cachedTransform != transform) return true;
+
+  if (transform) {
+    transform->getWorldMatrix();  // Recalculates node, if it is dirty
+    if (transform->getWorldVersion() != cachedTransformVersion) return true;
+  }
+
+  const auto size = sizeof(M4x4::data);
+  return memcmp(translation.data, cachedTranslation.data, size) != 0 ||
+         memcmp(rotation.data, cachedRotation.data, size) != 0 ||
+         memcmp(scale.data, cachedScale.data, size) != 0;
+}
 
 MeshMaterial* Mesh::getMaterialByName(const std::string& name) {
   for (auto* material : materials) {
@@ -67,6 +96,10 @@ void Mesh::init() {
   translation = M4x4::Identity;
   rotation = M4x4::Identity;
   scale = M4x4::Identity;
+  transform = nullptr;
+  cachedTransform = nullptr;
+  cachedTransformVersion = 0;
+  isModelMatrixValid = false;
   translation.translate(Vec4(0.0F, 0.0F, 0.0F, 1.0F));
 }
 
@@ -45,6 +45,7 @@ MeshMaterial::MeshMaterial(const MeshBuilderData& data,
         FileUtils::getFilenameFromPath(material->texturePath.value());
 
     textureName = FileUtils::getFilenameWithoutExtension(textureFilename);
+    this->textureFilename = textureFilename;
   }
 
   TYRA_ASSERT(name.length() > 0, "MeshMaterial name cannot be empty");
@@ -79,6 +80,7 @@ MeshMaterial::MeshMaterial(const MeshMaterial& mesh) {
   lightmapFlag = mesh.lightmapFlag;
   name = mesh.name;
   textureName = mesh.textureName;
+  textureFilename = mesh.textureFilename;
   ambient.set(128.0F, 128.0F, 128.0F, 128.0F);
 
   for (unsigned int i = 0; i < mesh.frames.size(); i++) {
@@ -0,0 +1,72 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "renderer/3d/mesh/static/static_batch.hpp"
+
+namespace Tyra {
+
+StaticBatch::StaticBatch() {}
+
+StaticBatch::~StaticBatch() {
+  for (auto* chunk : chunks) {
+    delete chunk;
+  }
+}
+
+std::vector<StaticBatchEntry> StaticBatch::getEntries(
+    const unsigned int& sourceIndex) const {
+  std::vector<StaticBatchEntry> result;
+
+  for (const auto& entry : entries) {
+    if (entry.sourceIndex == sourceIndex) result.push_back(entry);
+  }
+
+  return result;
+}
+
+unsigned int StaticBatch::getVertexCount() const {
+  unsigned int result = 0;
+
+  for (const auto* chunk : chunks) {
+    for (const auto* material : chunk->materials) {
+      result += material->frames[0]->count;
+    }
+  }
+
+  return result;
+}
+
+void StaticBatch::linkTextures(TextureRepository* repository) const {
+  for (unsigned int i = 0; i < chunks.size(); i++) {
+    auto& materials = chunks[i]->materials;
+
+    for (unsigned int j = 0; j < materials.size(); j++) {
+      if (!materials[j]->textureName.has_value()) continue;
+
+      auto* texture = repository->getByMeshMaterialId(sourceMaterialIds[i][j]);
+      TYRA_ASSERT(texture, "Texture for batched material \"",
+                  materials[j]->name, "\" not found. Load source textures ",
+                  "before linking");
+
+      texture->addLink(materials[j]->id);
+    }
+  }
+}
+
+void StaticBatch::unlinkTextures(TextureRepository* repository) const {
+  for (const auto* chunk : chunks) {
+    for (const auto* material : chunk->materials) {
+      auto* texture = repository->getByMeshMaterialId(material->id);
+      if (texture) texture->removeLinkById(material->id);
+    }
+  }
+}
+
+}  // namespace Tyra
@@ -0,0 +1,263 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "renderer/3d/mesh/static/static_batch_builder.hpp"
+#include <cmath>
+
+namespace Tyra {
+
+StaticBatchBuilder::StaticBatchBuilder() {}
+
+StaticBatchBuilder::~StaticBatchBuilder() {}
+
+unsigned int StaticBatchBuilder::add(const StaticMesh* mesh) {
+  return add(mesh, mesh->getModelMatrix());
+}
+
+unsigned int StaticBatchBuilder::add(const StaticMesh* mesh,
+                                     const M4x4& model) {
+  TYRA_ASSERT(mesh, "Provided mesh is null");
+
+  Source source;
+  source.mesh = mesh;
+  source.model = model;
+  sources.push_back(source);
+
+  return sources.size() - 1;
+}
+
+void StaticBatchBuilder::clear() { sources.clear(); }
+
+std::unique_ptr<StaticBatch> StaticBatchBuilder::build() {
+  return build(StaticBatchOptions());
+}
+
+std::unique_ptr<StaticBatch> StaticBatchBuilder::build(
+    const StaticBatchOptions& options) {
+  auto result = std::make_unique<StaticBatch>();
+
+  if (sources.size() == 0) {
+    TYRA_WARN("Static batch has no sources");
+    return result;
+  }
+
+  std::vector<ChunkKey> keys;
+  std::vector<MeshBuilderData*> chunks;
+
+  // Layout pass: assign every source material to chunk material range
+  for (unsigned int i = 0; i < sources.size(); i++) {
+    auto key = getChunkKey(sources[i], options);
+
+    unsigned int chunkIndex = 0;
+    while (chunkIndex < keys.size() && !isEqual(keys[chunkIndex], key))
+      chunkIndex++;
+
+    if (chunkIndex == keys.size()) {
+      auto* data = new MeshBuilderData();
+      data->loadNormals = key.normals;
+      data->loadLightmap = key.lightmap;
+
+      keys.push_back(key);
+      chunks.push_back(data);
+      result->sourceMaterialIds.push_back({});
+    }
+
+    auto* data = chunks[chunkIndex];
+    auto& sourceMaterials = sources[i].mesh->materials;
+
+    for (unsigned int j = 0; j < sourceMaterials.size(); j++) {
+      auto materialIndex = getMaterialIndex(data, sourceMaterials[j]);
+      auto* frame = data->materials[materialIndex]->frames[0];
+
+      if (materialIndex == result->sourceMaterialIds[chunkIndex].size())
+        result->sourceMaterialIds[chunkIndex].push_back(
+            sourceMaterials[j]->id);
+
+      StaticBatchEntry entry;
+      entry.sourceIndex = i;
+      entry.sourceMaterialIndex = j;
+      entry.chunkIndex = chunkIndex;
+      entry.materialIndex = materialIndex;
+      entry.firstVertex = frame->count;
+      entry.count = sourceMaterials[j]->frames[0]->count;
+      result->entries.push_back(entry);
+
+      frame->count += entry.count;
+    }
+  }
+
+  for (auto* data : chunks) allocate(data);
+
+  for (const auto& entry : result->entries) {
+    auto* data = chunks[entry.chunkIndex];
+    fill(sources[entry.sourceIndex], entry,
+         data->materials[entry.materialIndex]->frames[0]);
+  }
+
+  // Mesh takes ownership of arrays, builder data can go
+  for (auto* data : chunks) {
+    result->chunks.push_back(new StaticMesh(data));
+    delete data;
+  }
+
+  TYRA_LOG("Static batch built. Sources: ", sources.size(),
+           ", chunks: ", result->chunks.size(),
+           ", vertices: ", result->getVertexCount());
+
+  return result;
+}
+
+StaticBatchBuilder::ChunkKey StaticBatchBuilder::getChunkKey(
+    const Source& source, const StaticBatchOptions& options) {
+  ChunkKey result;
+  result.x = 0;
+  result.y = 0;
+  result.z = 0;
+
+  auto* frame = source.mesh->materials[0]->frames[0];
+  result.normals = frame->normals != nullptr;
+  result.lightmap = source.mesh->materials[0]->lightmapFlag;
+
+  if (options.chunkSize > 0.0F) {
+    auto center =
+        source.mesh->frame->bbox->getTransformed(source.model).getCenter();
+
+    result.x = static_cast<int>(floorf(center.x / options.chunkSize));
+    result.y = static_cast<int>(floorf(center.y / options.chunkSize));
+    result.z = static_cast<int>(floorf(center.z / options.chunkSize));
+  }
+
+  return result;
+}
+
+bool StaticBatchBuilder::isEqual(const ChunkKey& a, const ChunkKey& b) {
+  return a.x == b.x && a.y == b.y && a.z == b.z && a.normals == b.normals &&
+         a.lightmap == b.lightmap;
+}
+
+std::optional<std::string> StaticBatchBuilder::getTexturePath(
+    const MeshMaterial* material) {
+  if (!material->textureFilename.has_value()) return std::nullopt;
+
+  // Same extension as source, MeshMaterial strips it back to the name
+  return material->textureFilename.value();
+}
+
+unsigned int StaticBatchBuilder::getMaterialIndex(
+    MeshBuilderData* data, const MeshMaterial* material) {
+  auto texturePath = getTexturePath(material);
+
+  for (unsigned int i = 0; i < data->materials.size(); i++) {
+    auto* candidate = data->materials[i];
+
+    if (candidate->texturePath == texturePath &&
+        candidate->ambient.r == material->ambient.r &&
+        candidate->ambient.g == material->ambient.g &&
+        candidate->ambient.b == material->ambient.b &&
+        candidate->ambient.a == material->ambient.a)
+      return i;
+  }
+
+  auto* result = new MeshBuilderMaterialData();
+  result->name = material->name;
+  result->texturePath = texturePath;
+  result->ambient.set(material->ambient);
+
+  auto* frame = new MeshBuilderMaterialFrameData();
+  frame->count = 0;
+  result->frames.push_back(frame);
+
+  data->materials.push_back(result);
+
+  return data->materials.size() - 1;
+}
+
+void StaticBatchBuilder::allocate(MeshBuilderData* data) {
+  for (auto* material : data->materials) {
+    auto* frame = material->frames[0];
+
+    frame->vertices = new Vec4[frame->count];
+
+    if (material->texturePath.has_value())
+      frame->textureCoords = new Vec4[frame->count];
+
+    if (data->loadNormals) frame->normals = new Vec4[frame->count];
+
+    if (data->loadLightmap) frame->colors = new Color[frame->count];
+  }
+}
+
+void StaticBatchBuilder::fill(const Source& source,
+                              const StaticBatchEntry& entry,
+                              MeshBuilderMaterialFrameData* output) {
+  auto* input =
+      source.mesh->materials[entry.sourceMaterialIndex]->frames[0];
+  auto offset = entry.firstVertex;
+
+  for (unsigned int i = 0; i < entry.count; i++) {
+    output->vertices[offset + i] = source.model * input->vertices[i];
+  }
+
+  if (output->textureCoords) {
+    for (unsigned int i = 0; i < entry.count; i++) {
+      output->textureCoords[offset + i] = input->textureCoords[i];
+    }
+  }
+
+  if (output->normals) {
+    auto normalMatrix = getNormalMatrix(source.model);
+
+    for (unsigned int i = 0; i < entry.count; i++) {
+      auto& normal = output->normals[offset + i];
+      normal = normalMatrix * input->normals[i];
+      normal.normalize();
+    }
+  }
+
+  if (output->colors) {
+    for (unsigned int i = 0; i < entry.count; i++) {
+      output->colors[offset + i].set(input->colors[i]);
+    }
+  }
+}
+
+M4x4 StaticBatchBuilder::getNormalMatrix(const M4x4& model) {
+  // Column major, a[row][col]
+  float a[3][3];
+  for (unsigned int row = 0; row < 3; row++)
+    for (unsigned int col = 0; col < 3; col++)
+      a[row][col] = model.data[col * 4 + row];
+
+  // Cofactors = inverse transpose * determinant
+  float c[3][3];
+  c[0][0] = a[1][1] * a[2][2] - a[1][2] * a[2][1];
+  c[0][1] = a[1][2] * a[2][0] - a[1][0] * a[2][2];
+  c[0][2] = a[1][0] * a[2][1] - a[1][1] * a[2][0];
+  c[1][0] = a[0][2] * a[2][1] - a[0][1] * a[2][2];
+  c[1][1] = a[0][0] * a[2][2] - a[0][2] * a[2][0];
+  c[1][2] = a[0][1] * a[2][0] - a[0][0] * a[2][1];
+  c[2][0] = a[0][1] * a[1][2] - a[0][2] * a[1][1];
+  c[2][1] = a[0][2] * a[1][0] - a[0][0] * a[1][2];
+  c[2][2] = a[0][0] * a[1][1] - a[0][1] * a[1][0];
+
+  // Length is fixed by normalize(), only mirroring has to be kept
+  const float det =
+      a[0][0] * c[0][0] + a[0][1] * c[0][1] + a[0][2] * c[0][2];
+  const float sign = det < 0.0F ? -1.0F : 1.0F;
+
+  M4x4 result = M4x4::Identity;
+  for (unsigned int row = 0; row < 3; row++)
+    for (unsigned int col = 0; col < 3; col++)
+      result.data[col * 4 + row] = c[row][col] * sign;
+
+  return result;
+}
+
+}  // namespace Tyra
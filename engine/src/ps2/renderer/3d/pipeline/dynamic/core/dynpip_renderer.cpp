@@ -9,6 +9,7 @@
 */
 
 #include "renderer/3d/pipeline/dynamic/core/dynpip_renderer.hpp"
+#include "packet2/packet2_memory.hpp"
 #include "renderer/3d/pipeline/dynamic/core/programs/dynpip_vu1_shared_defines.h"
 #include <dma.h>
 #include <utility>
@@ -29,8 +30,9 @@ DynPipRenderer::~DynPipRenderer() {
 }
 
 void DynPipRenderer::allocateOnUse(const unsigned int& t_packetSize) {
-  staticDataPacket = packet2_create(3, P2_TYPE_NORMAL, P2_MODE_CHAIN, true);
-  objectDataPacket = packet2_create(20, P2_TYPE_NORMAL, P2_MODE_CHAIN, true);
+  staticDataPacket =
+      Packet2Memory::create(3, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, true);
+  objectDataPackets.init(48);
 
   packetSize = t_packetSize;
 
@@ -43,7 +45,7 @@ void DynPipRenderer::allocateOnUse(const unsigned int& t_packetSize) {
 
 void DynPipRenderer::deallocateOnUse() {
   packet2_free(staticDataPacket);
-  packet2_free(objectDataPacket);
+  objectDataPackets.free();
 
   for (unsigned short i = 0; i < 2; i++) packet2_free(packets[i]);
 }
@@ -90,34 +92,36 @@ void DynPipRenderer::sendStaticData() const {
 
   packet2_utils_vu_add_end_tag(staticDataPacket);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(staticDataPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(staticDataPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_NONE);
 }
 
 void DynPipRenderer::sendObjectData(
-    DynPipBag* bag, M4x4* mvp, RendererCoreTextureBuffers* texBuffers) const {
-  packet2_reset(objectDataPacket, false);
-  packet2_utils_vu_add_unpack_data(objectDataPacket, VU1_MVP_MATRIX_ADDR,
-                                   mvp->data, 4, false);
+    DynPipBag* bag, M4x4* mvp, RendererCoreTextureBuffers* texBuffers) {
+  auto* objectDataPacket = objectDataPackets.next();
+  Packet2TyraUtils::addInlineUnpackData(objectDataPacket, VU1_MVP_MATRIX_ADDR,
+                                        mvp->data, 4, false);
 
   if (bag->lighting) {
-    packet2_utils_vu_add_unpack_data(objectDataPacket, VU1_LIGHTS_MATRIX_ADDR,
-                                     bag->lighting->lightMatrix, 3, false);
+    Packet2TyraUtils::addInlineUnpackData(objectDataPacket,
+                                          VU1_LIGHTS_MATRIX_ADDR,
+                                          bag->lighting->lightMatrix, 3, false);
 
-    packet2_utils_vu_add_unpack_data(
+    Packet2TyraUtils::addInlineUnpackData(
         objectDataPacket, VU1_LIGHTS_DIRS_ADDR,
         bag->lighting->dirLights->getLightDirections(), 3, false);
 
-    packet2_utils_vu_add_unpack_data(objectDataPacket, VU1_LIGHTS_COLORS_ADDR,
-                                     bag->lighting->dirLights->getLightColors(),
-                                     4, false);
+    Packet2TyraUtils::addInlineUnpackData(
+        objectDataPacket, VU1_LIGHTS_COLORS_ADDR,
+        bag->lighting->dirLights->getLightColors(), 4, false);
   }
 
   unsigned char singleColorEnabled = bag->color->single != nullptr;
 
   if (singleColorEnabled)  // Color is placed in 4th slot of
                            // VU1_LIGHTS_MATRIX_ADDR
-    Packet2TyraUtils::addUnpackData(objectDataPacket, VU1_SINGLE_COLOR_ADDR,
-                                    bag->color->single->rgba, 1, false);
+    Packet2TyraUtils::addInlineUnpackData(objectDataPacket,
+                                          VU1_SINGLE_COLOR_ADDR,
+                                          bag->color->single->rgba, 1, false);
 
   packet2_utils_vu_open_unpack(objectDataPacket, VU1_OPTIONS_ADDR, false);
   {
@@ -154,7 +158,7 @@ void DynPipRenderer::sendObjectData(
 
   packet2_utils_vu_add_end_tag(objectDataPacket);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(objectDataPacket, DMA_CHANNEL_VIF1, true);
+  objectDataPackets.send(DMA_CHANNEL_VIF1);
 }
 
 void DynPipRenderer::render(DynPipBag** bags, const unsigned int& count) {
@@ -191,7 +195,7 @@ void DynPipRenderer::addBufferDataToPacket(DynPipBag** bags,
 void DynPipRenderer::sendPacket() {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
   // dma_wait_fast(); // This have no impact on performance
-  dma_channel_send_packet2(currentPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(currentPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_ALL);
 
   TYRA_ASSERT(packet2_get_qw_count(currentPacket) <= packetSize,
               "Packet is too big. Internal error.");
@@ -206,7 +210,7 @@ void DynPipRenderer::clearLastProgramName() {
 
 void DynPipRenderer::uploadPrograms() {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(programsPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(programsPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_PACKET);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
 }
 
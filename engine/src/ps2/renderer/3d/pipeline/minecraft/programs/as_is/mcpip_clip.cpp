@@ -9,11 +9,13 @@
 */
 
 #include "renderer/3d/pipeline/minecraft/programs/as_is/mcpip_clip.hpp"
+#include "packet2/packet2_memory.hpp"
 
 namespace Tyra {
 
 McpipClip::McpipClip() {
-  staticPacket = packet2_create(8, P2_TYPE_NORMAL, P2_MODE_CHAIN, true);
+  staticPacket =
+      Packet2Memory::create(8, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, true);
   algoSettings.lerpColors = false;
   algoSettings.lerpTexCoords = true;
   algoSettings.lerpNormals = false;
@@ -155,7 +157,7 @@ void McpipClip::setDBufferSize() {
 
 void McpipClip::sendVU1StaticData() {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(staticPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(staticPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_NONE);
 }
 
 }  // namespace Tyra
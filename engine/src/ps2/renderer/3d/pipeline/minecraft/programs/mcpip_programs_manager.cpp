@@ -9,6 +9,7 @@
 */
 
 #include "renderer/3d/pipeline/minecraft/programs/mcpip_programs_manager.hpp"
+#include "packet2/packet2_memory.hpp"
 
 namespace Tyra {
 
@@ -56,7 +57,7 @@ void BlockizerProgramsManager::setProgramsCache() {
 
 void BlockizerProgramsManager::uploadVU1Programs() {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(programsPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(programsPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_PACKET);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
   lastProgramName = UndefinedMcpipProgram;
   vu1BlockData = BlockNotUploaded;
@@ -87,7 +88,7 @@ void BlockizerProgramsManager::uploadBlock(bool isMulti) {
 
   vu1BlockData = isMulti ? BlockMultiUploaded : BlockSingleUploaded;
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(staticPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(staticPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_ALL);
 }
 
 void BlockizerProgramsManager::cullSpam(McpipBlock*** blockPointerArrays,
@@ -170,7 +171,7 @@ void BlockizerProgramsManager::sendPacket(McpipProgram* program) {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
   // dma_wait_fast(); // This have no impact on performance
 
-  dma_channel_send_packet2(currentPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(currentPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_ALL);
   context = !context;
 }
 
@@ -9,6 +9,7 @@
 */
 
 #include "renderer/3d/pipeline/static/core/stapip_qbuffer_renderer.hpp"
+#include "packet2/packet2_memory.hpp"
 #include "renderer/3d/pipeline/static/core/programs/stapip_vu1_shared_defines.h"
 #include "packet2/packet2_tyra_utils.hpp"
 
@@ -56,8 +57,9 @@ StaPipQBufferRenderer::StaPipQBufferRenderer() {
 }
 
 void StaPipQBufferRenderer::allocateOnUse() {
-  staticDataPacket = packet2_create(3, P2_TYPE_NORMAL, P2_MODE_CHAIN, true);
-  objectDataPacket = packet2_create(20, P2_TYPE_NORMAL, P2_MODE_CHAIN, true);
+  staticDataPacket =
+      Packet2Memory::create(3, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, true);
+  objectDataPackets.init(48);
 
   packets = new packet2_t*[2];
   for (unsigned short i = 0; i < 2; i++)
@@ -76,7 +78,7 @@ void StaPipQBufferRenderer::allocateOnUse() {
 
 void StaPipQBufferRenderer::deallocateOnUse() {
   packet2_free(staticDataPacket);
-  packet2_free(objectDataPacket);
+  objectDataPackets.free();
 
   for (unsigned short i = 0; i < 2; i++) packet2_free(packets[i]);
   delete[] packets;
@@ -114,30 +116,32 @@ void StaPipQBufferRenderer::reinitVU1() {
 }
 
 void StaPipQBufferRenderer::sendObjectData(
-    StaPipBag* bag, M4x4* mvp, RendererCoreTextureBuffers* texBuffers) const {
-  packet2_reset(objectDataPacket, false);
-  packet2_utils_vu_add_unpack_data(objectDataPacket, VU1_MVP_MATRIX_ADDR,
-                                   mvp->data, 4, false);
+    StaPipBag* bag, M4x4* mvp, RendererCoreTextureBuffers* texBuffers) {
+  auto* objectDataPacket = objectDataPackets.next();
+  Packet2TyraUtils::addInlineUnpackData(objectDataPacket, VU1_MVP_MATRIX_ADDR,
+                                        mvp->data, 4, false);
 
   if (bag->lighting) {
-    packet2_utils_vu_add_unpack_data(objectDataPacket, VU1_LIGHTS_MATRIX_ADDR,
-                                     bag->lighting->lightMatrix, 3, false);
+    Packet2TyraUtils::addInlineUnpackData(objectDataPacket,
+                                          VU1_LIGHTS_MATRIX_ADDR,
+                                          bag->lighting->lightMatrix, 3, false);
 
-    packet2_utils_vu_add_unpack_data(
+    Packet2TyraUtils::addInlineUnpackData(
         objectDataPacket, VU1_LIGHTS_DIRS_ADDR,
         bag->lighting->dirLights->getLightDirections(), 3, false);
 
-    packet2_utils_vu_add_unpack_data(objectDataPacket, VU1_LIGHTS_COLORS_ADDR,
-                                     bag->lighting->dirLights->getLightColors(),
-                                     4, false);
+    Packet2TyraUtils::addInlineUnpackData(
+        objectDataPacket, VU1_LIGHTS_COLORS_ADDR,
+        bag->lighting->dirLights->getLightColors(), 4, false);
   }
 
   unsigned char singleColorEnabled = bag->color->single != nullptr;
 
   if (singleColorEnabled)  // Color is placed in 4th slot of
                            // VU1_LIGHTS_MATRIX_ADDR
-    Packet2TyraUtils::addUnpackData(objectDataPacket, VU1_SINGLE_COLOR_ADDR,
-                                    bag->color->single->rgba, 1, false);
+    Packet2TyraUtils::addInlineUnpackData(objectDataPacket,
+                                          VU1_SINGLE_COLOR_ADDR,
+                                          bag->color->single->rgba, 1, false);
 
   packet2_utils_vu_open_unpack(objectDataPacket, VU1_OPTIONS_ADDR, false);
   {
@@ -173,7 +177,7 @@ void StaPipQBufferRenderer::sendObjectData(
 
   packet2_utils_vu_add_end_tag(objectDataPacket);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(objectDataPacket, DMA_CHANNEL_VIF1, true);
+  objectDataPackets.send(DMA_CHANNEL_VIF1);
 }
 
 void StaPipQBufferRenderer::setInfo(PipelineInfoBag* bag) {
@@ -198,7 +202,7 @@ void StaPipQBufferRenderer::sendStaticData() const {
 
   packet2_utils_vu_add_end_tag(staticDataPacket);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(staticDataPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(staticDataPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_NONE);
 }
 
 void StaPipQBufferRenderer::setProgramsCache() {
@@ -217,7 +221,7 @@ void StaPipQBufferRenderer::setProgramsCache() {
 
 void StaPipQBufferRenderer::uploadPrograms() {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(programsPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(programsPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_PACKET);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
 }
 
@@ -367,7 +371,7 @@ void StaPipQBufferRenderer::sendPacket() {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
   // dma_wait_fast(); // This have no impact on performance
 
-  dma_channel_send_packet2(currentPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(currentPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_ALL);
 
   // Switch packet, so we can proceed during DMA transfer
   context = !context;
@@ -10,6 +10,7 @@
 */
 
 #include "renderer/3d/renderer_3d_utility.hpp"
+#include "packet2/packet2_memory.hpp"
 #include "debug/debug.hpp"
 #include <math3d.h>
 #include <draw.h>
@@ -68,7 +69,8 @@ void Renderer3DUtility::drawLine(const Vec4& from, const Vec4& to,
   auto gsColor = getGSColor(color);
 
   auto* packet =
-      packet2_create(packetSize, P2_TYPE_NORMAL, P2_MODE_CHAIN, false);
+      Packet2Memory::create(packetSize, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN,
+                            false);
 
   std::array<Vec4, vertCount> inputVerts;
   inputVerts[0] = from;
@@ -105,7 +107,7 @@ void Renderer3DUtility::drawLine(const Vec4& from, const Vec4& to,
   packet2_chain_close_tag(packet);
 
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(packet, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(packet, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
 
   packet2_free(packet);
@@ -119,7 +121,8 @@ void Renderer3DUtility::drawBBox(const CoreBBox& v, const Color& color) {
   auto gsColor = getGSColor(color);
 
   auto* packet =
-      packet2_create(packetSize, P2_TYPE_NORMAL, P2_MODE_CHAIN, false);
+      Packet2Memory::create(packetSize, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN,
+                            false);
 
   std::array<std::array<Vec4, vertCount>, stripsCount> inputVerts;
   fillBBoxVertices(inputVerts, v);
@@ -171,7 +174,7 @@ void Renderer3DUtility::drawBBox(const CoreBBox& v, const Color& color) {
   packet2_chain_close_tag(packet);
 
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(packet, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(packet, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
 
   packet2_free(packet);
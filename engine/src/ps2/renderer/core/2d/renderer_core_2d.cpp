@@ -9,6 +9,7 @@
 */
 
 #include "renderer/core/2d/renderer_core_2d.hpp"
+#include "packet2/packet2_memory.hpp"
 #include <dma.h>
 #include <draw.h>
 
@@ -16,8 +17,10 @@ namespace Tyra {
 
 RendererCore2D::RendererCore2D() {
   context = 0;
-  packets[0] = packet2_create(16, P2_TYPE_NORMAL, P2_MODE_NORMAL, 0);
-  packets[1] = packet2_create(16, P2_TYPE_NORMAL, P2_MODE_NORMAL, 0);
+  packets[0] =
+      Packet2Memory::create(16, PACKET2_MEMORY_UCAB, P2_MODE_NORMAL, 0);
+  packets[1] =
+      Packet2Memory::create(16, PACKET2_MEMORY_UCAB, P2_MODE_NORMAL, 0);
   rects[0] = new texrect_t;
   rects[1] = new texrect_t;
 
@@ -57,9 +60,11 @@ void RendererCore2D::setLod() {
 }
 
 void RendererCore2D::init(RendererSettings* t_settings,
-                          clutbuffer_t* t_clutBuffer) {
+                          clutbuffer_t* t_clutBuffer,
+                          const RendererCoreGS* t_gs) {
   settings = t_settings;
   clutBuffer = t_clutBuffer;
+  gs = t_gs;
 }
 
 void RendererCore2D::render(const Sprite& sprite,
@@ -68,6 +73,10 @@ void RendererCore2D::render(const Sprite& sprite,
   auto* rect = rects[context];
   float sizeX, sizeY;
 
+  // Sprites are in screen coords, framebuffer can be half height
+  const float scaleY = settings->getFramebufferHeight() / settings->getHeight();
+  const float fieldOffset = gs->getFieldOffset();
+
   if (sprite.mode == MODE_REPEAT) {
     sizeX = sprite.size.x;
     sizeY = sprite.size.y;
@@ -96,20 +105,18 @@ void RendererCore2D::render(const Sprite& sprite,
   rect->color.q = 0;
 
   rect->v0.x = sprite.position.x;
-  rect->v0.y = sprite.position.y;
-  // rect->v0.y /= 2.0F;  // interlacing
+  rect->v0.y = sprite.position.y * scaleY;
   rect->v0.z = (unsigned int)-1;
 
   rect->v1.x = (sprite.size.x * sprite.scale) + sprite.position.x;
-  rect->v1.y = (sprite.size.y * sprite.scale) + sprite.position.y;
-  // rect->v1.y /= 2.0F;  // interlacing
+  rect->v1.y = ((sprite.size.y * sprite.scale) + sprite.position.y) * scaleY;
   rect->v1.z = (unsigned int)-1;
 
   auto* packet = packets[context];
 
   packet2_reset(packet, false);
   packet2_update(packet, draw_primitive_xyoffset(packet->base, 0, SCREEN_CENTER,
-                                                 SCREEN_CENTER));
+                                                 SCREEN_CENTER + fieldOffset));
 
   packet2_utils_gif_add_set(packet, 1);
   packet2_utils_gs_add_lod(packet, &lod);
@@ -121,12 +128,14 @@ void RendererCore2D::render(const Sprite& sprite,
   packet2_update(packet, draw_primitive_xyoffset(
                              packet->next, 0,
                              SCREEN_CENTER - (settings->getWidth() / 2.0F),
-                             SCREEN_CENTER - (settings->getHeight() / 2.0F)));
+                             SCREEN_CENTER -
+                                 (settings->getFramebufferHeight() / 2.0F) +
+                                 fieldOffset));
   draw_disable_blending();
   packet2_update(packet, draw_finish(packet->next));
 
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(packet, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(packet, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
 
   context = !context;
 }
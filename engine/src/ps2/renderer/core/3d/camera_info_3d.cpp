@@ -27,6 +27,35 @@ CameraInfo3D::CameraInfo3D(const Vec4* t_cameraPosition,
   }
 }
 
+CameraInfo3D::CameraInfo3D(const TransformNode* t_transform) {
+  nodePosition = t_transform->getWorldPosition();
+  nodeLooksAt = t_transform->toWorld(Vec4(0.0F, 0.0F, -1.0F, 1.0F));
+  nodeUp = t_transform->toWorld(Vec4(0.0F, 1.0F, 0.0F, 0.0F));
+
+  position = &nodePosition;
+  looksAt = &nodeLooksAt;
+  up = &nodeUp;
+}
+
+CameraInfo3D::CameraInfo3D(const CameraInfo3D& other) { *this = other; }
+
+CameraInfo3D& CameraInfo3D::operator=(const CameraInfo3D& other) {
+  if (this == &other) return *this;
+
+  // Pointers into other's node storage have to point into ours
+  nodePosition = other.nodePosition;
+  nodeLooksAt = other.nodeLooksAt;
+  nodeUp = other.nodeUp;
+
+  position = other.position == &other.nodePosition ? &nodePosition
+                                                   : other.position;
+  looksAt =
+      other.looksAt == &other.nodeLooksAt ? &nodeLooksAt : other.looksAt;
+  up = other.up == &other.nodeUp ? &nodeUp : other.up;
+
+  return *this;
+}
+
 CameraInfo3D::~CameraInfo3D() {}
 
 }  // namespace Tyra
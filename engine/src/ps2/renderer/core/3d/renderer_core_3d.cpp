@@ -14,6 +14,8 @@ namespace Tyra {
 
 RendererCore3D::RendererCore3D() {
   fov = 60.0F;
+  viewportWidth = 0.0F;
+  viewportHeight = 0.0F;
   is3DSupportEnabled = false;
 }
 RendererCore3D::~RendererCore3D() {}
@@ -30,6 +32,8 @@ void RendererCore3D::update(const CameraInfo3D& cameraInfo) {
 void RendererCore3D::init(RendererSettings* t_settings, Path1* t_path1) {
   settings = t_settings;
   path1 = t_path1;
+  viewportWidth = settings->getWidth();
+  viewportHeight = settings->getFramebufferHeight();
   frustumPlanes.init(settings, fov);
   setProjection();
   TYRA_LOG("RendererCore3D initialized!");
@@ -54,11 +58,22 @@ void RendererCore3D::setFov(const float& t_fov) {
   setProjection();
 }
 
+void RendererCore3D::setViewport(const float& t_width,
+                                 const float& t_height) {
+  if (t_width == viewportWidth && t_height == viewportHeight) return;
+
+  viewportWidth = t_width;
+  viewportHeight = t_height;
+  setProjection();
+
+  if (is3DSupportEnabled) viewProj = projection * view;
+}
+
 void RendererCore3D::setProjection() {
+  // Aspect ratio stays from settings, so smaller viewport is stretched back
   projection = M4x4::perspective(
-      fov, settings->getWidth(), settings->getHeight(),
-      settings->getProjectionScale(), settings->getAspectRatio(),
-      settings->getNear(), settings->getFar());
+      fov, viewportWidth, viewportHeight, settings->getProjectionScale(),
+      settings->getAspectRatio(), settings->getNear(), settings->getFar());
 }
 
 unsigned int RendererCore3D::uploadVU1Program(VU1Program* program,
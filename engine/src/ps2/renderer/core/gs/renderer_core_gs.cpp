@@ -9,40 +9,77 @@
 */
 
 #include <dma.h>
+#include "packet2/packet2_memory.hpp"
 
 #include <draw.h>
 #include <graph.h>
 #include <gs_privileged.h>
 #include <gs_psm.h>
 #include <packet2_utils.h>
+#include <kernel.h>
 #include "debug/debug.hpp"
 #include "renderer/core/gs/renderer_core_gs.hpp"
+#include "thread/threading_vsync.hpp"
 
 namespace Tyra {
 
+framebuffer_t* RendererCoreGS::displayBuffers = nullptr;
+volatile int RendererCoreGS::displayedBuffer = 1;
+volatile int RendererCoreGS::queuedBuffer = -1;
+
 RendererCoreGS::RendererCoreGS() {
   context = 0;
   currentField = 0;
+  tripleBuffering = false;
+  droppedFrames = 0;
+  flipHandlerId = -1;
+  renderTargetWidth = 0;
+  renderTargetHeight = 0;
+  renderTargetActive = false;
+  renderTargetPacket = nullptr;
 }
 
 RendererCoreGS::~RendererCoreGS() {
+  if (flipHandlerId >= 0) {
+    DisableIntc(INTC_VBLANK_S);
+    RemoveIntcHandler(INTC_VBLANK_S, flipHandlerId);
+    EnableIntc(INTC_VBLANK_S);
+  }
+
   if (flipPacket) {
     packet2_free(flipPacket);
   }
   if (zTestPacket) {
     packet2_free(zTestPacket);
   }
+  if (renderTargetPacket) {
+    packet2_free(renderTargetPacket);
+  }
 }
 
-void RendererCoreGS::init(RendererSettings* t_settings) {
+void RendererCoreGS::init(RendererSettings* t_settings,
+                          const bool& t_tripleBuffering) {
   settings = t_settings;
+  tripleBuffering = t_tripleBuffering;
 
   initChannels();
-  flipPacket = packet2_create(4, P2_TYPE_UNCACHED_ACCL, P2_MODE_NORMAL, 0);
-  zTestPacket = packet2_create(8, P2_TYPE_NORMAL, P2_MODE_NORMAL, 0);
+  flipPacket =
+      Packet2Memory::create(8, PACKET2_MEMORY_UCAB, P2_MODE_NORMAL, 0);
+  zTestPacket =
+      Packet2Memory::create(8, PACKET2_MEMORY_UCAB, P2_MODE_NORMAL, 0);
   allocateBuffers();
   initDrawingEnvironment();
 
+  if (tripleBuffering) {
+    // Buffer 1 is shown by graph_initialize(), 0 is drawn
+    displayBuffers = frameBuffers;
+    displayedBuffer = 1;
+    queuedBuffer = -1;
+    flipHandlerId = AddIntcHandler(INTC_VBLANK_S, flipHandler, 0);
+    TYRA_ASSERT(flipHandlerId >= 0, "Failed to add flip interrupt handler!");
+    EnableIntc(INTC_VBLANK_S);
+  }
+
   TYRA_LOG("Renderer core initialized!");
 }
 
@@ -52,7 +89,8 @@ void RendererCoreGS::initChannels() {
 
 void RendererCoreGS::allocateBuffers() {
   frameBuffers[0].width = static_cast<unsigned int>(settings->getWidth());
-  frameBuffers[0].height = static_cast<unsigned int>(settings->getHeight());
+  frameBuffers[0].height =
+      static_cast<unsigned int>(settings->getFramebufferHeight());
   frameBuffers[0].mask = 0;
   frameBuffers[0].psm = GS_PSM_32;
   frameBuffers[0].address = vram.allocateBuffer(
@@ -65,6 +103,14 @@ void RendererCoreGS::allocateBuffers() {
   frameBuffers[1].address = vram.allocateBuffer(
       frameBuffers[1].width, frameBuffers[1].height, frameBuffers[1].psm);
 
+  if (tripleBuffering) {
+    frameBuffers[2] = frameBuffers[1];
+    frameBuffers[2].address = vram.allocateBuffer(
+        frameBuffers[2].width, frameBuffers[2].height, frameBuffers[2].psm);
+    TYRA_ASSERT(frameBuffers[2].address >= 0,
+                "Not enough VRAM for third framebuffer!");
+  }
+
   zBuffer.enable = DRAW_ENABLE;
   zBuffer.mask = 0;
   zBuffer.method = ZTEST_METHOD_GREATER_EQUAL;
@@ -75,16 +121,18 @@ void RendererCoreGS::allocateBuffers() {
   graph_initialize(frameBuffers[1].address, frameBuffers[1].width,
                    frameBuffers[1].height, frameBuffers[1].psm, 0, 0);
 
-  // Interlacing tests
-  // graph_set_mode(GRAPH_MODE_INTERLACED, GRAPH_MODE_NTSC, GRAPH_MODE_FRAME,
-  //                GRAPH_ENABLE);
-  // graph_set_screen(0, 0, static_cast<int>(settings->getWidth()),
-  //                  static_cast<int>(settings->getHeight()));
-  // graph_set_bgcolor(0, 0, 0);
-  // graph_set_framebuffer_filtered(frameBuffers[1].address,
-  // frameBuffers[1].width,
-  //                                frameBuffers[1].psm, 0, 0);
-  // graph_enable_output();
+  if (settings->isFieldRendering()) {
+    // Frame mode reads every line, so half height buffer fills whole field
+    graph_set_mode(GRAPH_MODE_INTERLACED, graph_get_region(), GRAPH_MODE_FRAME,
+                   GRAPH_ENABLE);
+    graph_set_screen(0, 0, static_cast<int>(settings->getWidth()),
+                     static_cast<int>(settings->getHeight()));
+    graph_set_bgcolor(0, 0, 0);
+    graph_set_framebuffer_filtered(frameBuffers[1].address,
+                                   frameBuffers[1].width, frameBuffers[1].psm,
+                                   0, 0);
+    graph_enable_output();
+  }
 
   TYRA_LOG("Framebuffers, zBuffer set and allocated!");
 }
@@ -95,19 +143,21 @@ void RendererCoreGS::enableZTests() {
                  draw_enable_tests(zTestPacket->base, 0, &zBuffer));
   packet2_update(zTestPacket, draw_finish(zTestPacket->next));
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(zTestPacket, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(zTestPacket, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
 }
 
 void RendererCoreGS::initDrawingEnvironment() {
-  packet2_t* packet2 = packet2_create(20, P2_TYPE_NORMAL, P2_MODE_NORMAL, 0);
+  packet2_t* packet2 =
+      Packet2Memory::create(20, PACKET2_MEMORY_UCAB, P2_MODE_NORMAL, 0);
   packet2_update(packet2, draw_setup_environment(packet2->base, 0, frameBuffers,
                                                  &zBuffer));
   packet2_update(packet2, draw_primitive_xyoffset(
                               packet2->next, 0,
                               screenCenter - (settings->getWidth() / 2.0F),
-                              screenCenter - (settings->getHeight() / 2.0F)));
+                              screenCenter -
+                                  (settings->getFramebufferHeight() / 2.0F)));
   packet2_update(packet2, draw_finish(packet2->next));
-  dma_channel_send_packet2(packet2, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(packet2, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
   packet2_free(packet2);
   TYRA_LOG("Drawing environment initialized!");
@@ -136,31 +186,212 @@ void RendererCoreGS::flipBuffers() {
 
   context ^= 1;
 
-  packet2_update(flipPacket,
-                 draw_framebuffer(flipPacket->base, 0, &frameBuffers[context]));
-  // Interlacing test
-  // packet2_update(
-  //     flipPacket,
-  //     setXYOffset(flipPacket->next, 0,
-  //                 screenCenter - (settings->getWidth() / 2.0F),
-  //                 screenCenter - (settings->getInterlacedHeightF() / 2.0F)));
+  if (settings->isFieldRendering()) updateCurrentField();
+
+  sendFramebuffer(context);
+}
+
+void RendererCoreGS::queueFlip(const bool& t_waitForQueue) {
+  const int drawn = context;
+  int next;
+
+  if (t_waitForQueue) {
+    // Display is one frame behind. Handler clears queue on VSync
+    while (queuedBuffer >= 0) ThreadingVSync::wait();
+  }
+
+  // Handler can't flip in the middle of choosing next buffer
+  DIntr();
+  if (queuedBuffer >= 0) {
+    // Not shown yet, so it is overwritten by next frame
+    next = queuedBuffer;
+    queuedBuffer = -1;
+    droppedFrames++;
+  } else {
+    next = 3 - displayedBuffer - drawn;
+  }
+  EIntr();
+
+  context = next;
+
+  // Path1 is fenced by caller, path3 of drawn frame by sendFramebuffer()
+  sendFramebuffer(context);
+
+  queuedBuffer = drawn;
+}
+
+int RendererCoreGS::flipHandler(int cause) {
+  const int queued = queuedBuffer;
+
+  if (queued >= 0) {
+    // Display registers are latched at VBlank, so this won't tear
+    graph_set_framebuffer_filtered(displayBuffers[queued].address,
+                                   displayBuffers[queued].width,
+                                   displayBuffers[queued].psm, 0, 0);
+    displayedBuffer = queued;
+    queuedBuffer = -1;
+  }
+
+  ExitHandler();
+  return 0;
+}
+
+void RendererCoreGS::sendFramebuffer(const unsigned char& t_buffer) {
+  packet2_update(flipPacket, draw_framebuffer(flipPacket->base, 0,
+                                              &frameBuffers[t_buffer]));
+  if (settings->isFieldRendering()) {
+    packet2_update(
+        flipPacket,
+        setXYOffset(flipPacket->next, 0,
+                    screenCenter - (settings->getWidth() / 2.0F),
+                    screenCenter - (settings->getInterlacedHeightF() / 2.0F)));
+  }
 
   packet2_update(flipPacket, draw_finish(flipPacket->next));
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(flipPacket, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(flipPacket, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
+  draw_wait_finish();
+}
+
+void RendererCoreGS::allocateRenderTarget() {
+  renderTarget = frameBuffers[0];
+  renderTarget.address = vram.allocateBuffer(
+      renderTarget.width, renderTarget.height, renderTarget.psm);
+  TYRA_ASSERT(renderTarget.address >= 0, "Not enough VRAM for render target!");
+
+  renderTargetPacket =
+      Packet2Memory::create(32, PACKET2_MEMORY_UCAB, P2_MODE_NORMAL, 0);
+
+  TYRA_LOG("Render target allocated!");
+}
+
+void RendererCoreGS::beginRenderTarget(const unsigned int& t_width,
+                                       const unsigned int& t_height) {
+  TYRA_ASSERT(renderTargetPacket, "Render target is not allocated!");
+
+  renderTargetWidth = t_width;
+  renderTargetHeight = t_height;
+
+  auto* packet = renderTargetPacket;
+  packet2_reset(packet, false);
+  packet2_update(packet, draw_framebuffer(packet->base, 0, &renderTarget));
+  packet2_update(packet, setScissor(packet->next, 0, t_width, t_height));
+  packet2_update(packet,
+                 draw_primitive_xyoffset(packet->next, 0,
+                                         screenCenter - (t_width / 2.0F),
+                                         screenCenter - (t_height / 2.0F)));
+  packet2_update(packet, draw_finish(packet->next));
+  dma_channel_wait(DMA_CHANNEL_GIF, 0);
+  Packet2Memory::send(packet, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
+  draw_wait_finish();
+
+  renderTargetActive = true;
+}
+
+void RendererCoreGS::resolveRenderTarget() {
+  if (!renderTargetActive) return;
+
+  const auto width = static_cast<unsigned int>(settings->getWidth());
+  const auto height =
+      static_cast<unsigned int>(settings->getFramebufferHeight());
+  const auto fieldOffset = getFieldOffset();
+
+  texbuffer_t texBuffer;
+  texBuffer.address = renderTarget.address;
+  texBuffer.width = renderTarget.width;
+  texBuffer.psm = renderTarget.psm;
+  texBuffer.info.width = draw_log2(renderTarget.width);
+  texBuffer.info.height = draw_log2(renderTarget.height);
+  texBuffer.info.components = TEXTURE_COMPONENTS_RGB;
+  texBuffer.info.function = TEXTURE_FUNCTION_DECAL;
+
+  clutbuffer_t clut;
+  clut.address = 0;
+  clut.psm = GS_PSM_32;
+  clut.storage_mode = CLUT_STORAGE_MODE1;
+  clut.start = 0;
+  clut.load_method = CLUT_NO_LOAD;
+
+  lod_t lod;
+  lod.calculation = LOD_USE_K;
+  lod.max_level = 0;
+  lod.mag_filter = LOD_MAG_LINEAR;
+  lod.min_filter = LOD_MIN_LINEAR;
+  lod.mipmap_select = LOD_MIPMAP_REGISTER;
+  lod.l = 0;
+  lod.k = 0.0F;
+
+  texrect_t rect;
+  rect.v0.x = 0.0F;
+  rect.v0.y = 0.0F;
+  rect.v0.z = static_cast<unsigned int>(-1);
+  rect.v1.x = static_cast<float>(width);
+  rect.v1.y = static_cast<float>(height);
+  rect.v1.z = static_cast<unsigned int>(-1);
+  rect.t0.s = 0.0F;
+  rect.t0.t = 0.0F;
+  rect.t1.s = static_cast<float>(renderTargetWidth);
+  rect.t1.t = static_cast<float>(renderTargetHeight);
+  rect.color.r = 0x80;
+  rect.color.g = 0x80;
+  rect.color.b = 0x80;
+  rect.color.a = 0x80;
+  rect.color.q = 0;
+
+  auto* packet = renderTargetPacket;
+  packet2_reset(packet, false);
+  packet2_update(packet,
+                 draw_framebuffer(packet->base, 0, &frameBuffers[context]));
+  packet2_update(packet, setScissor(packet->next, 0, width, height));
+
+  // Render target was just drawn, so GS texture cache is stale
+  packet2_update(packet, draw_texture_flush(packet->next));
+  packet2_utils_gif_add_set(packet, 1);
+  packet2_utils_gs_add_lod(packet, &lod);
+  packet2_utils_gif_add_set(packet, 1);
+  packet2_utils_gs_add_texbuff_clut(packet, &texBuffer, &clut);
+
+  // Same setup as 2D renderer (sprite coords in pixels)
+  packet2_update(packet, draw_primitive_xyoffset(packet->next, 0, screenCenter,
+                                                 screenCenter + fieldOffset));
+  packet2_update(packet, draw_rect_textured(packet->next, 0, &rect));
+  packet2_update(packet,
+                 draw_primitive_xyoffset(
+                     packet->next, 0, screenCenter - (width / 2.0F),
+                     screenCenter - (height / 2.0F) + fieldOffset));
+  packet2_update(packet, draw_finish(packet->next));
+  dma_channel_wait(DMA_CHANNEL_GIF, 0);
+  Packet2Memory::send(packet, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
   draw_wait_finish();
 
-  // Interlacing test
-  // updateCurrentField();
+  renderTargetActive = false;
+}
+
+qword_t* RendererCoreGS::setScissor(qword_t* q, const int& drawContext,
+                                    const unsigned int& width,
+                                    const unsigned int& height) {
+  PACK_GIFTAG(q, GIF_SET_TAG(1, 0, 0, 0, GIF_FLG_PACKED, 1), GIF_REG_AD);
+  q++;
+
+  PACK_GIFTAG(q, GS_SET_SCISSOR(0, width - 1, 0, height - 1),
+              GS_REG_SCISSOR + drawContext);
+  q++;
+
+  return q;
+}
+
+float RendererCoreGS::getFieldOffset() const {
+  return currentField == GRAPH_FIELD_ODD ? 0.5F : 0.0F;
 }
 
 void RendererCoreGS::updateCurrentField() {
+  // CSR holds field shown now, next frame will be shown in the other one
   if (*GS_REG_CSR & (1 << 13)) {
-    currentField = GRAPH_FIELD_ODD;
+    currentField = GRAPH_FIELD_EVEN;
     return;
   }
 
-  currentField = GRAPH_FIELD_EVEN;
+  currentField = GRAPH_FIELD_ODD;
 }
 
 }  // namespace Tyra
@@ -21,6 +21,7 @@ namespace Tyra {
 RendererCoreGSVRam::RendererCoreGSVRam() {
   touched = false;
   pointer = 0;
+  buffersSize = 0;
   cachedFreeSpace = getFreeSpaceInMB();
 }
 
@@ -62,7 +63,11 @@ int RendererCoreGSVRam::allocate(const TextureData& texData) {
 
 int RendererCoreGSVRam::allocateBuffer(const int& width, const int& height,
                                        const int& psm) {
-  return allocate(width, height, psm, GS_VRAM_BUFFER_ALIGNMENT);
+  auto result = allocate(width, height, psm, GS_VRAM_BUFFER_ALIGNMENT);
+  if (result >= 0) {
+    buffersSize += pointer - result;
+  }
+  return result;
 }
 
 int RendererCoreGSVRam::allocate(const int& width, const int& height,
@@ -9,6 +9,7 @@
 */
 
 #include "renderer/core/paths/path1/path1.hpp"
+#include "packet2/packet2_memory.hpp"
 
 extern unsigned int VU1DrawFinish_CodeStart __attribute__((section(".vudata")));
 extern unsigned int VU1DrawFinish_CodeEnd __attribute__((section(".vudata")));
@@ -16,8 +17,10 @@ extern unsigned int VU1DrawFinish_CodeEnd __attribute__((section(".vudata")));
 namespace Tyra {
 
 Path1::Path1() {
-  doubleBufferPacket = packet2_create(2, P2_TYPE_NORMAL, P2_MODE_CHAIN, true);
-  drawFinishPacket = packet2_create(10, P2_TYPE_NORMAL, P2_MODE_CHAIN, true);
+  doubleBufferPacket =
+      Packet2Memory::create(2, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, true);
+  drawFinishPacket =
+      Packet2Memory::create(10, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, true);
   uploadDrawFinishProgram();
   prepareDrawFinishPacket();
 }
@@ -33,7 +36,7 @@ void Path1::uploadDrawFinishProgram() {
                                 &VU1DrawFinish_CodeStart,
                                 &VU1DrawFinish_CodeEnd);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(packet2, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(packet2, DMA_CHANNEL_VIF1, PACKET2_FLUSH_PACKET);
   packet2_free(packet2);
 }
 
@@ -62,7 +65,7 @@ void Path1::addDrawFinishTag(packet2_t* packet) {
 
 void Path1::sendDrawFinishTag() {
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(drawFinishPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(drawFinishPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_NONE);
 }
 
 Path1::~Path1() {
@@ -91,7 +94,7 @@ unsigned int Path1::uploadProgram(VU1Program* program,
   packet2_utils_vu_add_end_tag(packet2);
 
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
-  dma_channel_send_packet2(packet2, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(packet2, DMA_CHANNEL_VIF1, PACKET2_FLUSH_PACKET);
   dma_channel_wait(DMA_CHANNEL_VIF1, 0);
 
   program->setDestinationAddress(address);
@@ -137,7 +140,7 @@ void Path1::setDoubleBuffer(const unsigned short& startingAddress,
   //          bufferSize);
 
   packet2_utils_vu_add_end_tag(doubleBufferPacket);
-  dma_channel_send_packet2(doubleBufferPacket, DMA_CHANNEL_VIF1, true);
+  Packet2Memory::send(doubleBufferPacket, DMA_CHANNEL_VIF1, PACKET2_FLUSH_NONE);
 }
 
 }  // namespace Tyra
@@ -9,12 +9,15 @@
 */
 
 #include "renderer/core/paths/path3/path3.hpp"
+#include "packet2/packet2_memory.hpp"
 
 namespace Tyra {
 
 Path3::Path3() {
-  drawFinishPacket = packet2_create(3, P2_TYPE_NORMAL, P2_MODE_CHAIN, false);
-  clearScreenPacket = packet2_create(36, P2_TYPE_NORMAL, P2_MODE_CHAIN, false);
+  drawFinishPacket =
+      Packet2Memory::create(3, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, false);
+  clearScreenPacket =
+      Packet2Memory::create(36, PACKET2_MEMORY_UCAB, P2_MODE_CHAIN, false);
   texturePacket = packet2_create(128, P2_TYPE_NORMAL, P2_MODE_CHAIN, false);
 
   packet2_chain_open_end(drawFinishPacket, 0, 0);
@@ -38,27 +41,31 @@ void Path3::init(RendererSettings* t_settings) {
 
 void Path3::sendDrawFinishTag() {
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(drawFinishPacket, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(drawFinishPacket, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
 }
 
 void Path3::clearScreen(zbuffer_t* z, const Color& color) {
+  clearScreen(z, color, settings->getWidth(), settings->getFramebufferHeight());
+}
+
+void Path3::clearScreen(zbuffer_t* z, const Color& color,
+                        const float& t_width, const float& t_height) {
   packet2_reset(clearScreenPacket, false);
   packet2_chain_open_end(clearScreenPacket, 0, 0);
   packet2_update(clearScreenPacket,
                  draw_disable_tests(clearScreenPacket->next, 0, z));
   packet2_update(
       clearScreenPacket,
-      draw_clear(clearScreenPacket->next, 0,
-                 2048.0F - (settings->getWidth() / 2),
-                 2048.0F - (settings->getHeight() / 2), settings->getWidth(),
-                 settings->getHeight(), static_cast<int>(color.r),
-                 static_cast<int>(color.g), static_cast<int>(color.b)));
+      draw_clear(clearScreenPacket->next, 0, 2048.0F - (t_width / 2),
+                 2048.0F - (t_height / 2), t_width, t_height,
+                 static_cast<int>(color.r), static_cast<int>(color.g),
+                 static_cast<int>(color.b)));
   packet2_update(clearScreenPacket,
                  draw_enable_tests(clearScreenPacket->next, 0, z));
   packet2_update(clearScreenPacket, draw_finish(clearScreenPacket->next));
   packet2_chain_close_tag(clearScreenPacket);
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(clearScreenPacket, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(clearScreenPacket, DMA_CHANNEL_GIF, PACKET2_FLUSH_NONE);
 }
 
 void Path3::sendTexture(const Texture* texture,
@@ -90,7 +97,7 @@ void Path3::sendTexture(const Texture* texture,
 
   packet2_update(texturePacket, draw_texture_flush(texturePacket->next));
   dma_channel_wait(DMA_CHANNEL_GIF, 0);
-  dma_channel_send_packet2(texturePacket, DMA_CHANNEL_GIF, true);
+  Packet2Memory::send(texturePacket, DMA_CHANNEL_GIF, PACKET2_FLUSH_ALL);
 }
 
 }  // namespace Tyra
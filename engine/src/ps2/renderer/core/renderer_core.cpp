@@ -9,39 +9,113 @@
 */
 
 #include "renderer/core/renderer_core.hpp"
-#include "thread/threading.hpp"
+#include "debug/debug.hpp"
+#include "thread/threading_vsync.hpp"
+#include "time/timer.hpp"
 
 namespace Tyra {
 
-RendererCore::RendererCore() { isFrameLimitOn = true; }
+RendererCore::RendererCore() {
+  isFrameLimitOn = true;
+  isDynamicResolutionOn = false;
+  isScaledFrame = false;
+}
 RendererCore::~RendererCore() {}
 
-void RendererCore::init() {
+void RendererCore::init(const RendererOptions& t_options) {
+  // Queued frame can be shown in any field, so its offset would be wrong
+  auto tripleBuffering = t_options.tripleBuffering;
+  if (t_options.fieldRendering && tripleBuffering) {
+    TYRA_WARN("Triple buffering is turned off, field rendering is on");
+    tripleBuffering = false;
+  }
+  settings.setFieldRendering(t_options.fieldRendering);
+
   path3.init(&settings);
   sync.init(&path3, &path1);
-  gs.init(&settings);
+  gs.init(&settings, tripleBuffering);
+
+  // Before any texture, VRAM is freed in FIFO order
+  if (t_options.dynamicResolution) initDynamicResolution(t_options);
+
   texture.init(&gs, &path3);
   renderer3D.init(&settings, &path1);
-  renderer2D.init(&settings, &texture.clut);
+  renderer2D.init(&settings, &texture.clut, &gs);
+}
+
+void RendererCore::initDynamicResolution(const RendererOptions& t_options) {
+  gs.allocateRenderTarget();
+
+  auto targetTime = t_options.targetFrameTime;
+  if (targetTime == 0) {
+    targetTime =
+        static_cast<unsigned int>(0.9F * 1000000.0F / Timer::getRefreshRate());
+  }
+
+  dynamicResolution.init(targetTime, t_options.minResolutionScale);
+  isDynamicResolutionOn = true;
 }
 
 void RendererCore::setClearScreenColor(const Color& color) { bgColor = color; }
 
 void RendererCore::beginFrame() {
   renderer3D.update();
-  Threading::switchThread();
   path3.clearScreen(&gs.zBuffer, bgColor);
 }
 
 void RendererCore::beginFrame(const CameraInfo3D& cameraInfo) {
+  if (!isDynamicResolutionOn) {
+    renderer3D.update(cameraInfo);
+    path3.clearScreen(&gs.zBuffer, bgColor);
+    return;
+  }
+
+  frameTimer.prime();
+
+  // Rounded to 16 pixels, same as scale step at 512 width
+  const auto width = dynamicResolution.getScaledSize(
+      static_cast<unsigned int>(settings.getWidth()), 16);
+  const auto height = dynamicResolution.getScaledSize(
+      static_cast<unsigned int>(settings.getFramebufferHeight()), 16);
+
+  renderer3D.setViewport(width, height);
   renderer3D.update(cameraInfo);
-  Threading::switchThread();
-  path3.clearScreen(&gs.zBuffer, bgColor);
+  gs.beginRenderTarget(width, height);
+  path3.clearScreen(&gs.zBuffer, bgColor, width, height);
+  isScaledFrame = true;
+}
+
+void RendererCore::resolve3D() {
+  if (!gs.isRenderTargetActive()) return;
+
+  // 3D is sent over VIF1 (path1), it has to land before target is read
+  sync.align3D();
+  gs.resolveRenderTarget();
+  renderer3D.setViewport(settings.getWidth(), settings.getFramebufferHeight());
 }
 
 void RendererCore::endFrame() {
-  Threading::switchThread();
-  if (isFrameLimitOn) graph_wait_vsync();
+  if (isScaledFrame) {
+    resolve3D();
+    isScaledFrame = false;
+
+    // Busy time = EE submit + GS draw (both paths), without VSync wait
+    sync.align3D();
+    sync.align2D();
+    dynamicResolution.update(Timer::toMicroseconds(frameTimer.getTimeDelta()));
+  }
+
+  if (gs.isTripleBuffering()) {
+    // VU1 output (path1) of drawn frame can't land in the next buffer
+    sync.align3D();
+
+    // Frame limit off -> newest frame replaces one not yet shown
+    gs.queueFlip(isFrameLimitOn);
+    return;
+  }
+
+  // Main thread sleeps, so audio/loader threads can work
+  if (isFrameLimitOn) ThreadingVSync::wait();
   gs.flipBuffers();
 }
 
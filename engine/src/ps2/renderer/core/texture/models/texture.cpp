@@ -40,11 +40,13 @@ Texture::Texture(TextureBuilderData* t_data) {
               "Texture width/height should be 8/16/32/64/128/256/512!");
 
   core = new TextureData(t_data->data, t_data->bpp, t_data->gsComponents,
-                         t_data->width, t_data->height);
+                         t_data->width, t_data->height,
+                         t_data->isMemoryTracked);
 
   clut =
       new TextureData(t_data->clut, t_data->clutBpp, t_data->clutGsComponents,
-                      t_data->clutWidth, t_data->clutHeight);
+                      t_data->clutWidth, t_data->clutHeight,
+                      t_data->isMemoryTracked);
 
   setDefaultWrapSettings();
 }
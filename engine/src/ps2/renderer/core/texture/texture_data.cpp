@@ -10,6 +10,7 @@
 
 #include "renderer/core/texture/texture_data.hpp"
 #include "debug/debug.hpp"
+#include "memory/memory.hpp"
 #include <gs_psm.h>
 #include <draw_buffers.h>
 
@@ -17,17 +18,23 @@ namespace Tyra {
 
 TextureData::TextureData(unsigned char* t_data, const TextureBpp& t_bpp,
                          const unsigned char& t_gsComponents,
-                         const int& t_width, const int& t_height) {
+                         const int& t_width, const int& t_height,
+                         const bool& t_isMemoryTracked) {
   data = t_data;
   bpp = t_bpp;
   components = t_gsComponents;
   width = t_width;
   height = t_height;
   psm = getPsmByBpp(t_bpp);
+  isMemoryTracked = t_isMemoryTracked;
 }
 
 TextureData::~TextureData() {
-  if (data) {
+  if (!data) return;
+
+  if (isMemoryTracked) {
+    Memory::free(data);
+  } else {
     delete[] data;
   }
 }
@@ -109,6 +109,45 @@ Texture* TextureRepository::add(const char* fullpath) {
   return texture;
 }
 
+Texture* TextureRepository::add(ArchiveReader& archive,
+                                const std::string& name) {
+  TextureLoader& loader = texLoaderSelector.getLoaderByFileName(name);
+
+  auto file = archive.read(name);
+  auto* data = loader.load(file.data, file.size, name);
+  Texture* texture = new Texture(data);
+  delete data;
+
+  textures.push_back(texture);
+  return texture;
+}
+
+void TextureRepository::addByMesh(const Mesh* mesh, ArchiveReader& archive,
+                                  const std::string& directory,
+                                  const char* extension) {
+  auto& loader = texLoaderSelector.getLoaderByExtension(extension);
+
+  std::string dirFixed = directory;
+  if (!dirFixed.empty() && dirFixed.back() != '/') dirFixed += "/";
+
+  for (unsigned int i = 0; i < mesh->materials.size(); i++) {
+    if (!mesh->materials[i]->textureName.has_value()) {
+      continue;
+    }
+
+    std::string name =
+        dirFixed + mesh->materials[i]->textureName.value() + "." + extension;
+
+    auto file = archive.read(name);
+    auto* data = loader.load(file.data, file.size, name);
+    Texture* texture = new Texture(data);
+    delete data;
+
+    texture->addLink(mesh->materials[i]->id);
+    textures.push_back(texture);
+  }
+}
+
 void TextureRepository::addByMesh(const Mesh* mesh, const char* directory,
                                   const char* extension) {
   auto& loader = texLoaderSelector.getLoaderByExtension(extension);
@@ -9,14 +9,15 @@
 */
 
 #include "renderer/renderer.hpp"
+#include "packet2/packet2_memory.hpp"
 
 namespace Tyra {
 
 Renderer::Renderer() {}
 Renderer::~Renderer() {}
 
-void Renderer::init() {
-  core.init();
+void Renderer::init(const RendererOptions& t_options) {
+  core.init(t_options);
   renderer2D.init(&core);
   renderer3D.init(&core);
 }
@@ -30,6 +31,7 @@ void Renderer::beginFrame(const CameraInfo3D& cameraInfo) {
 void Renderer::endFrame() {
   core.endFrame();
   renderer3D.onFrameEnd();
+  Packet2Memory::onFrameEnd();
 }
 
 }  // namespace Tyra
@@ -23,6 +23,7 @@ void RendererSettings::copy(RendererSettings* out, const RendererSettings* in) {
   out->aspectRatio = in->aspectRatio;
   out->interlacedHeightF = in->interlacedHeightF;
   out->interlacedHeightUI = in->interlacedHeightUI;
+  out->fieldRendering = in->fieldRendering;
 }
 
 void RendererSettings::set(const RendererSettings& v) { copy(this, &v); }
@@ -41,7 +42,8 @@ std::string RendererSettings::getPrint() const {
   res << "far: " << far << ", ";
   res << "projectionScale: " << projectionScale << ", ";
   res << "aspectRatio: " << aspectRatio << ", ";
-  res << "interlaced height: " << interlacedHeightF;
+  res << "interlaced height: " << interlacedHeightF << ", ";
+  res << "field rendering: " << fieldRendering;
   res << ")";
   return res.str();
 }
@@ -0,0 +1,199 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "terrain/terrain.hpp"
+#include "debug/debug.hpp"
+
+namespace Tyra {
+
+Terrain::Terrain(const unsigned short* t_heights, const unsigned int& t_width,
+                 const unsigned int& t_depth, const TerrainOptions& t_options)
+    : heightfield(t_heights, t_width, t_depth, t_options.cellSize,
+                  t_options.heightScale, t_options.heightOffset),
+      options(t_options) {
+  TYRA_ASSERT((t_width - 1) % t_options.chunkSize == 0 &&
+                  (t_depth - 1) % t_options.chunkSize == 0,
+              "Terrain size - 1 must be multiple of chunk size");
+  TYRA_ASSERT((1U << (t_options.lodCount - 1)) <= t_options.chunkSize,
+              "Too many LOD levels for chunk size");
+
+  position = Vec4(0.0F, 0.0F, 0.0F, 1.0F);
+  lastRenderedChunks = 0;
+
+  chunksX = TerrainGeomipmap::getChunksCount(t_width, options.chunkSize);
+  chunksZ = TerrainGeomipmap::getChunksCount(t_depth, options.chunkSize);
+  chunks.resize(chunksX * chunksZ);
+  lods.resize(chunks.size());
+
+  for (unsigned int z = 0; z < chunksZ; z++) {
+    for (unsigned int x = 0; x < chunksX; x++) {
+      auto& chunk = chunks[z * chunksX + x];
+      chunk.lod = 0xFF;
+      for (unsigned int i = 0; i < TERRAIN_EDGES_COUNT; i++)
+        chunk.neighborLods[i] = 0;
+      chunk.count = 0;
+      chunk.vertices = nullptr;
+      chunk.uvs = nullptr;
+
+      const int x0 = x * options.chunkSize;
+      const int z0 = z * options.chunkSize;
+      const int x1 = x0 + options.chunkSize;
+      const int z1 = z0 + options.chunkSize;
+
+      float minY, maxY;
+      heightfield.getRange(x0, z0, x1, z1, &minY, &maxY);
+
+      Vec4 corners[8];
+      for (unsigned int i = 0; i < 8; i++) {
+        corners[i] = Vec4((i & 1 ? x1 : x0) * options.cellSize,
+                          i & 2 ? maxY : minY,
+                          (i & 4 ? z1 : z0) * options.cellSize, 1.0F);
+      }
+      chunk.bbox = new CoreBBox(corners, 8);
+    }
+  }
+}
+
+Terrain::~Terrain() {
+  for (auto& chunk : chunks) {
+    delete[] chunk.vertices;
+    delete[] chunk.uvs;
+    delete chunk.bbox;
+  }
+}
+
+float Terrain::getHeight(const Vec4& t_position) const {
+  return heightfield.getHeight(t_position.x - position.x,
+                               t_position.z - position.z) +
+         position.y;
+}
+
+Vec4 Terrain::getNormal(const Vec4& t_position) const {
+  Vec4 result;
+  heightfield.getNormal(t_position.x - position.x, t_position.z - position.z,
+                        result.xyzw);
+  return result;
+}
+
+void Terrain::getHeights(const Vec4* t_positions, const unsigned int& t_count,
+                         float* o_heights) const {
+  for (unsigned int i = 0; i < t_count; i++) {
+    o_heights[i] = getHeight(t_positions[i]);
+  }
+}
+
+unsigned int Terrain::getLod(const int& t_x, const int& t_z,
+                             const unsigned int& t_default) const {
+  if (t_x < 0 || t_z < 0 || t_x >= static_cast<int>(chunksX) ||
+      t_z >= static_cast<int>(chunksZ)) {
+    return t_default;
+  }
+
+  return lods[t_z * chunksX + t_x];
+}
+
+void Terrain::update(const Vec4& t_cameraPosition) {
+  TerrainGeomipmap::selectLods(
+      heightfield, options.chunkSize, t_cameraPosition.x - position.x,
+      t_cameraPosition.z - position.z, options.lodDistance, options.lodCount,
+      lods.data());
+
+  for (unsigned int z = 0; z < chunksZ; z++) {
+    for (unsigned int x = 0; x < chunksX; x++) {
+      auto& chunk = chunks[z * chunksX + x];
+      const unsigned int lod = lods[z * chunksX + x];
+
+      const unsigned int neighbors[TERRAIN_EDGES_COUNT] = {
+          getLod(x - 1, z, lod), getLod(x + 1, z, lod), getLod(x, z - 1, lod),
+          getLod(x, z + 1, lod)};
+
+      bool isChanged = chunk.lod != lod;
+      for (unsigned int i = 0; i < TERRAIN_EDGES_COUNT; i++) {
+        isChanged |= chunk.neighborLods[i] != neighbors[i];
+        chunk.neighborLods[i] = neighbors[i];
+      }
+
+      if (isChanged) {
+        chunk.lod = lod;
+        buildChunk(x, z);
+      }
+    }
+  }
+}
+
+void Terrain::buildChunk(const unsigned int& t_x, const unsigned int& t_z) {
+  auto& chunk = chunks[t_z * chunksX + t_x];
+  const auto count =
+      TerrainGeomipmap::getVertexCount(options.chunkSize, chunk.lod);
+
+  if (count != chunk.count) {
+    delete[] chunk.vertices;
+    delete[] chunk.uvs;
+    chunk.vertices = new Vec4[count];
+    chunk.uvs = options.texture ? new Vec4[count] : nullptr;
+    chunk.count = count;
+  }
+
+  TerrainGeomipmap::buildChunk(
+      heightfield, t_x, t_z, options.chunkSize, chunk.lod, chunk.neighborLods,
+      chunk.vertices->xyzw, chunk.uvs ? chunk.uvs->xyzw : nullptr,
+      options.uvScale);
+}
+
+void Terrain::render(StaticPipeline* t_pipeline, const Plane* t_frustumPlanes,
+                     const StaPipOptions& t_options) {
+  model = M4x4::Identity;
+  model.translate(position);
+
+  StaPipInfoBag info;
+  info.antiAliasingEnabled = t_options.antiAliasingEnabled;
+  info.blendingEnabled = t_options.blendingEnabled;
+  info.shadingType = t_options.shadingType;
+  info.textureMappingType = t_options.textureMappingType;
+  info.transformationType = t_options.transformationType;
+  info.frustumCulling =
+      t_options.frustumCulling == PipelineFrustumCulling_Precise
+          ? PipelineInfoBagFrustumCulling_Precise
+          : PipelineInfoBagFrustumCulling_None;
+  info.fullClipChecks = t_options.fullClipChecks;
+  info.zTestType = t_options.zTestType;
+  info.model = &model;
+
+  StaPipColorBag color;
+  color.single = &options.color;
+
+  StaPipTextureBag texture;
+  texture.texture = options.texture;
+
+  lastRenderedChunks = 0;
+
+  for (auto& chunk : chunks) {
+    if (chunk.count == 0) continue;
+
+    if (chunk.bbox->frustumCheck(t_frustumPlanes, model) ==
+        CoreBBoxFrustum::OUTSIDE_FRUSTUM) {
+      continue;
+    }
+
+    texture.coordinates = chunk.uvs;
+
+    StaPipBag bag;
+    bag.count = chunk.count;
+    bag.vertices = chunk.vertices;
+    bag.info = &info;
+    bag.color = &color;
+    bag.texture = options.texture ? &texture : nullptr;
+
+    t_pipeline->core.render(&bag);
+    lastRenderedChunks++;
+  }
+}
+
+}  // namespace Tyra
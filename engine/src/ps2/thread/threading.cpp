@@ -10,10 +10,16 @@
 
 #include "thread/threading.hpp"
 #include <time.h>
+#include <kernel.h>
 
 namespace Tyra {
 
 timespec Threading::tv = {0, 0};
+const int Threading::mainThreadPriority = 0x20;
+
+void Threading::init() {
+  ChangeThreadPriority(GetThreadId(), mainThreadPriority);
+}
 
 void Threading::sleep(const unsigned int& ms) {
   tv.tv_sec = ms / 1000;
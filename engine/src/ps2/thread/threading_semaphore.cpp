@@ -0,0 +1,49 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "thread/threading_semaphore.hpp"
+#include "debug/debug.hpp"
+#include <kernel.h>
+
+namespace Tyra {
+
+ThreadingSemaphore::ThreadingSemaphore() { id = -1; }
+
+ThreadingSemaphore::~ThreadingSemaphore() {
+  if (id >= 0) DeleteSema(id);
+}
+
+void ThreadingSemaphore::init(const int& t_initCount, const int& t_maxCount) {
+  TYRA_ASSERT(id < 0, "Semaphore was already initialized!");
+
+  ee_sema_t sema;
+  sema.init_count = t_initCount;
+  sema.max_count = t_maxCount;
+  sema.option = 0;
+  id = CreateSema(&sema);
+
+  TYRA_ASSERT(id >= 0, "Failed to create semaphore!");
+}
+
+void ThreadingSemaphore::wait() { WaitSema(id); }
+
+bool ThreadingSemaphore::tryWait() { return PollSema(id) >= 0; }
+
+void ThreadingSemaphore::signal() { SignalSema(id); }
+
+void ThreadingSemaphore::signalFromInterrupt() { iSignalSema(id); }
+
+int ThreadingSemaphore::getCount() const {
+  ee_sema_t status;
+  ReferSemaStatus(id, &status);
+  return status.count;
+}
+
+}  // namespace Tyra
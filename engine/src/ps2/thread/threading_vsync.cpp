@@ -0,0 +1,54 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "thread/threading_vsync.hpp"
+#include "debug/debug.hpp"
+#include <kernel.h>
+
+namespace Tyra {
+
+int ThreadingVSync::handlerId = -1;
+volatile unsigned int ThreadingVSync::count = 0;
+volatile unsigned int ThreadingVSync::waitersCount = 0;
+int ThreadingVSync::waiters[ThreadingVSync::maxWaiters];
+
+void ThreadingVSync::init() {
+  if (handlerId >= 0) return;
+
+  handlerId = AddIntcHandler(INTC_VBLANK_S, handler, 0);
+  TYRA_ASSERT(handlerId >= 0, "Failed to add VBlank interrupt handler!");
+  EnableIntc(INTC_VBLANK_S);
+}
+
+void ThreadingVSync::wait() {
+  if (handlerId < 0) init();
+
+  // Registration can't be interrupted by handler in the middle
+  DIntr();
+  TYRA_ASSERT(waitersCount < maxWaiters, "Too many VSync waiting threads!");
+  waiters[waitersCount++] = GetThreadId();
+  EIntr();
+
+  // Wakeup requests are counted by the kernel, so if VBlank happened
+  // between EIntr() and here, SleepThread() returns immediately.
+  SleepThread();
+}
+
+int ThreadingVSync::handler(int cause) {
+  count++;
+
+  for (unsigned int i = 0; i < waitersCount; i++) iWakeupThread(waiters[i]);
+  waitersCount = 0;
+
+  ExitHandler();
+  return 0;
+}
+
+}  // namespace Tyra
@@ -9,9 +9,12 @@
 */
 
 #include "time/timer.hpp"
+#include <graph.h>
 
 namespace Tyra {
 
+int Timer::region = -1;
+
 Timer::Timer() { prime(); }
 
 Timer::~Timer() {}
@@ -26,4 +29,14 @@ unsigned int Timer::getTimeDelta() {
   return change;
 }
 
+bool Timer::isPal() {
+  // Region check reads ROM version, so it is done once
+  if (region < 0) region = graph_get_region();
+  return region == GRAPH_MODE_PAL;
+}
+
+float Timer::getTicksPerSecond() { return isPal() ? 15625.0F : 15734.264F; }
+
+float Timer::getRefreshRate() { return isPal() ? 50.0F : 59.94F; }
+
 }  // namespace Tyra
@@ -0,0 +1,205 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "archive/archive_file.hpp"
+#include "utils/hash.hpp"
+#include "utils/lz.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace Tyra {
+
+const unsigned int ArchiveFile::version = 1;
+const unsigned int ArchiveFile::sectorSize = 2048;
+const unsigned int ArchiveFile::minCompressionGain = 8;
+
+std::string ArchiveFile::normalizeName(const std::string& t_name) {
+  std::string result = t_name;
+  for (auto& c : result) {
+    if (c == '\\') c = '/';
+    if (c >= 'A' && c <= 'Z') c = c - 'A' + 'a';
+  }
+  while (result.compare(0, 2, "./") == 0) result.erase(0, 2);
+  while (!result.empty() && result[0] == '/') result.erase(0, 1);
+  return result;
+}
+
+unsigned int ArchiveFile::getNameHash(const std::string& t_name) {
+  return Hash::fnv1a(normalizeName(t_name).c_str());
+}
+
+unsigned int ArchiveFile::align(const unsigned int& value) {
+  return (value + sectorSize - 1) / sectorSize * sectorSize;
+}
+
+bool ArchiveFile::validateHeader(const unsigned char* t_data,
+                                 const unsigned int& t_size) {
+  if (t_size < sizeof(ArchiveHeader)) return false;
+
+  const auto* header = getHeader(t_data);
+  return memcmp(header->magic, "TYAR", 4) == 0 && header->version == version;
+}
+
+bool ArchiveFile::validate(const unsigned char* t_data,
+                           const unsigned int& t_size,
+                           const unsigned int& t_fileSize) {
+  if (!validateHeader(t_data, t_size)) return false;
+
+  const auto* header = getHeader(t_data);
+  const unsigned int tocEnd =
+      sizeof(ArchiveHeader) + header->count * sizeof(ArchiveEntry);
+  if (header->count > t_fileSize / sizeof(ArchiveEntry) ||
+      tocEnd > header->dataOffset || header->dataOffset > t_size ||
+      header->dataOffset > t_fileSize)
+    return false;
+
+  const auto* entries = getEntries(t_data);
+  for (unsigned int i = 0; i < header->count; i++) {
+    const auto& entry = entries[i];
+    if (entry.offset < header->dataOffset || entry.size > t_fileSize ||
+        entry.offset > t_fileSize - entry.size)
+      return false;
+    if (entry.compression == ARCHIVE_COMPRESSION_NONE &&
+        entry.size != entry.unpackedSize)
+      return false;
+    if (entry.compression > ARCHIVE_COMPRESSION_LZ) return false;
+    if (i > 0 && entries[i - 1].nameHash >= entry.nameHash) return false;
+  }
+
+  return true;
+}
+
+const ArchiveHeader* ArchiveFile::getHeader(const unsigned char* t_data) {
+  return reinterpret_cast<const ArchiveHeader*>(t_data);
+}
+
+const ArchiveEntry* ArchiveFile::getEntries(const unsigned char* t_data) {
+  return reinterpret_cast<const ArchiveEntry*>(t_data + sizeof(ArchiveHeader));
+}
+
+const ArchiveEntry* ArchiveFile::find(const unsigned char* t_data,
+                                      const unsigned int& t_nameHash) {
+  const auto* entries = getEntries(t_data);
+  const auto* end = entries + getHeader(t_data)->count;
+
+  const auto* result = std::lower_bound(
+      entries, end, t_nameHash,
+      [](const ArchiveEntry& entry, const unsigned int& hash) {
+        return entry.nameHash < hash;
+      });
+
+  return result != end && result->nameHash == t_nameHash ? result : nullptr;
+}
+
+std::vector<ArchiveReadSpan> ArchiveFile::planReads(
+    std::vector<const ArchiveEntry*> t_entries, const unsigned int& t_maxGap,
+    const unsigned int& t_maxSpanSize) {
+  std::sort(t_entries.begin(), t_entries.end(),
+            [](const ArchiveEntry* a, const ArchiveEntry* b) {
+              return a->offset < b->offset;
+            });
+
+  std::vector<ArchiveReadSpan> result;
+  for (const auto* entry : t_entries) {
+    if (!result.empty()) {
+      auto& last = result.back();
+      const unsigned int lastEnd = last.offset + last.size;
+
+      if (entry->offset < lastEnd) {  // Duplicate
+        if (entry != last.entries.back()) last.entries.push_back(entry);
+        continue;
+      }
+
+      const unsigned int newSize = entry->offset + entry->size - last.offset;
+      if (entry->offset - lastEnd <= t_maxGap && newSize <= t_maxSpanSize) {
+        last.size = newSize;
+        last.entries.push_back(entry);
+        continue;
+      }
+    }
+
+    ArchiveReadSpan span;
+    span.offset = entry->offset;
+    span.size = entry->size;
+    span.entries.push_back(entry);
+    result.push_back(span);
+  }
+
+  return result;
+}
+
+std::vector<unsigned char> ArchiveFile::build(
+    const std::vector<ArchiveSource>& t_sources) {
+  const unsigned int count = t_sources.size();
+  const unsigned int dataOffset =
+      align(sizeof(ArchiveHeader) + count * sizeof(ArchiveEntry));
+
+  std::vector<std::vector<unsigned char>> packed(count);
+  std::vector<ArchiveEntry> entries(count);
+
+  // Data is written in sources order, which should match loading order
+  unsigned int size = dataOffset;
+  for (unsigned int i = 0; i < count; i++) {
+    const auto& source = t_sources[i];
+    auto& entry = entries[i];
+    memset(&entry, 0, sizeof(ArchiveEntry));
+
+    entry.nameHash = getNameHash(source.name);
+    entry.unpackedSize = source.data.size();
+    entry.compression = ARCHIVE_COMPRESSION_NONE;
+
+    if (source.compress && !source.data.empty()) {
+      auto compressed = Lz::compress(source.data.data(), source.data.size());
+      if (compressed.size() <=
+          source.data.size() - source.data.size() / minCompressionGain) {
+        entry.compression = ARCHIVE_COMPRESSION_LZ;
+        packed[i] = std::move(compressed);
+      }
+    }
+
+    entry.size = entry.compression == ARCHIVE_COMPRESSION_NONE
+                     ? source.data.size()
+                     : packed[i].size();
+    entry.offset = size;
+    size = align(size + entry.size);
+  }
+
+  std::vector<unsigned char> result(size, 0);
+  for (unsigned int i = 0; i < count; i++) {
+    const auto& data = entries[i].compression == ARCHIVE_COMPRESSION_NONE
+                           ? t_sources[i].data
+                           : packed[i];
+    if (!data.empty())
+      memcpy(result.data() + entries[i].offset, data.data(), data.size());
+  }
+
+  std::sort(entries.begin(), entries.end(),
+            [](const ArchiveEntry& a, const ArchiveEntry& b) {
+              return a.nameHash < b.nameHash;
+            });
+
+  for (unsigned int i = 1; i < count; i++)
+    if (entries[i - 1].nameHash == entries[i].nameHash) return {};
+
+  ArchiveHeader header;
+  memcpy(header.magic, "TYAR", 4);
+  header.version = version;
+  header.count = count;
+  header.dataOffset = dataOffset;
+  memcpy(result.data(), &header, sizeof(ArchiveHeader));
+
+  if (count > 0)
+    memcpy(result.data() + sizeof(ArchiveHeader), entries.data(),
+           count * sizeof(ArchiveEntry));
+
+  return result;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,96 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/audio_stream_ring.hpp"
+
+namespace Tyra {
+
+AudioStreamRing::AudioStreamRing() {
+  slots = nullptr;
+  count = 0;
+  writeIndex = 0;
+  readIndex = 0;
+  stats = nullptr;
+  generation = 0;
+  consumerGeneration = 0;
+  primed = false;
+}
+
+AudioStreamRing::~AudioStreamRing() {}
+
+void AudioStreamRing::init(AudioStreamSlot* t_slots,
+                           const unsigned int& t_count,
+                           AudioStreamStats* t_stats) {
+  slots = t_slots;
+  count = t_count;
+  stats = t_stats;
+
+  for (unsigned int i = 0; i < count; i++) {
+    slots[i].size = 0;
+    slots[i].generation = 0;
+    slots[i].last = false;
+    slots[i].wrapped = false;
+  }
+
+  freeSlots.init(count, count);
+  filledSlots.init(0, count);
+}
+
+AudioStreamSlot* AudioStreamRing::beginWrite() {
+  freeSlots.wait();
+  return &slots[writeIndex];
+}
+
+bool AudioStreamRing::endWrite(const unsigned int& t_generation,
+                               const bool& t_end, const bool& t_loop) {
+  auto* slot = &slots[writeIndex];
+  slot->generation = t_generation;
+  slot->last = t_end;
+
+  // Empty slot can't loop, otherwise empty data would spin forever
+  slot->wrapped = t_end && t_loop && slot->size > 0;
+
+  writeIndex = (writeIndex + 1) % count;
+  filledSlots.signal();
+
+  return slot->wrapped;
+}
+
+AudioStreamSlot* AudioStreamRing::acquire() {
+  while (true) {
+    if (consumerGeneration != generation) {
+      consumerGeneration = generation;
+      primed = false;
+    }
+
+    const unsigned int filled = filledSlots.getCount();
+    if (primed && filled < stats->minFilledSlots)
+      stats->minFilledSlots = filled;
+
+    if (!filledSlots.tryWait()) {
+      if (primed) stats->underruns++;
+      filledSlots.wait();
+    }
+
+    auto* slot = &slots[readIndex];
+    readIndex = (readIndex + 1) % count;
+
+    if (isCurrent(slot)) {
+      primed = !slot->last || slot->wrapped;
+      return slot;
+    }
+
+    release();
+  }
+}
+
+void AudioStreamRing::release() { freeSlots.signal(); }
+
+}  // namespace Tyra
@@ -0,0 +1,168 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/ima_adpcm.hpp"
+
+namespace Tyra {
+
+const short ImaAdpcm::stepTable[89] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+
+const signed char ImaAdpcm::indexTable[16] = {-1, -1, -1, -1, 2, 4, 6, 8,
+                                              -1, -1, -1, -1, 2, 4, 6, 8};
+
+unsigned int ImaAdpcm::getSamplesPerBlock(const unsigned int& t_blockAlign,
+                                          const unsigned int& t_channels) {
+  return (t_blockAlign - 4 * t_channels) * 2 / t_channels + 1;
+}
+
+short ImaAdpcm::decodeNibble(const unsigned char& nibble, int* predictor,
+                             int* index) {
+  const int step = stepTable[*index];
+
+  int diff = step >> 3;
+  if (nibble & 1) diff += step >> 2;
+  if (nibble & 2) diff += step >> 1;
+  if (nibble & 4) diff += step;
+
+  *predictor += (nibble & 8) ? -diff : diff;
+  if (*predictor > 32767)
+    *predictor = 32767;
+  else if (*predictor < -32768)
+    *predictor = -32768;
+
+  *index += indexTable[nibble];
+  if (*index < 0)
+    *index = 0;
+  else if (*index > 88)
+    *index = 88;
+
+  return static_cast<short>(*predictor);
+}
+
+unsigned char ImaAdpcm::encodeSample(const short& sample, int* predictor,
+                                     int* index) {
+  int diff = sample - *predictor;
+  unsigned char nibble = 0;
+  if (diff < 0) {
+    nibble = 8;
+    diff = -diff;
+  }
+
+  int step = stepTable[*index];
+  if (diff >= step) {
+    nibble |= 4;
+    diff -= step;
+  }
+  step >>= 1;
+  if (diff >= step) {
+    nibble |= 2;
+    diff -= step;
+  }
+  step >>= 1;
+  if (diff >= step) nibble |= 1;
+
+  // Keep encoder state exactly as decoder will see it
+  decodeNibble(nibble, predictor, index);
+
+  return nibble;
+}
+
+unsigned int ImaAdpcm::decodeBlock(const unsigned char* t_block,
+                                   const unsigned int& t_size,
+                                   const unsigned int& t_channels,
+                                   short* o_samples) {
+  const unsigned int headerSize = 4 * t_channels;
+  if (t_channels > maxChannels || t_size < headerSize) return 0;
+
+  int predictors[maxChannels];
+  int indexes[maxChannels];
+
+  for (unsigned int ch = 0; ch < t_channels; ch++) {
+    const unsigned char* header = t_block + 4 * ch;
+    predictors[ch] = static_cast<short>(header[0] | (header[1] << 8));
+    indexes[ch] = header[2] > 88 ? 88 : header[2];
+    o_samples[ch] = static_cast<short>(predictors[ch]);
+  }
+
+  const unsigned int groups = (t_size - headerSize) / headerSize;
+  const unsigned char* data = t_block + headerSize;
+
+  for (unsigned int group = 0; group < groups; group++) {
+    for (unsigned int ch = 0; ch < t_channels; ch++) {
+      short* out = o_samples + (1 + group * 8) * t_channels + ch;
+
+      for (unsigned int i = 0; i < 4; i++) {
+        const unsigned char byte = *data++;
+        *out = decodeNibble(byte & 0x0F, &predictors[ch], &indexes[ch]);
+        out += t_channels;
+        *out = decodeNibble(byte >> 4, &predictors[ch], &indexes[ch]);
+        out += t_channels;
+      }
+    }
+  }
+
+  return 1 + groups * 8;
+}
+
+void ImaAdpcm::encodeBlock(const short* t_pcm, const unsigned int& t_samples,
+                           const unsigned int& t_blockAlign,
+                           const unsigned int& t_channels,
+                           unsigned char* io_indexes, unsigned char* o_block) {
+  const unsigned int headerSize = 4 * t_channels;
+  const unsigned int samplesPerBlock =
+      getSamplesPerBlock(t_blockAlign, t_channels);
+  if (t_channels > maxChannels) return;
+
+  int predictors[maxChannels];
+  int indexes[maxChannels];
+
+  for (unsigned int ch = 0; ch < t_channels; ch++) {
+    predictors[ch] = t_samples > 0 ? t_pcm[ch] : 0;
+    indexes[ch] = io_indexes[ch] > 88 ? 88 : io_indexes[ch];
+
+    unsigned char* header = o_block + 4 * ch;
+    header[0] = predictors[ch] & 0xFF;
+    header[1] = (predictors[ch] >> 8) & 0xFF;
+    header[2] = indexes[ch];
+    header[3] = 0;
+  }
+
+  const unsigned int groups = (t_blockAlign - headerSize) / headerSize;
+  unsigned char* data = o_block + headerSize;
+
+  for (unsigned int group = 0; group < groups; group++) {
+    for (unsigned int ch = 0; ch < t_channels; ch++) {
+      for (unsigned int i = 0; i < 4; i++) {
+        unsigned char nibbles[2];
+        for (unsigned int j = 0; j < 2; j++) {
+          const unsigned int sample = 1 + group * 8 + i * 2 + j;
+          const short value = sample < t_samples && sample < samplesPerBlock
+                                  ? t_pcm[sample * t_channels + ch]
+                                  : 0;
+          nibbles[j] = encodeSample(value, &predictors[ch], &indexes[ch]);
+        }
+        *data++ = nibbles[0] | (nibbles[1] << 4);
+      }
+    }
+  }
+
+  for (unsigned int ch = 0; ch < t_channels; ch++) io_indexes[ch] = indexes[ch];
+}
+
+}  // namespace Tyra
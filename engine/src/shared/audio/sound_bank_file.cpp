@@ -0,0 +1,100 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/sound_bank_file.hpp"
+#include "utils/hash.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+const unsigned int SoundBankFile::version = 1;
+const unsigned int SoundBankFile::alignment = 64;
+
+bool SoundBankFile::validate(const unsigned char* t_data,
+                             const unsigned int& t_size) {
+  if (t_size < sizeof(SoundBankHeader)) return false;
+
+  const auto* header = reinterpret_cast<const SoundBankHeader*>(t_data);
+  if (memcmp(header->magic, "TYSB", 4) != 0 || header->version != version)
+    return false;
+
+  // Divided, because count * size could overflow
+  if (header->count >
+      (t_size - sizeof(SoundBankHeader)) / sizeof(SoundBankEntry))
+    return false;
+
+  const unsigned int tableEnd =
+      sizeof(SoundBankHeader) + header->count * sizeof(SoundBankEntry);
+
+  const auto* entries = getEntries(t_data);
+  for (unsigned int i = 0; i < header->count; i++)
+    if (entries[i].offset < tableEnd || entries[i].size > t_size ||
+        entries[i].offset > t_size - entries[i].size)
+      return false;
+
+  return true;
+}
+
+unsigned int SoundBankFile::getCount(const unsigned char* t_data) {
+  return reinterpret_cast<const SoundBankHeader*>(t_data)->count;
+}
+
+const SoundBankEntry* SoundBankFile::getEntries(const unsigned char* t_data) {
+  return reinterpret_cast<const SoundBankEntry*>(t_data +
+                                                 sizeof(SoundBankHeader));
+}
+
+const SoundBankEntry* SoundBankFile::find(const unsigned char* t_data,
+                                          const unsigned int& t_nameHash) {
+  const auto* entries = getEntries(t_data);
+  const unsigned int count = getCount(t_data);
+  for (unsigned int i = 0; i < count; i++)
+    if (entries[i].nameHash == t_nameHash) return &entries[i];
+  return nullptr;
+}
+
+std::vector<unsigned char> SoundBankFile::build(
+    const std::vector<SoundBankSource>& t_sources) {
+  const unsigned int tableEnd =
+      sizeof(SoundBankHeader) + t_sources.size() * sizeof(SoundBankEntry);
+
+  unsigned int size = tableEnd;
+  std::vector<SoundBankEntry> entries(t_sources.size());
+  for (unsigned int i = 0; i < t_sources.size(); i++) {
+    size = (size + alignment - 1) / alignment * alignment;
+    entries[i].nameHash = Hash::fnv1a(t_sources[i].name.c_str());
+    entries[i].offset = size;
+    entries[i].size = t_sources[i].data.size();
+    entries[i].reserved = 0;
+    size += entries[i].size;
+  }
+
+  std::vector<unsigned char> result(size, 0);
+
+  SoundBankHeader header;
+  memcpy(header.magic, "TYSB", 4);
+  header.version = version;
+  header.count = t_sources.size();
+  header.reserved = 0;
+  memcpy(result.data(), &header, sizeof(SoundBankHeader));
+
+  if (!entries.empty())
+    memcpy(result.data() + sizeof(SoundBankHeader), entries.data(),
+           entries.size() * sizeof(SoundBankEntry));
+
+  for (unsigned int i = 0; i < t_sources.size(); i++)
+    if (entries[i].size > 0)
+      memcpy(result.data() + entries[i].offset, t_sources[i].data.data(),
+             entries[i].size);
+
+  return result;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,172 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/voice_manager.hpp"
+
+namespace Tyra {
+
+VoiceManager::VoiceManager() {
+  backend = nullptr;
+  firstChannel = 0;
+  channelsCount = 0;
+  tick = 0;
+  minAudibleVolume = 1;
+
+  for (unsigned int i = 0; i < maxChannels; i++) voices[i].active = false;
+  for (unsigned int i = 0; i < maxCategories; i++)
+    categoryLimits[i] = maxChannels;
+
+  resetStats();
+}
+
+VoiceManager::~VoiceManager() {}
+
+void VoiceManager::init(VoiceBackend* t_backend,
+                        const unsigned int& t_firstChannel,
+                        const unsigned int& t_count) {
+  backend = t_backend;
+  firstChannel = t_firstChannel;
+  channelsCount = t_count > maxChannels ? maxChannels : t_count;
+
+  for (unsigned int i = 0; i < maxChannels; i++) voices[i].active = false;
+}
+
+void VoiceManager::setCategoryLimit(const unsigned char& t_category,
+                                    const unsigned int& t_limit) {
+  if (t_category < maxCategories) categoryLimits[t_category] = t_limit;
+}
+
+void VoiceManager::resetStats() {
+  stats.played = 0;
+  stats.stolen = 0;
+  stats.culled = 0;
+  stats.rejected = 0;
+}
+
+void VoiceManager::refresh() {
+  for (unsigned int i = 0; i < channelsCount; i++)
+    if (voices[i].active &&
+        !backend->isPlaying(firstChannel + i, voices[i].sample))
+      voices[i].active = false;
+}
+
+unsigned int VoiceManager::getActiveCount() const {
+  unsigned int result = 0;
+  for (unsigned int i = 0; i < channelsCount; i++)
+    if (voices[i].active) result++;
+  return result;
+}
+
+unsigned int VoiceManager::getCategoryCount(
+    const unsigned char& category) const {
+  unsigned int result = 0;
+  for (unsigned int i = 0; i < channelsCount; i++)
+    if (voices[i].active && voices[i].category == category) result++;
+  return result;
+}
+
+int VoiceManager::findFree() const {
+  for (unsigned int i = 0; i < channelsCount; i++)
+    if (!voices[i].active) return i;
+  return -1;
+}
+
+/** Least important, then oldest voice, which is not above request. */
+int VoiceManager::findVictim(const VoiceRequest& request,
+                             const bool& sameCategory) const {
+  int result = -1;
+  for (unsigned int i = 0; i < channelsCount; i++) {
+    const Voice& voice = voices[i];
+    if (!voice.active || voice.priority > request.priority) continue;
+    if (sameCategory && voice.category != request.category) continue;
+
+    if (result == -1 || voice.priority < voices[result].priority ||
+        (voice.priority == voices[result].priority &&
+         voice.startTick < voices[result].startTick))
+      result = i;
+  }
+  return result;
+}
+
+unsigned char VoiceManager::getAudibleVolume(
+    const VoiceRequest& request) const {
+  if (request.maxDistance <= 0.0F) return request.volume;
+  if (request.distance >= request.maxDistance) return 0;
+
+  const float falloff = 1.0F - request.distance / request.maxDistance;
+  return static_cast<unsigned char>(request.volume * falloff);
+}
+
+VoiceResult VoiceManager::play(void* t_sample, const VoiceRequest& t_request,
+                               int* o_channel) {
+  if (backend == nullptr || channelsCount == 0) return VOICE_ERROR;
+
+  const unsigned char volume = getAudibleVolume(t_request);
+  if (volume < minAudibleVolume) {
+    stats.culled++;
+    return VOICE_CULLED;
+  }
+
+  const unsigned char category =
+      t_request.category < maxCategories ? t_request.category : 0;
+  const unsigned int limit = categoryLimits[category];
+
+  bool needsRefresh = getCategoryCount(category) >= limit || findFree() == -1;
+  if (needsRefresh) refresh();
+
+  int index = -1;
+  bool isStolen = false;
+
+  if (getCategoryCount(category) >= limit) {
+    if (limit == 0) {
+      stats.rejected++;
+      return VOICE_REJECTED;
+    }
+    index = findVictim(t_request, true);
+    isStolen = index != -1;
+  } else {
+    index = findFree();
+    if (index == -1) {
+      index = findVictim(t_request, false);
+      isStolen = index != -1;
+    }
+  }
+
+  if (index == -1) {
+    stats.rejected++;
+    return VOICE_REJECTED;
+  }
+
+  const int channel = firstChannel + index;
+  backend->setVolume(channel, volume);
+  if (!backend->play(channel, t_sample)) {
+    voices[index].active = false;
+    return VOICE_ERROR;
+  }
+
+  Voice& voice = voices[index];
+  voice.sample = t_sample;
+  voice.priority = t_request.priority;
+  voice.category = category;
+  voice.startTick = tick++;
+  voice.active = true;
+
+  if (o_channel) *o_channel = channel;
+
+  stats.played++;
+  if (isStolen) {
+    stats.stolen++;
+    return VOICE_STOLEN;
+  }
+
+  return VOICE_PLAYED;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,142 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "audio/wav_parser.hpp"
+#include "audio/ima_adpcm.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+unsigned int WavParser::readU32(const unsigned char* data) {
+  return data[0] | (data[1] << 8) | (data[2] << 16) |
+         (static_cast<unsigned int>(data[3]) << 24);
+}
+
+unsigned short WavParser::readU16(const unsigned char* data) {
+  return data[0] | (data[1] << 8);
+}
+
+void WavParser::writeU32(unsigned char* data, const unsigned int& value) {
+  data[0] = value & 0xFF;
+  data[1] = (value >> 8) & 0xFF;
+  data[2] = (value >> 16) & 0xFF;
+  data[3] = (value >> 24) & 0xFF;
+}
+
+void WavParser::writeU16(unsigned char* data, const unsigned short& value) {
+  data[0] = value & 0xFF;
+  data[1] = (value >> 8) & 0xFF;
+}
+
+bool WavParser::parse(const unsigned char* t_data, const unsigned int& t_size,
+                      const unsigned int& t_fileSize, WavInfo* o_info) {
+  if (t_size < 12 || memcmp(t_data, "RIFF", 4) != 0 ||
+      memcmp(t_data + 8, "WAVE", 4) != 0)
+    return false;
+
+  bool fmtFound = false;
+  unsigned int offset = 12;
+
+  while (offset + 8 <= t_size) {
+    const unsigned char* chunk = t_data + offset;
+    const unsigned int chunkSize = readU32(chunk + 4);
+
+    if (memcmp(chunk, "fmt ", 4) == 0) {
+      if (chunkSize < 16 || offset + 8 + 16 > t_size) return false;
+
+      const unsigned char* fmt = chunk + 8;
+      o_info->format = readU16(fmt);
+      o_info->channels = readU16(fmt + 2);
+      o_info->sampleRate = readU32(fmt + 4);
+      o_info->blockAlign = readU16(fmt + 12);
+      o_info->bitsPerSample = readU16(fmt + 14);
+      o_info->samplesPerBlock = 0;
+
+      if (o_info->format == WAV_FORMAT_IMA_ADPCM && o_info->channels > 0 &&
+          o_info->blockAlign >= 4 * o_info->channels)
+        o_info->samplesPerBlock = ImaAdpcm::getSamplesPerBlock(
+            o_info->blockAlign, o_info->channels);
+
+      fmtFound = true;
+    } else if (memcmp(chunk, "data", 4) == 0) {
+      if (!fmtFound) return false;
+
+      o_info->dataOffset = offset + 8;
+      o_info->dataSize = chunkSize;
+
+      if (t_fileSize > 0) {
+        const unsigned int available =
+            t_fileSize > o_info->dataOffset ? t_fileSize - o_info->dataOffset
+                                            : 0;
+        if (o_info->dataSize > available) o_info->dataSize = available;
+      }
+
+      return isSupported(*o_info);
+    }
+
+    // Chunk past end of header would also wrap offset around
+    if (chunkSize > t_size - offset - 8) return false;
+
+    // Chunks are word aligned
+    offset += 8 + chunkSize + (chunkSize & 1);
+  }
+
+  return false;
+}
+
+bool WavParser::isSupported(const WavInfo& t_info) {
+  if (t_info.channels < 1 || t_info.channels > ImaAdpcm::maxChannels ||
+      t_info.sampleRate == 0)
+    return false;
+
+  if (t_info.format == WAV_FORMAT_PCM)
+    return t_info.bitsPerSample == 16 || t_info.bitsPerSample == 8;
+
+  if (t_info.format == WAV_FORMAT_IMA_ADPCM)
+    return t_info.bitsPerSample == 4 && t_info.samplesPerBlock > 0;
+
+  return false;
+}
+
+unsigned int WavParser::write(const WavInfo& t_info, unsigned char* o_data) {
+  const bool isAdpcm = t_info.format == WAV_FORMAT_IMA_ADPCM;
+  const unsigned int fmtSize = isAdpcm ? 20 : 16;
+  const unsigned int headerSize = 12 + 8 + fmtSize + 8;
+  const unsigned int bytesPerSecond =
+      isAdpcm ? t_info.sampleRate * t_info.blockAlign / t_info.samplesPerBlock
+              : t_info.sampleRate * t_info.blockAlign;
+
+  unsigned char* data = o_data;
+  memcpy(data, "RIFF", 4);
+  writeU32(data + 4, headerSize - 8 + t_info.dataSize);
+  memcpy(data + 8, "WAVE", 4);
+  data += 12;
+
+  memcpy(data, "fmt ", 4);
+  writeU32(data + 4, fmtSize);
+  writeU16(data + 8, t_info.format);
+  writeU16(data + 10, t_info.channels);
+  writeU32(data + 12, t_info.sampleRate);
+  writeU32(data + 16, bytesPerSecond);
+  writeU16(data + 20, t_info.blockAlign);
+  writeU16(data + 22, t_info.bitsPerSample);
+  if (isAdpcm) {
+    writeU16(data + 24, 2);
+    writeU16(data + 26, t_info.samplesPerBlock);
+  }
+  data += 8 + fmtSize;
+
+  memcpy(data, "data", 4);
+  writeU32(data + 4, t_info.dataSize);
+
+  return headerSize;
+}
+
+}  // namespace Tyra
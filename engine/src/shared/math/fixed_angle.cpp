@@ -0,0 +1,119 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/fixed_angle.hpp"
+#include <cmath>
+
+namespace Tyra {
+
+float FixedAngle::sinTable[FixedAngle::sinTableSize + 1];
+float FixedAngle::atanTable[FixedAngle::atanTableSize + 1];
+bool FixedAngle::areTablesInitialized = false;
+
+static const double twoPi = 6.283185307179586;
+static const float radiansToUnits = 65536.0F / 6.283185307179586F;
+static const float unitsToRadians = 6.283185307179586F / 65536.0F;
+
+void FixedAngle::initTables() {
+  for (unsigned int i = 0; i <= sinTableSize; i++) {
+    sinTable[i] = static_cast<float>(std::sin(twoPi * i / sinTableSize));
+  }
+
+  // atan(ratio) in units, ratio in <0, 1>
+  for (unsigned int i = 0; i <= atanTableSize; i++) {
+    const double ratio = static_cast<double>(i) / atanTableSize;
+    atanTable[i] = static_cast<float>(std::atan(ratio) * unitsPerTurn / twoPi);
+  }
+
+  areTablesInitialized = true;
+}
+
+float FixedAngle::lookupSin(const unsigned short& t_value) {
+  if (!areTablesInitialized) initTables();
+
+  const unsigned int fractionBits = 16 - sinTableBits;
+  const unsigned int index = t_value >> fractionBits;
+  const unsigned int mask = (1 << fractionBits) - 1;
+  const float fraction =
+      static_cast<float>(t_value & mask) / (1 << fractionBits);
+
+  const float a = sinTable[index];
+  return a + (sinTable[index + 1] - a) * fraction;
+}
+
+FixedAngle FixedAngle::fromRadians(const float& t_radians) {
+  // Wrap in float first, int conversion of big values is undefined
+  float turns = t_radians / static_cast<float>(twoPi);
+  turns -= floorf(turns);
+
+  const auto units = static_cast<unsigned int>(turns * unitsPerTurn + 0.5F);
+  return FixedAngle(static_cast<unsigned short>(units));
+}
+
+FixedAngle FixedAngle::fromDegrees(const float& t_degrees) {
+  float turns = t_degrees / 360.0F;
+  turns -= floorf(turns);
+
+  const auto units = static_cast<unsigned int>(turns * unitsPerTurn + 0.5F);
+  return FixedAngle(static_cast<unsigned short>(units));
+}
+
+FixedAngle FixedAngle::atan2(const float& t_y, const float& t_x) {
+  if (!areTablesInitialized) initTables();
+
+  const float absX = fabsf(t_x);
+  const float absY = fabsf(t_y);
+
+  if (absX == 0.0F && absY == 0.0F) return FixedAngle(0);
+
+  const bool isSteep = absY > absX;
+  const float ratio = (isSteep ? absX / absY : absY / absX) * atanTableSize;
+  const auto index = static_cast<unsigned int>(ratio);
+  const float fraction = ratio - index;
+
+  float units = atanTable[index];
+  if (index < atanTableSize) units += (atanTable[index + 1] - units) * fraction;
+
+  // Octant: quarter turn = 16384 units
+  if (isSteep) units = 16384.0F - units;
+  if (t_x < 0.0F) units = 32768.0F - units;
+  if (t_y < 0.0F) units = -units;
+
+  return FixedAngle(static_cast<unsigned short>(
+      static_cast<int>(units + (units < 0.0F ? -0.5F : 0.5F))));
+}
+
+float FixedAngle::toRadians() const { return value * unitsToRadians; }
+
+float FixedAngle::toDegrees() const { return value * (360.0F / unitsPerTurn); }
+
+float FixedAngle::toSignedRadians() const {
+  return static_cast<short>(value) * unitsToRadians;
+}
+
+float FixedAngle::sin() const { return lookupSin(value); }
+
+float FixedAngle::cos() const {
+  return lookupSin(static_cast<unsigned short>(value + 16384));
+}
+
+void FixedAngle::sinCos(float* o_sin, float* o_cos) const {
+  *o_sin = sin();
+  *o_cos = cos();
+}
+
+void FixedAngle::sinCos(const FixedAngle* t_angles, float* o_sin,
+                        float* o_cos, const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    t_angles[i].sinCos(&o_sin[i], &o_cos[i]);
+  }
+}
+
+}  // namespace Tyra
@@ -0,0 +1,231 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/quat_math.hpp"
+#include <cmath>
+
+namespace Tyra {
+
+void QuatMath::multiply(float* o_result, const float* t_a, const float* t_b) {
+  const float x = t_a[3] * t_b[0] + t_a[0] * t_b[3] + t_a[1] * t_b[2] -
+                  t_a[2] * t_b[1];
+  const float y = t_a[3] * t_b[1] + t_a[1] * t_b[3] + t_a[2] * t_b[0] -
+                  t_a[0] * t_b[2];
+  const float z = t_a[3] * t_b[2] + t_a[2] * t_b[3] + t_a[0] * t_b[1] -
+                  t_a[1] * t_b[0];
+  const float w = t_a[3] * t_b[3] - t_a[0] * t_b[0] - t_a[1] * t_b[1] -
+                  t_a[2] * t_b[2];
+
+  o_result[0] = x;
+  o_result[1] = y;
+  o_result[2] = z;
+  o_result[3] = w;
+}
+
+float QuatMath::dot(const float* t_a, const float* t_b) {
+  return t_a[0] * t_b[0] + t_a[1] * t_b[1] + t_a[2] * t_b[2] +
+         t_a[3] * t_b[3];
+}
+
+void QuatMath::normalize(float* t_quat) {
+  const float lengthSq = dot(t_quat, t_quat);
+
+  if (lengthSq <= 0.0F) {
+    t_quat[0] = t_quat[1] = t_quat[2] = 0.0F;
+    t_quat[3] = 1.0F;
+    return;
+  }
+
+  const float inv = 1.0F / sqrtf(lengthSq);
+  for (int i = 0; i < 4; i++) t_quat[i] *= inv;
+}
+
+void QuatMath::conjugate(float* o_result, const float* t_quat) {
+  o_result[0] = -t_quat[0];
+  o_result[1] = -t_quat[1];
+  o_result[2] = -t_quat[2];
+  o_result[3] = t_quat[3];
+}
+
+void QuatMath::rotate(float* o_result, const float* t_quat,
+                      const float* t_vector) {
+  // v' = v + w * t + q.xyz x t, where t = 2 * (q.xyz x v)
+  const float* q = t_quat;
+  const float* v = t_vector;
+
+  const float tx = 2.0F * (q[1] * v[2] - q[2] * v[1]);
+  const float ty = 2.0F * (q[2] * v[0] - q[0] * v[2]);
+  const float tz = 2.0F * (q[0] * v[1] - q[1] * v[0]);
+
+  const float x = v[0] + q[3] * tx + q[1] * tz - q[2] * ty;
+  const float y = v[1] + q[3] * ty + q[2] * tx - q[0] * tz;
+  const float z = v[2] + q[3] * tz + q[0] * ty - q[1] * tx;
+
+  o_result[0] = x;
+  o_result[1] = y;
+  o_result[2] = z;
+  o_result[3] = v[3];
+}
+
+void QuatMath::nlerp(float* o_result, const float* t_a, const float* t_b,
+                     const float& t_interp) {
+  const float sign = dot(t_a, t_b) < 0.0F ? -1.0F : 1.0F;
+
+  for (int i = 0; i < 4; i++) {
+    o_result[i] = t_a[i] + (sign * t_b[i] - t_a[i]) * t_interp;
+  }
+
+  normalize(o_result);
+}
+
+void QuatMath::slerp(float* o_result, const float* t_a, const float* t_b,
+                     const float& t_interp) {
+  float cosTheta = dot(t_a, t_b);
+  float sign = 1.0F;
+
+  if (cosTheta < 0.0F) {
+    cosTheta = -cosTheta;
+    sign = -1.0F;
+  }
+
+  if (cosTheta > slerpThreshold) {
+    nlerp(o_result, t_a, t_b, t_interp);
+    return;
+  }
+
+  const float theta = acosf(cosTheta);
+  const float invSin = 1.0F / sinf(theta);
+  const float wa = sinf((1.0F - t_interp) * theta) * invSin;
+  const float wb = sign * sinf(t_interp * theta) * invSin;
+
+  for (int i = 0; i < 4; i++) o_result[i] = wa * t_a[i] + wb * t_b[i];
+}
+
+void QuatMath::fromAxisAngle(float* o_result, const float* t_axis,
+                             const float& t_radians) {
+  const float lengthSq =
+      t_axis[0] * t_axis[0] + t_axis[1] * t_axis[1] + t_axis[2] * t_axis[2];
+
+  if (lengthSq <= 0.0F) {
+    o_result[0] = o_result[1] = o_result[2] = 0.0F;
+    o_result[3] = 1.0F;
+    return;
+  }
+
+  const float s = sinf(t_radians * 0.5F) / sqrtf(lengthSq);
+  o_result[0] = t_axis[0] * s;
+  o_result[1] = t_axis[1] * s;
+  o_result[2] = t_axis[2] * s;
+  o_result[3] = cosf(t_radians * 0.5F);
+}
+
+void QuatMath::fromMatrix(float* o_result, const float* t_matrix) {
+  // m(row, column) = t_matrix[column * 4 + row]
+  const float* m = t_matrix;
+  const float trace = m[0] + m[5] + m[10];
+
+  if (trace > 0.0F) {
+    const float s = 0.5F / sqrtf(trace + 1.0F);
+    o_result[0] = (m[6] - m[9]) * s;
+    o_result[1] = (m[8] - m[2]) * s;
+    o_result[2] = (m[1] - m[4]) * s;
+    o_result[3] = 0.25F / s;
+  } else if (m[0] > m[5] && m[0] > m[10]) {
+    const float s = 2.0F * sqrtf(1.0F + m[0] - m[5] - m[10]);
+    o_result[0] = 0.25F * s;
+    o_result[1] = (m[4] + m[1]) / s;
+    o_result[2] = (m[8] + m[2]) / s;
+    o_result[3] = (m[6] - m[9]) / s;
+  } else if (m[5] > m[10]) {
+    const float s = 2.0F * sqrtf(1.0F + m[5] - m[0] - m[10]);
+    o_result[0] = (m[4] + m[1]) / s;
+    o_result[1] = 0.25F * s;
+    o_result[2] = (m[9] + m[6]) / s;
+    o_result[3] = (m[8] - m[2]) / s;
+  } else {
+    const float s = 2.0F * sqrtf(1.0F + m[10] - m[0] - m[5]);
+    o_result[0] = (m[8] + m[2]) / s;
+    o_result[1] = (m[9] + m[6]) / s;
+    o_result[2] = 0.25F * s;
+    o_result[3] = (m[1] - m[4]) / s;
+  }
+
+  normalize(o_result);
+}
+
+void QuatMath::toMatrix(float* o_matrix, const float* t_quat) {
+  const float x = t_quat[0], y = t_quat[1], z = t_quat[2], w = t_quat[3];
+  const float xx = x * x, yy = y * y, zz = z * z;
+  const float xy = x * y, xz = x * z, yz = y * z;
+  const float wx = w * x, wy = w * y, wz = w * z;
+
+  o_matrix[0] = 1.0F - 2.0F * (yy + zz);
+  o_matrix[1] = 2.0F * (xy + wz);
+  o_matrix[2] = 2.0F * (xz - wy);
+  o_matrix[3] = 0.0F;
+
+  o_matrix[4] = 2.0F * (xy - wz);
+  o_matrix[5] = 1.0F - 2.0F * (xx + zz);
+  o_matrix[6] = 2.0F * (yz + wx);
+  o_matrix[7] = 0.0F;
+
+  o_matrix[8] = 2.0F * (xz + wy);
+  o_matrix[9] = 2.0F * (yz - wx);
+  o_matrix[10] = 1.0F - 2.0F * (xx + yy);
+  o_matrix[11] = 0.0F;
+
+  o_matrix[12] = 0.0F;
+  o_matrix[13] = 0.0F;
+  o_matrix[14] = 0.0F;
+  o_matrix[15] = 1.0F;
+}
+
+void QuatMath::lookRotation(float* o_result, const float* t_forward,
+                            const float* t_up) {
+  // Basis columns: z = -forward, x = up x z, y = z x x
+  float z[3] = {-t_forward[0], -t_forward[1], -t_forward[2]};
+  float lengthSq = z[0] * z[0] + z[1] * z[1] + z[2] * z[2];
+
+  if (lengthSq <= 0.0F) {
+    o_result[0] = o_result[1] = o_result[2] = 0.0F;
+    o_result[3] = 1.0F;
+    return;
+  }
+
+  float inv = 1.0F / sqrtf(lengthSq);
+  for (int i = 0; i < 3; i++) z[i] *= inv;
+
+  float x[3] = {t_up[1] * z[2] - t_up[2] * z[1],
+                t_up[2] * z[0] - t_up[0] * z[2],
+                t_up[0] * z[1] - t_up[1] * z[0]};
+  lengthSq = x[0] * x[0] + x[1] * x[1] + x[2] * x[2];
+
+  if (lengthSq <= 0.000001F) {
+    // Up parallel to forward - pick any perpendicular axis
+    const float other[3] = {fabsf(z[0]) < 0.9F ? 1.0F : 0.0F,
+                            fabsf(z[0]) < 0.9F ? 0.0F : 1.0F, 0.0F};
+    x[0] = other[1] * z[2] - other[2] * z[1];
+    x[1] = other[2] * z[0] - other[0] * z[2];
+    x[2] = other[0] * z[1] - other[1] * z[0];
+    lengthSq = x[0] * x[0] + x[1] * x[1] + x[2] * x[2];
+  }
+
+  inv = 1.0F / sqrtf(lengthSq);
+  for (int i = 0; i < 3; i++) x[i] *= inv;
+
+  const float y[3] = {z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2],
+                      z[0] * x[1] - z[1] * x[0]};
+
+  const float matrix[16] = {x[0], x[1], x[2], 0.0F, y[0], y[1], y[2], 0.0F,
+                            z[0], z[1], z[2], 0.0F, 0.0F, 0.0F, 0.0F, 1.0F};
+  fromMatrix(o_result, matrix);
+}
+
+}  // namespace Tyra
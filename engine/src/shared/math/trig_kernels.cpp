@@ -0,0 +1,213 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/trig_kernels.hpp"
+#include <cmath>
+
+namespace Tyra {
+
+// 2PI split into exact high part (8 bits of mantissa) and remainder,
+// so t * 2PI is subtracted without losing precision (Cody-Waite)
+static const float inv2Pi = 0.159154943091895F;
+static const float invPi = 0.318309886183791F;
+static const float twoPiHi = 6.28125F;
+static const float twoPiLo = 0.0019353071795864769F;
+static const float halfPi = 1.5707963267948966F;
+static const float pi = 3.1415926535897932F;
+
+// Taylor series of sin up to x^11, error < 6e-8 in <-PI/2, PI/2>
+static const float sin3 = -1.0F / 6.0F;
+static const float sin5 = 1.0F / 120.0F;
+static const float sin7 = -1.0F / 5040.0F;
+static const float sin9 = 1.0F / 362880.0F;
+static const float sin11 = -1.0F / 39916800.0F;
+
+// Minimax of atan in <0, 1>, error < 1e-5
+static const float atan1 = 0.9998660F;
+static const float atan3 = -0.3302995F;
+static const float atan5 = 0.1801410F;
+static const float atan7 = -0.0851330F;
+static const float atan9 = 0.0208351F;
+
+#ifdef __mips__
+
+static const float sinCosConstants[16] __attribute__((aligned(16))) = {
+    inv2Pi, twoPiHi, twoPiLo, invPi,   halfPi, 2.0F, 0.0F, 0.0F,
+    sin3,   sin5,    sin7,    sin9,    sin11,  0.0F, 0.0F, 0.0F};
+
+#endif
+
+float TrigKernels::reduce(const float& t_radians) {
+  // Truncation (like VU0 FTOI0) leaves r in (-2PI, 2PI),
+  // second pass with 1/PI moves it to <-PI, PI>
+  float t = static_cast<float>(static_cast<int>(t_radians * inv2Pi));
+  float r = (t_radians - t * twoPiHi) - t * twoPiLo;
+
+  t = static_cast<float>(static_cast<int>(r * invPi));
+  return (r - t * twoPiHi) - t * twoPiLo;
+}
+
+float TrigKernels::reducedSin(const float& t_radians) {
+  // Mirror (PI/2, 3PI/2) and (-3PI/2, -PI/2) into <-PI/2, PI/2>
+  // without branches: y = x - 2 * (max(x - PI/2, 0) + min(x + PI/2, 0))
+  const float above = fmaxf(t_radians - halfPi, 0.0F);
+  const float below = fminf(t_radians + halfPi, 0.0F);
+  const float y = t_radians - 2.0F * (above + below);
+
+  const float y2 = y * y;
+  float p = y2 * sin11 + sin9;
+  p = p * y2 + sin7;
+  p = p * y2 + sin5;
+  p = p * y2 + sin3;
+  p = p * y2;
+  return y + y * p;
+}
+
+void TrigKernels::sinCos(const float& t_radians, float* o_sin,
+                         float* o_cos) {
+  const float r = reduce(t_radians);
+  *o_sin = reducedSin(r);
+  *o_cos = reducedSin(r + halfPi);
+}
+
+void TrigKernels::sinCos(const float* t_radians, float* o_sin, float* o_cos,
+                         const unsigned int& t_count) {
+#ifdef __mips__
+  auto isAligned = [](const void* t_pointer) {
+    return (reinterpret_cast<unsigned int>(t_pointer) & 0xF) == 0;
+  };
+
+  if (!isAligned(t_radians) || !isAligned(o_sin) || !isAligned(o_cos)) {
+    sinCosScalar(t_radians, o_sin, o_cos, t_count);
+    return;
+  }
+
+  const unsigned int vectors = t_count / 4;
+  for (unsigned int i = 0; i < vectors; i++) {
+    // vf10 = (1/2PI, 2PI hi, 2PI lo, 1/PI), vf11 = (PI/2, 2, 0, 0)
+    // vf12 = (s3, s5, s7, s9), vf13 = (s11, 0, 0, 0)
+    // vf3 = sin argument, vf4 = cos argument, both mirrored and
+    // evaluated with the same polynomial as reducedSin()
+    asm volatile(
+        "lqc2           $vf10, 0x00(%3)         \n\t"
+        "lqc2           $vf11, 0x10(%3)         \n\t"
+        "lqc2           $vf12, 0x20(%3)         \n\t"
+        "lqc2           $vf13, 0x30(%3)         \n\t"
+        "lqc2           $vf1, 0x00(%0)          \n\t"
+        // first reduction, 1/2PI
+        "vmulx.xyzw     $vf2, $vf1, $vf10x      \n\t"
+        "vftoi0.xyzw    $vf2, $vf2              \n\t"
+        "vitof0.xyzw    $vf2, $vf2              \n\t"
+        "vmulaw.xyzw    $ACC, $vf1, $vf0w       \n\t"
+        "vmsubay.xyzw   $ACC, $vf2, $vf10y      \n\t"
+        "vmsubz.xyzw    $vf3, $vf2, $vf10z      \n\t"
+        // second reduction, 1/PI
+        "vmulw.xyzw     $vf2, $vf3, $vf10w      \n\t"
+        "vftoi0.xyzw    $vf2, $vf2              \n\t"
+        "vitof0.xyzw    $vf2, $vf2              \n\t"
+        "vmulaw.xyzw    $ACC, $vf3, $vf0w       \n\t"
+        "vmsubay.xyzw   $ACC, $vf2, $vf10y      \n\t"
+        "vmsubz.xyzw    $vf3, $vf2, $vf10z      \n\t"
+        // cos(x) = sin(x + PI/2)
+        "vaddx.xyzw     $vf4, $vf3, $vf11x      \n\t"
+        // mirror sin argument
+        "vsubx.xyzw     $vf5, $vf3, $vf11x      \n\t"
+        "vmaxz.xyzw     $vf5, $vf5, $vf11z      \n\t"
+        "vaddx.xyzw     $vf6, $vf3, $vf11x      \n\t"
+        "vminiz.xyzw    $vf6, $vf6, $vf11z      \n\t"
+        "vadd.xyzw      $vf5, $vf5, $vf6        \n\t"
+        "vmulaw.xyzw    $ACC, $vf3, $vf0w       \n\t"
+        "vmsuby.xyzw    $vf3, $vf5, $vf11y      \n\t"
+        // mirror cos argument
+        "vsubx.xyzw     $vf5, $vf4, $vf11x      \n\t"
+        "vmaxz.xyzw     $vf5, $vf5, $vf11z      \n\t"
+        "vaddx.xyzw     $vf6, $vf4, $vf11x      \n\t"
+        "vminiz.xyzw    $vf6, $vf6, $vf11z      \n\t"
+        "vadd.xyzw      $vf5, $vf5, $vf6        \n\t"
+        "vmulaw.xyzw    $ACC, $vf4, $vf0w       \n\t"
+        "vmsuby.xyzw    $vf4, $vf5, $vf11y      \n\t"
+        // polynomials, both interleaved
+        "vmul.xyzw      $vf5, $vf3, $vf3        \n\t"
+        "vmul.xyzw      $vf6, $vf4, $vf4        \n\t"
+        "vmulx.xyzw     $vf7, $vf5, $vf13x      \n\t"
+        "vmulx.xyzw     $vf8, $vf6, $vf13x      \n\t"
+        "vaddw.xyzw     $vf7, $vf7, $vf12w      \n\t"
+        "vaddw.xyzw     $vf8, $vf8, $vf12w      \n\t"
+        "vmul.xyzw      $vf7, $vf7, $vf5        \n\t"
+        "vmul.xyzw      $vf8, $vf8, $vf6        \n\t"
+        "vaddz.xyzw     $vf7, $vf7, $vf12z      \n\t"
+        "vaddz.xyzw     $vf8, $vf8, $vf12z      \n\t"
+        "vmul.xyzw      $vf7, $vf7, $vf5        \n\t"
+        "vmul.xyzw      $vf8, $vf8, $vf6        \n\t"
+        "vaddy.xyzw     $vf7, $vf7, $vf12y      \n\t"
+        "vaddy.xyzw     $vf8, $vf8, $vf12y      \n\t"
+        "vmul.xyzw      $vf7, $vf7, $vf5        \n\t"
+        "vmul.xyzw      $vf8, $vf8, $vf6        \n\t"
+        "vaddx.xyzw     $vf7, $vf7, $vf12x      \n\t"
+        "vaddx.xyzw     $vf8, $vf8, $vf12x      \n\t"
+        "vmul.xyzw      $vf7, $vf7, $vf5        \n\t"
+        "vmul.xyzw      $vf8, $vf8, $vf6        \n\t"
+        "vmulaw.xyzw    $ACC, $vf3, $vf0w       \n\t"
+        "vmadd.xyzw     $vf7, $vf3, $vf7        \n\t"
+        "vmulaw.xyzw    $ACC, $vf4, $vf0w       \n\t"
+        "vmadd.xyzw     $vf8, $vf4, $vf8        \n\t"
+        "sqc2           $vf7, 0x00(%1)          \n\t"
+        "sqc2           $vf8, 0x00(%2)          \n\t"
+        :
+        : "r"(&t_radians[i * 4]), "r"(&o_sin[i * 4]), "r"(&o_cos[i * 4]),
+          "r"(sinCosConstants)
+        : "memory");
+  }
+
+  const unsigned int done = vectors * 4;
+  sinCosScalar(&t_radians[done], &o_sin[done], &o_cos[done], t_count - done);
+#else
+  sinCosScalar(t_radians, o_sin, o_cos, t_count);
+#endif
+}
+
+void TrigKernels::sinCosScalar(const float* t_radians, float* o_sin,
+                               float* o_cos, const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    sinCos(t_radians[i], &o_sin[i], &o_cos[i]);
+  }
+}
+
+float TrigKernels::atan2(const float& t_y, const float& t_x) {
+  const float absX = fabsf(t_x);
+  const float absY = fabsf(t_y);
+
+  if (absX == 0.0F && absY == 0.0F) return 0.0F;
+
+  // atan of ratio in <0, 1>, then move to right octant
+  const bool isSteep = absY > absX;
+  const float z = isSteep ? absX / absY : absY / absX;
+  const float z2 = z * z;
+
+  float result = atan9;
+  result = result * z2 + atan7;
+  result = result * z2 + atan5;
+  result = result * z2 + atan3;
+  result = result * z2 + atan1;
+  result *= z;
+
+  if (isSteep) result = halfPi - result;
+  if (t_x < 0.0F) result = pi - result;
+  return t_y < 0.0F ? -result : result;
+}
+
+void TrigKernels::atan2(const float* t_y, const float* t_x, float* o_radians,
+                        const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    o_radians[i] = atan2(t_y[i], t_x[i]);
+  }
+}
+
+}  // namespace Tyra
@@ -0,0 +1,91 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "math/vu0_kernels.hpp"
+#include <cmath>
+
+namespace Tyra {
+
+void Vu0Kernels::transform(const float* t_matrix, const float* t_vertices,
+                           float* o_vertices, const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    multiply(&o_vertices[i * 4], t_matrix, &t_vertices[i * 4]);
+  }
+}
+
+void Vu0Kernels::cullBoxes(const float* t_matrix, const float* t_boxes,
+                           unsigned int* o_flags,
+                           const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    const float* min = &t_boxes[i * 8];
+    const float* max = &t_boxes[i * 8 + 4];
+
+    unsigned int flags = 0x3F;
+    for (unsigned int c = 0; c < 8; c++) {
+      float corner[4] = {c & 1 ? max[0] : min[0], c & 2 ? max[1] : min[1],
+                         c & 4 ? max[2] : min[2], 1.0F};
+      float clip[4];
+      multiply(clip, t_matrix, corner);
+      flags &= getClipFlags(clip);
+    }
+
+    o_flags[i] = flags;
+  }
+}
+
+void Vu0Kernels::morph(const float* t_from, const float* t_to,
+                       const float& t_interp, float* o_vertices,
+                       const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count * 4; i++) {
+    o_vertices[i] = t_from[i] + (t_to[i] - t_from[i]) * t_interp;
+  }
+}
+
+void Vu0Kernels::skin(const float* t_bones, const float* t_positions,
+                      const float* t_weights, const int* t_indices,
+                      float* o_positions, const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    float* out = &o_positions[i * 4];
+    out[0] = out[1] = out[2] = out[3] = 0.0F;
+
+    for (unsigned int b = 0; b < 4; b++) {
+      const float weight = t_weights[i * 4 + b];
+      const float* bone = &t_bones[t_indices[i * 4 + b] * 16];
+
+      float skinned[4];
+      multiply(skinned, bone, &t_positions[i * 4]);
+      for (unsigned int j = 0; j < 4; j++) out[j] += skinned[j] * weight;
+    }
+  }
+}
+
+unsigned int Vu0Kernels::getClipFlags(const float* t_vertex) {
+  const float w = std::fabs(t_vertex[3]);
+  unsigned int result = 0;
+
+  for (unsigned int axis = 0; axis < 3; axis++) {
+    if (t_vertex[axis] > w) result |= 1 << (axis * 2);
+    if (t_vertex[axis] < -w) result |= 1 << (axis * 2 + 1);
+  }
+
+  return result;
+}
+
+void Vu0Kernels::multiply(float* o_result, const float* t_matrix,
+                          const float* t_vertex) {
+  for (unsigned int row = 0; row < 4; row++) {
+    o_result[row] = t_matrix[row] * t_vertex[0] +
+                    t_matrix[4 + row] * t_vertex[1] +
+                    t_matrix[8 + row] * t_vertex[2] +
+                    t_matrix[12 + row] * t_vertex[3];
+  }
+}
+
+}  // namespace Tyra
@@ -0,0 +1,186 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "memory/memory_tracker.hpp"
+#include <malloc.h>
+#include <stdlib.h>
+
+namespace Tyra {
+
+namespace {
+
+struct MemoryTrackerHeader {
+  unsigned int size;
+  unsigned short offset;
+  unsigned char category;
+  unsigned char magic;
+};
+
+const unsigned char headerMagic = 0xA7;
+
+MemoryTrackerHeader* getHeader(const void* t_pointer) {
+  return reinterpret_cast<MemoryTrackerHeader*>(
+             const_cast<void*>(t_pointer)) -
+         1;
+}
+
+}  // namespace
+
+const unsigned int MemoryTracker::minAlignment = 16;
+
+MemoryTracker::MemoryTracker() {
+  onBudgetExceeded = nullptr;
+  for (auto& stat : stats) stat = {0, 0, 0, 0, 0, 0, 0};
+  liveBytes = 0;
+  peakBytes = 0;
+  liveCount = 0;
+  overheadBytes = 0;
+  frameCount = 0;
+  lastFrameCount = 0;
+}
+
+MemoryTracker::~MemoryTracker() {}
+
+void* MemoryTracker::allocate(const unsigned int& t_size,
+                              const MemoryCategory& t_category) {
+  return allocate(t_size, t_category, minAlignment);
+}
+
+void* MemoryTracker::allocate(const unsigned int& t_size,
+                              const MemoryCategory& t_category,
+                              const unsigned int& t_alignment) {
+  // Header takes whole first alignment unit, so block stays aligned
+  const auto alignment =
+      t_alignment < minAlignment ? minAlignment : t_alignment;
+  auto* block = static_cast<unsigned char*>(memalign(alignment, t_size +
+                                                                   alignment));
+  if (block == nullptr) return nullptr;
+
+  auto* result = block + alignment;
+  auto* header = getHeader(result);
+  header->size = t_size;
+  header->offset = alignment;
+  header->category = t_category;
+  header->magic = headerMagic;
+
+  overheadBytes += alignment;
+  add(t_size, t_category);
+
+  return result;
+}
+
+bool MemoryTracker::free(void* t_pointer) {
+  if (t_pointer == nullptr) return true;
+
+  auto* header = getHeader(t_pointer);
+  if (header->magic != headerMagic) return false;
+
+  const auto offset = header->offset;
+  overheadBytes -= offset;
+  remove(header->size, static_cast<MemoryCategory>(header->category));
+
+  header->magic = 0;
+  ::free(static_cast<unsigned char*>(t_pointer) - offset);
+  return true;
+}
+
+void MemoryTracker::track(const unsigned int& t_size,
+                          const MemoryCategory& t_category) {
+  add(t_size, t_category);
+}
+
+void MemoryTracker::untrack(const unsigned int& t_size,
+                            const MemoryCategory& t_category) {
+  remove(t_size, t_category);
+}
+
+unsigned int MemoryTracker::getSize(const void* t_pointer) {
+  return getHeader(t_pointer)->size;
+}
+
+MemoryCategory MemoryTracker::getCategory(const void* t_pointer) {
+  return static_cast<MemoryCategory>(getHeader(t_pointer)->category);
+}
+
+void MemoryTracker::setBudget(const MemoryCategory& t_category,
+                              const unsigned int& t_bytes) {
+  stats[t_category].budget = t_bytes;
+}
+
+bool MemoryTracker::isOverBudget(const MemoryCategory& t_category) const {
+  const auto& stat = stats[t_category];
+  return stat.budget != 0 && stat.liveBytes > stat.budget;
+}
+
+float MemoryTracker::getOverheadRatio() const {
+  const auto reserved = liveBytes + overheadBytes;
+  if (reserved == 0) return 0.0F;
+
+  return static_cast<float>(overheadBytes) / reserved;
+}
+
+void MemoryTracker::endFrame() {
+  lastFrameCount = frameCount;
+  frameCount = 0;
+
+  for (auto& stat : stats) {
+    stat.frameCount = 0;
+    stat.frameBytes = 0;
+  }
+}
+
+const char* MemoryTracker::getCategoryName(const MemoryCategory& t_category) {
+  switch (t_category) {
+    case MEMORY_CATEGORY_TEXTURES:
+      return "Textures";
+    case MEMORY_CATEGORY_MESHES:
+      return "Meshes";
+    case MEMORY_CATEGORY_PACKETS:
+      return "Packets";
+    case MEMORY_CATEGORY_AUDIO:
+      return "Audio";
+    case MEMORY_CATEGORY_GAME:
+      return "Game";
+    default:
+      return "Unknown";
+  }
+}
+
+void MemoryTracker::add(const unsigned int& t_size,
+                        const MemoryCategory& t_category) {
+  auto& stat = stats[t_category];
+  stat.liveBytes += t_size;
+  stat.liveCount++;
+  stat.frameCount++;
+  stat.frameBytes += t_size;
+  stat.totalCount++;
+  if (stat.liveBytes > stat.peakBytes) stat.peakBytes = stat.liveBytes;
+
+  liveBytes += t_size;
+  liveCount++;
+  frameCount++;
+  if (liveBytes > peakBytes) peakBytes = liveBytes;
+
+  if (onBudgetExceeded && isOverBudget(t_category)) {
+    onBudgetExceeded(t_category, stat);
+  }
+}
+
+void MemoryTracker::remove(const unsigned int& t_size,
+                           const MemoryCategory& t_category) {
+  auto& stat = stats[t_category];
+  stat.liveBytes -= t_size;
+  stat.liveCount--;
+
+  liveBytes -= t_size;
+  liveCount--;
+}
+
+}  // namespace Tyra
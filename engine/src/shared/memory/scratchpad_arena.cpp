@@ -0,0 +1,61 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "memory/scratchpad_arena.hpp"
+
+namespace Tyra {
+
+const unsigned int ScratchpadArena::defaultAlignment = 16;
+
+ScratchpadArena::ScratchpadArena() {
+  base = nullptr;
+  size = 0;
+  top = 0;
+  peak = 0;
+}
+
+ScratchpadArena::~ScratchpadArena() {}
+
+void ScratchpadArena::init(unsigned char* t_base, const unsigned int& t_size) {
+  base = t_base;
+  size = t_size;
+  top = 0;
+  peak = 0;
+}
+
+void* ScratchpadArena::allocate(const unsigned int& t_size) {
+  return allocate(t_size, defaultAlignment);
+}
+
+void* ScratchpadArena::allocate(const unsigned int& t_size,
+                                const unsigned int& t_alignment) {
+  // Alignment is relative to real address, not to base
+  const auto address = reinterpret_cast<unsigned long>(base) + top;
+  const auto padding = (t_alignment - address % t_alignment) % t_alignment;
+
+  if (t_size > size || top + padding > size - t_size) return nullptr;
+
+  auto* result = base + top + padding;
+  top += padding + t_size;
+  if (top > peak) peak = top;
+
+  return result;
+}
+
+void ScratchpadArena::release(const unsigned int& t_marker) {
+  if (t_marker < top) top = t_marker;
+}
+
+bool ScratchpadArena::contains(const void* t_pointer) const {
+  const auto* pointer = static_cast<const unsigned char*>(t_pointer);
+  return pointer >= base && pointer < base + size;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,48 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "memory/scratchpad_double_buffer.hpp"
+
+namespace Tyra {
+
+ScratchpadDoubleBuffer::ScratchpadDoubleBuffer() {
+  halves[0] = nullptr;
+  halves[1] = nullptr;
+  index = 0;
+  halfSize = 0;
+}
+
+ScratchpadDoubleBuffer::~ScratchpadDoubleBuffer() {}
+
+bool ScratchpadDoubleBuffer::init(ScratchpadArena* t_arena,
+                                  const unsigned int& t_halfSize) {
+  const auto marker = t_arena->getMarker();
+
+  halves[0] = static_cast<unsigned char*>(t_arena->allocate(t_halfSize));
+  halves[1] = static_cast<unsigned char*>(t_arena->allocate(t_halfSize));
+
+  if (!halves[0] || !halves[1]) {
+    t_arena->release(marker);
+    halves[0] = nullptr;
+    halves[1] = nullptr;
+    return false;
+  }
+
+  index = 0;
+  halfSize = t_halfSize;
+  return true;
+}
+
+unsigned char* ScratchpadDoubleBuffer::swap() {
+  index ^= 1;
+  return halves[index];
+}
+
+}  // namespace Tyra
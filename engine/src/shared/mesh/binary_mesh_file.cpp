@@ -0,0 +1,266 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "mesh/binary_mesh_file.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+const unsigned int BinaryMeshFile::version = 1;
+const unsigned int BinaryMeshFile::alignment = 16;
+const unsigned int BinaryMeshFile::noString = 0xFFFFFFFF;
+
+unsigned int BinaryMeshFile::align(const unsigned int& value) {
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+bool BinaryMeshFile::validate(const unsigned char* t_data,
+                              const unsigned int& t_size) {
+  if (t_size < sizeof(BinaryMeshHeader)) return false;
+
+  const auto* header = getHeader(t_data);
+  if (memcmp(header->magic, "TYME", 4) != 0 || header->version != version ||
+      header->size != t_size)
+    return false;
+
+  // size_t is 32 bit on EE, so products are done in 64 bits
+  if (header->materialsCount > t_size / sizeof(BinaryMeshMaterial))
+    return false;
+
+  const auto materialsCount =
+      static_cast<unsigned long long>(header->materialsCount);
+  const unsigned long long tableEnd =
+      sizeof(BinaryMeshHeader) + materialsCount * sizeof(BinaryMeshMaterial) +
+      materialsCount * header->framesCount * sizeof(BinaryMeshFrame);
+  if (tableEnd > header->stringsOffset ||
+      header->stringsOffset > t_size ||
+      header->stringsSize > t_size - header->stringsOffset)
+    return false;
+
+  // Strings must be null terminated
+  if (header->stringsSize > 0 &&
+      t_data[header->stringsOffset + header->stringsSize - 1] != 0)
+    return false;
+
+  auto isStringValid = [&](const unsigned int& offset, const bool& optional) {
+    return (optional && offset == noString) || offset < header->stringsSize;
+  };
+
+  for (unsigned int i = 0; i < header->materialsCount; i++) {
+    const auto* material = getMaterial(t_data, i);
+    if (!isStringValid(material->nameOffset, false) ||
+        !isStringValid(material->texturePathOffset, true))
+      return false;
+
+    for (unsigned int j = 0; j < header->framesCount; j++) {
+      const auto* frame = getFrame(t_data, i, j);
+      if (frame->offsets[BINARY_MESH_VERTICES] == 0) return false;
+      if (frame->count > t_size / (4 * sizeof(float))) return false;
+
+      const unsigned int arraySize = frame->count * 4 * sizeof(float);
+      for (unsigned int k = 0; k < BINARY_MESH_ARRAYS_COUNT; k++) {
+        const auto offset = frame->offsets[k];
+        if (offset == 0) continue;
+        if (offset % alignment != 0 || offset < tableEnd ||
+            offset > t_size || arraySize > t_size - offset)
+          return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+const BinaryMeshHeader* BinaryMeshFile::getHeader(const unsigned char* t_data) {
+  return reinterpret_cast<const BinaryMeshHeader*>(t_data);
+}
+
+const BinaryMeshMaterial* BinaryMeshFile::getMaterial(
+    const unsigned char* t_data, const unsigned int& t_index) {
+  return reinterpret_cast<const BinaryMeshMaterial*>(
+             t_data + sizeof(BinaryMeshHeader)) +
+         t_index;
+}
+
+const BinaryMeshFrame* BinaryMeshFile::getFrame(const unsigned char* t_data,
+                                                const unsigned int& t_material,
+                                                const unsigned int& t_frame) {
+  const auto* header = getHeader(t_data);
+  const auto* frames = reinterpret_cast<const BinaryMeshFrame*>(
+      t_data + sizeof(BinaryMeshHeader) +
+      header->materialsCount * sizeof(BinaryMeshMaterial));
+  return frames + t_material * header->framesCount + t_frame;
+}
+
+const char* BinaryMeshFile::getString(const unsigned char* t_data,
+                                      const unsigned int& t_offset) {
+  if (t_offset == noString) return nullptr;
+  return reinterpret_cast<const char*>(
+      t_data + getHeader(t_data)->stringsOffset + t_offset);
+}
+
+const float* BinaryMeshFile::getArray(const unsigned char* t_data,
+                                      const BinaryMeshFrame* t_frame,
+                                      const BinaryMeshArray& t_array) {
+  const auto offset = t_frame->offsets[t_array];
+  if (offset == 0) return nullptr;
+  return reinterpret_cast<const float*>(t_data + offset);
+}
+
+std::vector<unsigned char> BinaryMeshFile::build(
+    const BinaryMeshSource& t_source) {
+  const unsigned int materialsCount = t_source.materials.size();
+  const unsigned int framesCount =
+      materialsCount > 0 ? t_source.materials[0].frames.size() : 0;
+
+  std::vector<BinaryMeshMaterial> materials(materialsCount);
+  std::vector<BinaryMeshFrame> frames(materialsCount * framesCount);
+  std::string strings;
+
+  auto addString = [&strings](const std::string& text) {
+    unsigned int offset = strings.size();
+    strings.append(text);
+    strings.push_back('\0');
+    return offset;
+  };
+
+  const unsigned int stringsOffset =
+      sizeof(BinaryMeshHeader) + materialsCount * sizeof(BinaryMeshMaterial) +
+      frames.size() * sizeof(BinaryMeshFrame);
+
+  for (unsigned int i = 0; i < materialsCount; i++) {
+    const auto& source = t_source.materials[i];
+    if (source.frames.size() != framesCount) return {};
+
+    auto& material = materials[i];
+    memset(&material, 0, sizeof(BinaryMeshMaterial));
+    material.nameOffset = addString(source.name);
+    material.texturePathOffset = source.texturePath.has_value()
+                                     ? addString(source.texturePath.value())
+                                     : noString;
+    memcpy(material.ambient, source.ambient, sizeof(material.ambient));
+  }
+
+  unsigned int size = align(stringsOffset + strings.size());
+
+  for (unsigned int i = 0; i < materialsCount; i++) {
+    for (unsigned int j = 0; j < framesCount; j++) {
+      const auto& source = t_source.materials[i].frames[j];
+      auto& frame = frames[i * framesCount + j];
+      memset(&frame, 0, sizeof(BinaryMeshFrame));
+      frame.count = source.count;
+
+      const auto& vertices = source.arrays[BINARY_MESH_VERTICES];
+      if (source.count == 0 || vertices.size() != source.count * 4) return {};
+
+      for (unsigned int k = 0; k < BINARY_MESH_ARRAYS_COUNT; k++) {
+        const auto& array = source.arrays[k];
+        if (array.empty()) continue;
+        if (array.size() != source.count * 4) return {};
+
+        frame.offsets[k] = size;
+        size += align(array.size() * sizeof(float));
+      }
+
+      for (unsigned int axis = 0; axis < 3; axis++) {
+        frame.min[axis] = frame.max[axis] = vertices[axis];
+        for (unsigned int v = 1; v < source.count; v++) {
+          const float value = vertices[v * 4 + axis];
+          if (value < frame.min[axis]) frame.min[axis] = value;
+          if (value > frame.max[axis]) frame.max[axis] = value;
+        }
+      }
+      frame.min[3] = frame.max[3] = 1.0F;
+    }
+  }
+
+  std::vector<unsigned char> result(size, 0);
+
+  BinaryMeshHeader header;
+  memcpy(header.magic, "TYME", 4);
+  header.version = version;
+  header.materialsCount = materialsCount;
+  header.framesCount = framesCount;
+  header.flags = (t_source.loadNormals ? BINARY_MESH_FLAG_NORMALS : 0) |
+                 (t_source.loadLightmap ? BINARY_MESH_FLAG_LIGHTMAP : 0);
+  header.stringsOffset = stringsOffset;
+  header.stringsSize = strings.size();
+  header.size = size;
+
+  auto* output = result.data();
+  memcpy(output, &header, sizeof(BinaryMeshHeader));
+  output += sizeof(BinaryMeshHeader);
+
+  if (materialsCount > 0) {
+    memcpy(output, materials.data(),
+           materialsCount * sizeof(BinaryMeshMaterial));
+    output += materialsCount * sizeof(BinaryMeshMaterial);
+  }
+
+  if (!frames.empty())
+    memcpy(output, frames.data(), frames.size() * sizeof(BinaryMeshFrame));
+
+  if (!strings.empty())
+    memcpy(result.data() + stringsOffset, strings.data(), strings.size());
+
+  for (unsigned int i = 0; i < materialsCount; i++)
+    for (unsigned int j = 0; j < framesCount; j++) {
+      const auto& source = t_source.materials[i].frames[j];
+      const auto& frame = frames[i * framesCount + j];
+      for (unsigned int k = 0; k < BINARY_MESH_ARRAYS_COUNT; k++)
+        if (frame.offsets[k] != 0)
+          memcpy(result.data() + frame.offsets[k], source.arrays[k].data(),
+                 source.arrays[k].size() * sizeof(float));
+    }
+
+  return result;
+}
+
+bool BinaryMeshFile::read(const unsigned char* t_data,
+                          const unsigned int& t_size,
+                          BinaryMeshSource* o_source) {
+  if (!validate(t_data, t_size)) return false;
+
+  const auto* header = getHeader(t_data);
+  o_source->loadNormals = header->flags & BINARY_MESH_FLAG_NORMALS;
+  o_source->loadLightmap = header->flags & BINARY_MESH_FLAG_LIGHTMAP;
+  o_source->materials.clear();
+
+  for (unsigned int i = 0; i < header->materialsCount; i++) {
+    const auto* material = getMaterial(t_data, i);
+
+    BinaryMeshSourceMaterial output;
+    output.name = getString(t_data, material->nameOffset);
+    const auto* texturePath = getString(t_data, material->texturePathOffset);
+    if (texturePath) output.texturePath = texturePath;
+    memcpy(output.ambient, material->ambient, sizeof(output.ambient));
+
+    for (unsigned int j = 0; j < header->framesCount; j++) {
+      const auto* frame = getFrame(t_data, i, j);
+
+      BinaryMeshSourceFrame outputFrame;
+      outputFrame.count = frame->count;
+
+      for (unsigned int k = 0; k < BINARY_MESH_ARRAYS_COUNT; k++) {
+        const auto* array =
+            getArray(t_data, frame, static_cast<BinaryMeshArray>(k));
+        if (array) outputFrame.arrays[k].assign(array, array + frame->count * 4);
+      }
+
+      output.frames.push_back(std::move(outputFrame));
+    }
+
+    o_source->materials.push_back(std::move(output));
+  }
+
+  return true;
+}
+
+}  // namespace Tyra
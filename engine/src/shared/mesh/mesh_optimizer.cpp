@@ -0,0 +1,263 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "mesh/mesh_optimizer.hpp"
+#include <algorithm>
+
+namespace Tyra {
+
+MeshOptimizerStats MeshOptimizer::optimize(
+    BinaryMeshSource& io_mesh, const MeshOptimizerOptions& t_options) {
+  MeshOptimizerStats stats;
+  stats.trianglesBefore = getTrianglesCount(io_mesh);
+  stats.packageSpreadBefore =
+      getPackageSpread(io_mesh, t_options.packageSize);
+
+  stats.degeneratesRemoved =
+      t_options.removeDegenerates ? removeDegenerates(io_mesh) : 0;
+
+  stats.materialsMerged =
+      t_options.mergeMaterials ? mergeMaterials(io_mesh) : 0;
+
+  if (t_options.sortTriangles)
+    for (auto& material : io_mesh.materials) sortTriangles(material);
+
+  stats.trianglesAfter = getTrianglesCount(io_mesh);
+  stats.packageSpreadAfter = getPackageSpread(
+      io_mesh, t_options.packageSize, &stats.packagesCount);
+
+  return stats;
+}
+
+unsigned int MeshOptimizer::getTrianglesCount(const BinaryMeshSource& mesh) {
+  unsigned int result = 0;
+  for (const auto& material : mesh.materials)
+    if (!material.frames.empty()) result += material.frames[0].count / 3;
+  return result;
+}
+
+bool MeshOptimizer::isDegenerate(const float* t_a, const float* t_b,
+                                 const float* t_c) {
+  const float ab[3] = {t_b[0] - t_a[0], t_b[1] - t_a[1], t_b[2] - t_a[2]};
+  const float ac[3] = {t_c[0] - t_a[0], t_c[1] - t_a[1], t_c[2] - t_a[2]};
+
+  const float cross[3] = {ab[1] * ac[2] - ab[2] * ac[1],
+                          ab[2] * ac[0] - ab[0] * ac[2],
+                          ab[0] * ac[1] - ab[1] * ac[0]};
+  const float area2 =
+      cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2];
+
+  // Relative to edge lengths, so it does not depend on mesh scale
+  const float abLength = ab[0] * ab[0] + ab[1] * ab[1] + ab[2] * ab[2];
+  const float acLength = ac[0] * ac[0] + ac[1] * ac[1] + ac[2] * ac[2];
+
+  return area2 <= 1e-12F * abLength * acLength;
+}
+
+unsigned int MeshOptimizer::getMortonCode(const float& t_x, const float& t_y,
+                                          const float& t_z) {
+  auto expand = [](float value) {
+    value = std::min(std::max(value, 0.0F), 1.0F);
+    unsigned int v = static_cast<unsigned int>(value * 1023.0F);
+    v = (v * 0x00010001u) & 0xFF0000FFu;
+    v = (v * 0x00000101u) & 0x0F00F00Fu;
+    v = (v * 0x00000011u) & 0xC30C30C3u;
+    v = (v * 0x00000005u) & 0x49249249u;
+    return v;
+  };
+
+  return (expand(t_x) << 2) | (expand(t_y) << 1) | expand(t_z);
+}
+
+void MeshOptimizer::reorder(BinaryMeshSourceMaterial& material,
+                            const std::vector<unsigned int>& triangles) {
+  for (auto& frame : material.frames) {
+    for (auto& array : frame.arrays) {
+      if (array.empty()) continue;
+
+      std::vector<float> result;
+      result.reserve(triangles.size() * 12);
+      for (const auto& triangle : triangles)
+        result.insert(result.end(), array.begin() + triangle * 12,
+                      array.begin() + triangle * 12 + 12);
+      array.swap(result);
+    }
+    frame.count = triangles.size() * 3;
+  }
+}
+
+/** Triangle is removed only if it is degenerate in every frame. */
+unsigned int MeshOptimizer::removeDegenerates(BinaryMeshSource& mesh) {
+  unsigned int result = 0;
+
+  for (auto& material : mesh.materials) {
+    if (material.frames.empty()) continue;
+
+    const unsigned int trianglesCount = material.frames[0].count / 3;
+    std::vector<unsigned int> kept;
+    kept.reserve(trianglesCount);
+
+    for (unsigned int i = 0; i < trianglesCount; i++) {
+      bool degenerate = true;
+      for (const auto& frame : material.frames) {
+        const auto* v = &frame.arrays[BINARY_MESH_VERTICES][i * 12];
+        if (!isDegenerate(v, v + 4, v + 8)) {
+          degenerate = false;
+          break;
+        }
+      }
+      if (!degenerate) kept.push_back(i);
+    }
+
+    // Material must keep at least one triangle
+    if (kept.empty()) kept.push_back(0);
+
+    if (kept.size() != trianglesCount) {
+      result += trianglesCount - kept.size();
+      reorder(material, kept);
+    }
+  }
+
+  return result;
+}
+
+bool MeshOptimizer::areEqual(const BinaryMeshSourceMaterial& a,
+                             const BinaryMeshSourceMaterial& b) {
+  if (a.texturePath != b.texturePath || a.frames.size() != b.frames.size())
+    return false;
+
+  for (int i = 0; i < 4; i++)
+    if (a.ambient[i] != b.ambient[i]) return false;
+
+  for (unsigned int i = 0; i < a.frames.size(); i++)
+    for (int j = 0; j < BINARY_MESH_ARRAYS_COUNT; j++)
+      if (a.frames[i].arrays[j].empty() != b.frames[i].arrays[j].empty())
+        return false;
+
+  return true;
+}
+
+unsigned int MeshOptimizer::mergeMaterials(BinaryMeshSource& mesh) {
+  std::vector<BinaryMeshSourceMaterial> result;
+
+  for (auto& material : mesh.materials) {
+    auto target = std::find_if(result.begin(), result.end(),
+                               [&material](const BinaryMeshSourceMaterial& m) {
+                                 return areEqual(m, material);
+                               });
+
+    if (target == result.end()) {
+      result.push_back(std::move(material));
+      continue;
+    }
+
+    for (unsigned int i = 0; i < material.frames.size(); i++) {
+      auto& to = target->frames[i];
+      auto& from = material.frames[i];
+      for (int j = 0; j < BINARY_MESH_ARRAYS_COUNT; j++)
+        to.arrays[j].insert(to.arrays[j].end(), from.arrays[j].begin(),
+                            from.arrays[j].end());
+      to.count += from.count;
+    }
+  }
+
+  const unsigned int merged = mesh.materials.size() - result.size();
+  mesh.materials.swap(result);
+  return merged;
+}
+
+/** Sorted by first frame, animated meshes usually keep their layout. */
+void MeshOptimizer::sortTriangles(BinaryMeshSourceMaterial& material) {
+  if (material.frames.empty()) return;
+
+  const auto& vertices = material.frames[0].arrays[BINARY_MESH_VERTICES];
+  const unsigned int trianglesCount = material.frames[0].count / 3;
+  if (trianglesCount < 2) return;
+
+  float min[3], max[3];
+  for (int axis = 0; axis < 3; axis++) min[axis] = max[axis] = vertices[axis];
+  for (unsigned int i = 1; i < trianglesCount * 3; i++)
+    for (int axis = 0; axis < 3; axis++) {
+      min[axis] = std::min(min[axis], vertices[i * 4 + axis]);
+      max[axis] = std::max(max[axis], vertices[i * 4 + axis]);
+    }
+
+  // Uniform scale, so Z-curve cells are cubes
+  float size = std::max(max[0] - min[0],
+                        std::max(max[1] - min[1], max[2] - min[2]));
+  if (size <= 0.0F) size = 1.0F;
+
+  std::vector<std::pair<unsigned int, unsigned int>> codes(trianglesCount);
+  for (unsigned int i = 0; i < trianglesCount; i++) {
+    float center[3];
+    for (int axis = 0; axis < 3; axis++)
+      center[axis] = (vertices[i * 12 + axis] + vertices[i * 12 + 4 + axis] +
+                      vertices[i * 12 + 8 + axis]) /
+                         3.0F -
+                     min[axis];
+
+    codes[i] = {getMortonCode(center[0] / size, center[1] / size,
+                              center[2] / size),
+                i};
+  }
+
+  std::stable_sort(codes.begin(), codes.end(),
+                   [](const std::pair<unsigned int, unsigned int>& a,
+                      const std::pair<unsigned int, unsigned int>& b) {
+                     return a.first < b.first;
+                   });
+
+  std::vector<unsigned int> order(trianglesCount);
+  for (unsigned int i = 0; i < trianglesCount; i++) order[i] = codes[i].second;
+
+  reorder(material, order);
+}
+
+float MeshOptimizer::getPackageSpread(const BinaryMeshSource& t_mesh,
+                                      const unsigned int& t_packageSize,
+                                      unsigned int* o_packagesCount) {
+  auto getWidth = [](const std::vector<float>& vertices,
+                     const unsigned int& first, const unsigned int& last) {
+    float min[3], max[3];
+    for (int axis = 0; axis < 3; axis++)
+      min[axis] = max[axis] = vertices[first * 4 + axis];
+
+    for (unsigned int i = first + 1; i < last; i++)
+      for (int axis = 0; axis < 3; axis++) {
+        min[axis] = std::min(min[axis], vertices[i * 4 + axis]);
+        max[axis] = std::max(max[axis], vertices[i * 4 + axis]);
+      }
+
+    return (max[0] - min[0]) + (max[1] - min[1]) + (max[2] - min[2]);
+  };
+
+  const unsigned int packageSize = std::max(3u, t_packageSize / 3 * 3);
+  float sum = 0.0F;
+  unsigned int count = 0;
+
+  for (const auto& material : t_mesh.materials) {
+    if (material.frames.empty() || material.frames[0].count == 0) continue;
+
+    const auto& frame = material.frames[0];
+    const auto& vertices = frame.arrays[BINARY_MESH_VERTICES];
+    const float width = getWidth(vertices, 0, frame.count);
+
+    for (unsigned int first = 0; first < frame.count; first += packageSize) {
+      const unsigned int last = std::min(frame.count, first + packageSize);
+      sum += width > 0.0F ? getWidth(vertices, first, last) / width : 1.0F;
+      count++;
+    }
+  }
+
+  if (o_packagesCount) *o_packagesCount = count;
+  return count > 0 ? sum / count : 0.0F;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,349 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "physics/broadphase.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+namespace Tyra {
+
+const unsigned int Broadphase::invalidProxy = 0xFFFFFFFF;
+
+static inline bool overlaps(const float* aMin, const float* aMax,
+                            const float* bMin, const float* bMax) {
+  return aMin[0] <= bMax[0] && aMax[0] >= bMin[0] && aMin[1] <= bMax[1] &&
+         aMax[1] >= bMin[1] && aMin[2] <= bMax[2] && aMax[2] >= bMin[2];
+}
+
+Broadphase::Broadphase(const float& t_cellSize,
+                       const unsigned int& t_bucketsCount) {
+  cellSize = t_cellSize;
+  invCellSize = 1.0F / t_cellSize;
+  proxiesCount = 0;
+  queryStamp = 0;
+
+  unsigned int bucketsCount = 1;
+  while (bucketsCount < t_bucketsCount) bucketsCount <<= 1;
+
+  bucketMask = bucketsCount - 1;
+  buckets.resize(bucketsCount);
+}
+
+Broadphase::~Broadphase() {}
+
+int Broadphase::getCell(const float& t_value) const {
+  return static_cast<int>(floorf(t_value * invCellSize));
+}
+
+unsigned int Broadphase::getBucket(const int& t_x, const int& t_y,
+                                   const int& t_z) const {
+  // Teschner et al. spatial hash primes
+  const unsigned int hash = (static_cast<unsigned int>(t_x) * 73856093U) ^
+                            (static_cast<unsigned int>(t_y) * 19349663U) ^
+                            (static_cast<unsigned int>(t_z) * 83492791U);
+  return hash & bucketMask;
+}
+
+unsigned int Broadphase::nextQueryStamp() const {
+  if (++queryStamp == 0) {
+    // Wrapped around, old stamps could match again
+    for (const auto& proxy : proxies) proxy.queryStamp = 0;
+    queryStamp = 1;
+  }
+
+  return queryStamp;
+}
+
+bool Broadphase::getBounds(float* o_min, float* o_max) const {
+  if (proxiesCount == 0) return false;
+
+  for (int k = 0; k < 3; k++) {
+    o_min[k] = FLT_MAX;
+    o_max[k] = -FLT_MAX;
+  }
+
+  for (const auto& proxy : proxies) {
+    if (!proxy.isActive) continue;
+
+    for (int k = 0; k < 3; k++) {
+      o_min[k] = fminf(o_min[k], proxy.min[k]);
+      o_max[k] = fmaxf(o_max[k], proxy.max[k]);
+    }
+  }
+
+  return true;
+}
+
+unsigned int Broadphase::add(const float* t_min, const float* t_max,
+                             const unsigned int& t_userData) {
+  unsigned int id;
+  if (freeProxies.empty()) {
+    id = proxies.size();
+    proxies.push_back(Proxy());
+  } else {
+    id = freeProxies.back();
+    freeProxies.pop_back();
+  }
+
+  auto& proxy = proxies[id];
+  proxy.userData = t_userData;
+  proxy.isActive = true;
+  proxy.queryStamp = 0;
+
+  for (int k = 0; k < 3; k++) {
+    proxy.min[k] = t_min[k];
+    proxy.max[k] = t_max[k];
+    proxy.cellMin[k] = getCell(t_min[k]);
+    proxy.cellMax[k] = getCell(t_max[k]);
+  }
+
+  insertCells(id);
+  proxiesCount++;
+  return id;
+}
+
+void Broadphase::update(const unsigned int& t_proxy, const float* t_min,
+                        const float* t_max) {
+  auto& proxy = proxies[t_proxy];
+
+  int cellMin[3], cellMax[3];
+  bool isCellChanged = false;
+
+  for (int k = 0; k < 3; k++) {
+    proxy.min[k] = t_min[k];
+    proxy.max[k] = t_max[k];
+    cellMin[k] = getCell(t_min[k]);
+    cellMax[k] = getCell(t_max[k]);
+    isCellChanged |=
+        cellMin[k] != proxy.cellMin[k] || cellMax[k] != proxy.cellMax[k];
+  }
+
+  if (!isCellChanged) return;
+
+  removeCells(t_proxy);
+  for (int k = 0; k < 3; k++) {
+    proxy.cellMin[k] = cellMin[k];
+    proxy.cellMax[k] = cellMax[k];
+  }
+  insertCells(t_proxy);
+}
+
+void Broadphase::remove(const unsigned int& t_proxy) {
+  auto& proxy = proxies[t_proxy];
+  if (!proxy.isActive) return;
+
+  removeCells(t_proxy);
+  proxy.isActive = false;
+  freeProxies.push_back(t_proxy);
+  proxiesCount--;
+}
+
+void Broadphase::clear() {
+  for (auto& bucket : buckets) bucket.clear();
+  proxies.clear();
+  freeProxies.clear();
+  proxiesCount = 0;
+}
+
+void Broadphase::insertCells(const unsigned int& t_proxy) {
+  const auto& proxy = proxies[t_proxy];
+
+  for (int z = proxy.cellMin[2]; z <= proxy.cellMax[2]; z++) {
+    for (int y = proxy.cellMin[1]; y <= proxy.cellMax[1]; y++) {
+      for (int x = proxy.cellMin[0]; x <= proxy.cellMax[0]; x++) {
+        buckets[getBucket(x, y, z)].push_back({{x, y, z}, t_proxy});
+      }
+    }
+  }
+}
+
+void Broadphase::removeCells(const unsigned int& t_proxy) {
+  const auto& proxy = proxies[t_proxy];
+
+  for (int z = proxy.cellMin[2]; z <= proxy.cellMax[2]; z++) {
+    for (int y = proxy.cellMin[1]; y <= proxy.cellMax[1]; y++) {
+      for (int x = proxy.cellMin[0]; x <= proxy.cellMax[0]; x++) {
+        auto& bucket = buckets[getBucket(x, y, z)];
+
+        for (unsigned int i = 0; i < bucket.size(); i++) {
+          const auto& entry = bucket[i];
+          if (entry.proxy == t_proxy && entry.cell[0] == x &&
+              entry.cell[1] == y && entry.cell[2] == z) {
+            bucket[i] = bucket.back();
+            bucket.pop_back();
+            break;
+          }
+        }
+      }
+    }
+  }
+}
+
+void Broadphase::findPairs(std::vector<BroadphasePair>& o_pairs) const {
+  o_pairs.clear();
+
+  for (const auto& bucket : buckets) {
+    for (unsigned int i = 0; i < bucket.size(); i++) {
+      const auto& a = bucket[i];
+      const auto& proxyA = proxies[a.proxy];
+
+      for (unsigned int j = i + 1; j < bucket.size(); j++) {
+        const auto& b = bucket[j];
+
+        // Other cell with the same hash
+        if (a.cell[0] != b.cell[0] || a.cell[1] != b.cell[1] ||
+            a.cell[2] != b.cell[2]) {
+          continue;
+        }
+
+        const auto& proxyB = proxies[b.proxy];
+        if (!overlaps(proxyA.min, proxyA.max, proxyB.min, proxyB.max)) {
+          continue;
+        }
+
+        // Report only in first cell shared by both proxies
+        bool isFirstShared = true;
+        for (int k = 0; k < 3; k++) {
+          isFirstShared &= a.cell[k] == std::max(proxyA.cellMin[k],
+                                                 proxyB.cellMin[k]);
+        }
+        if (!isFirstShared) continue;
+
+        if (a.proxy < b.proxy) {
+          o_pairs.push_back({a.proxy, b.proxy});
+        } else {
+          o_pairs.push_back({b.proxy, a.proxy});
+        }
+      }
+    }
+  }
+}
+
+void Broadphase::queryBox(const float* t_min, const float* t_max,
+                          std::vector<unsigned int>& o_proxies) const {
+  o_proxies.clear();
+  const unsigned int stamp = nextQueryStamp();
+
+  int cellMin[3], cellMax[3];
+  for (int k = 0; k < 3; k++) {
+    cellMin[k] = getCell(t_min[k]);
+    cellMax[k] = getCell(t_max[k]);
+  }
+
+  for (int z = cellMin[2]; z <= cellMax[2]; z++) {
+    for (int y = cellMin[1]; y <= cellMax[1]; y++) {
+      for (int x = cellMin[0]; x <= cellMax[0]; x++) {
+        for (const auto& entry : buckets[getBucket(x, y, z)]) {
+          const auto& proxy = proxies[entry.proxy];
+          if (proxy.queryStamp == stamp) continue;
+          if (entry.cell[0] != x || entry.cell[1] != y || entry.cell[2] != z)
+            continue;
+
+          proxy.queryStamp = stamp;
+          if (overlaps(proxy.min, proxy.max, t_min, t_max)) {
+            o_proxies.push_back(entry.proxy);
+          }
+        }
+      }
+    }
+  }
+}
+
+void Broadphase::queryRay(const float* t_origin, const float* t_direction,
+                          const float& t_maxDistance,
+                          std::vector<BroadphaseRayHit>& o_hits) const {
+  o_hits.clear();
+
+  // Hash is unbounded, so march only through box of all proxies.
+  // Also makes infinite max distance safe.
+  float boundsMin[3], boundsMax[3];
+  if (!getBounds(boundsMin, boundsMax)) return;
+
+  float invDir[3];
+  float enter = 0.0F;
+  float exit = t_maxDistance;
+  for (int k = 0; k < 3; k++) {
+    invDir[k] = 1.0F / t_direction[k];
+    float t1 = (boundsMin[k] - t_origin[k]) * invDir[k];
+    float t2 = (boundsMax[k] - t_origin[k]) * invDir[k];
+    if (t1 > t2) std::swap(t1, t2);
+    enter = fmaxf(enter, t1);
+    exit = fminf(exit, t2);
+  }
+  if (enter > exit) return;
+
+  const unsigned int stamp = nextQueryStamp();
+
+  int cell[3], step[3];
+  float next[3], delta[3];
+
+  for (int k = 0; k < 3; k++) {
+    // Distances stay measured from origin
+    cell[k] = getCell(t_origin[k] + t_direction[k] * enter);
+
+    if (t_direction[k] > 0.0F) {
+      step[k] = 1;
+      next[k] = ((cell[k] + 1) * cellSize - t_origin[k]) * invDir[k];
+      delta[k] = cellSize * invDir[k];
+    } else if (t_direction[k] < 0.0F) {
+      step[k] = -1;
+      next[k] = (cell[k] * cellSize - t_origin[k]) * invDir[k];
+      delta[k] = -cellSize * invDir[k];
+    } else {
+      step[k] = 0;
+      next[k] = FLT_MAX;
+      delta[k] = FLT_MAX;
+    }
+  }
+
+  float t = enter;
+  while (t <= exit) {
+    for (const auto& entry : buckets[getBucket(cell[0], cell[1], cell[2])]) {
+      const auto& proxy = proxies[entry.proxy];
+      if (proxy.queryStamp == stamp) continue;
+      if (entry.cell[0] != cell[0] || entry.cell[1] != cell[1] ||
+          entry.cell[2] != cell[2]) {
+        continue;
+      }
+
+      proxy.queryStamp = stamp;
+
+      // Slab test
+      float tmin = 0.0F;
+      float tmax = t_maxDistance;
+      for (int k = 0; k < 3; k++) {
+        float t1 = (proxy.min[k] - t_origin[k]) * invDir[k];
+        float t2 = (proxy.max[k] - t_origin[k]) * invDir[k];
+        if (t1 > t2) std::swap(t1, t2);
+        tmin = fmaxf(tmin, t1);
+        tmax = fminf(tmax, t2);
+      }
+
+      if (tmin <= tmax) o_hits.push_back({entry.proxy, tmin});
+    }
+
+    // Next cell on axis with nearest boundary
+    int axis = 0;
+    if (next[1] < next[axis]) axis = 1;
+    if (next[2] < next[axis]) axis = 2;
+
+    t = next[axis];
+    next[axis] += delta[axis];
+    cell[axis] += step[axis];
+  }
+
+  std::sort(o_hits.begin(), o_hits.end(),
+            [](const BroadphaseRayHit& a, const BroadphaseRayHit& b) {
+              return a.distance < b.distance;
+            });
+}
+
+}  // namespace Tyra
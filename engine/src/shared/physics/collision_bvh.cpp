@@ -0,0 +1,666 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "physics/collision_bvh.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+namespace Tyra {
+
+const unsigned int CollisionBvh::maxLeafTriangles = 4;
+const unsigned int CollisionBvh::maxSweepIterations = 24;
+const unsigned int CollisionBvh::maxStackSize = 64;
+const float CollisionBvh::sweepEpsilon = 0.001F;
+const float CollisionBvh::sweepMinApproach = 0.01F;
+
+static inline float dot3(const float* a, const float* b) {
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+static inline void sub3(float* o, const float* a, const float* b) {
+  o[0] = a[0] - b[0];
+  o[1] = a[1] - b[1];
+  o[2] = a[2] - b[2];
+}
+
+/** o = a + b * s */
+static inline void madd3(float* o, const float* a, const float* b,
+                         const float& s) {
+  o[0] = a[0] + b[0] * s;
+  o[1] = a[1] + b[1] * s;
+  o[2] = a[2] + b[2] * s;
+}
+
+static inline void cross3(float* o, const float* a, const float* b) {
+  const float x = a[1] * b[2] - a[2] * b[1];
+  const float y = a[2] * b[0] - a[0] * b[2];
+  const float z = a[0] * b[1] - a[1] * b[0];
+  o[0] = x;
+  o[1] = y;
+  o[2] = z;
+}
+
+static inline void copy3(float* o, const float* a) {
+  o[0] = a[0];
+  o[1] = a[1];
+  o[2] = a[2];
+}
+
+static inline float clamp01(const float& v) {
+  return v < 0.0F ? 0.0F : (v > 1.0F ? 1.0F : v);
+}
+
+/** Slab test, @returns entry distance or -1 */
+static inline float intersectNode(const CollisionBvhNode& node,
+                                  const float* origin, const float* invDir,
+                                  const float& maxDistance) {
+  float tmin = 0.0F;
+  float tmax = maxDistance;
+
+  for (int i = 0; i < 3; i++) {
+    float t1 = (node.min[i] - origin[i]) * invDir[i];
+    float t2 = (node.max[i] - origin[i]) * invDir[i];
+    if (t1 > t2) std::swap(t1, t2);
+    tmin = fmaxf(tmin, t1);
+    tmax = fminf(tmax, t2);
+  }
+
+  return tmin <= tmax ? tmin : -1.0F;
+}
+
+static inline bool overlapsNode(const CollisionBvhNode& node,
+                                const float* min, const float* max) {
+  return node.min[0] <= max[0] && node.max[0] >= min[0] &&
+         node.min[1] <= max[1] && node.max[1] >= min[1] &&
+         node.min[2] <= max[2] && node.max[2] >= min[2];
+}
+
+static inline float getNodeDistanceSq(const CollisionBvhNode& node,
+                                      const float* point) {
+  float result = 0.0F;
+  for (int i = 0; i < 3; i++) {
+    const float d = fmaxf(fmaxf(node.min[i] - point[i], 0.0F),
+                          point[i] - node.max[i]);
+    result += d * d;
+  }
+  return result;
+}
+
+/** Two sided Moller-Trumbore, @returns distance or -1 */
+static inline float intersectTriangle(const CollisionTriangle& triangle,
+                                      const float* origin,
+                                      const float* direction) {
+  float p[3], s[3], q[3];
+  cross3(p, direction, triangle.edge2);
+  const float det = dot3(triangle.edge1, p);
+  if (fabsf(det) < 1e-12F) return -1.0F;
+
+  const float invDet = 1.0F / det;
+  sub3(s, origin, triangle.v0);
+  const float u = dot3(s, p) * invDet;
+  if (u < 0.0F || u > 1.0F) return -1.0F;
+
+  cross3(q, s, triangle.edge1);
+  const float v = dot3(direction, q) * invDet;
+  if (v < 0.0F || u + v > 1.0F) return -1.0F;
+
+  return dot3(triangle.edge2, q) * invDet;
+}
+
+/** Ericson, Real-Time Collision Detection 5.1.5 */
+static void getClosestPointOnTriangle(float* o_point, const float* p,
+                                      const CollisionTriangle& triangle) {
+  const float* a = triangle.v0;
+  const float* ab = triangle.edge1;
+  const float* ac = triangle.edge2;
+
+  float ap[3], bp[3], cp[3], b[3], c[3];
+  sub3(ap, p, a);
+  const float d1 = dot3(ab, ap);
+  const float d2 = dot3(ac, ap);
+  if (d1 <= 0.0F && d2 <= 0.0F) return copy3(o_point, a);
+
+  madd3(b, a, ab, 1.0F);
+  sub3(bp, p, b);
+  const float d3 = dot3(ab, bp);
+  const float d4 = dot3(ac, bp);
+  if (d3 >= 0.0F && d4 <= d3) return copy3(o_point, b);
+
+  const float vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0F && d1 >= 0.0F && d3 <= 0.0F) {
+    return madd3(o_point, a, ab, d1 / (d1 - d3));
+  }
+
+  madd3(c, a, ac, 1.0F);
+  sub3(cp, p, c);
+  const float d5 = dot3(ab, cp);
+  const float d6 = dot3(ac, cp);
+  if (d6 >= 0.0F && d5 <= d6) return copy3(o_point, c);
+
+  const float vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0F && d2 >= 0.0F && d6 <= 0.0F) {
+    return madd3(o_point, a, ac, d2 / (d2 - d6));
+  }
+
+  const float va = d3 * d6 - d5 * d4;
+  if (va <= 0.0F && (d4 - d3) >= 0.0F && (d5 - d6) >= 0.0F) {
+    float bc[3];
+    sub3(bc, c, b);
+    return madd3(o_point, b, bc, (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+  }
+
+  const float denom = 1.0F / (va + vb + vc);
+  madd3(o_point, a, ab, vb * denom);
+  madd3(o_point, o_point, ac, vc * denom);
+}
+
+/** Ericson, Real-Time Collision Detection 5.1.9 */
+static void getClosestPointsOfSegments(float* o_a, float* o_b,
+                                       const float* p1, const float* q1,
+                                       const float* p2, const float* q2) {
+  float d1[3], d2[3], r[3];
+  sub3(d1, q1, p1);
+  sub3(d2, q2, p2);
+  sub3(r, p1, p2);
+
+  const float a = dot3(d1, d1);
+  const float e = dot3(d2, d2);
+  const float f = dot3(d2, r);
+  float s, t;
+
+  if (a <= FLT_EPSILON && e <= FLT_EPSILON) {
+    s = t = 0.0F;
+  } else if (a <= FLT_EPSILON) {
+    s = 0.0F;
+    t = clamp01(f / e);
+  } else {
+    const float c = dot3(d1, r);
+    if (e <= FLT_EPSILON) {
+      t = 0.0F;
+      s = clamp01(-c / a);
+    } else {
+      const float b = dot3(d1, d2);
+      const float denom = a * e - b * b;
+      s = denom != 0.0F ? clamp01((b * f - c * e) / denom) : 0.0F;
+      t = (b * s + f) / e;
+
+      if (t < 0.0F) {
+        t = 0.0F;
+        s = clamp01(-c / a);
+      } else if (t > 1.0F) {
+        t = 1.0F;
+        s = clamp01((b - c) / a);
+      }
+    }
+  }
+
+  madd3(o_a, p1, d1, s);
+  madd3(o_b, p2, d2, t);
+}
+
+static inline float getDistance(const float* a, const float* b) {
+  float d[3];
+  sub3(d, a, b);
+  return sqrtf(dot3(d, d));
+}
+
+CollisionBvh::CollisionBvh() {}
+
+CollisionBvh::~CollisionBvh() {}
+
+void CollisionBvh::addTriangles(const float* t_vertices,
+                                const unsigned int& t_count,
+                                const float* t_matrix) {
+  triangles.reserve(triangles.size() + t_count / 3);
+
+  for (unsigned int i = 0; i + 2 < t_count; i += 3) {
+    float v[3][3];
+
+    for (unsigned int j = 0; j < 3; j++) {
+      const float* in = &t_vertices[(i + j) * 4];
+      if (t_matrix == nullptr) {
+        copy3(v[j], in);
+        continue;
+      }
+
+      for (unsigned int row = 0; row < 3; row++) {
+        v[j][row] = t_matrix[row] * in[0] + t_matrix[4 + row] * in[1] +
+                    t_matrix[8 + row] * in[2] + t_matrix[12 + row] * in[3];
+      }
+    }
+
+    CollisionTriangle triangle;
+    copy3(triangle.v0, v[0]);
+    sub3(triangle.edge1, v[1], v[0]);
+    sub3(triangle.edge2, v[2], v[0]);
+    cross3(triangle.normal, triangle.edge1, triangle.edge2);
+
+    const float length = sqrtf(dot3(triangle.normal, triangle.normal));
+    if (length <= 0.0F) continue;  // Degenerate
+
+    for (int k = 0; k < 3; k++) triangle.normal[k] /= length;
+    triangle.v0[3] = triangle.edge1[3] = triangle.edge2[3] = 0.0F;
+    triangle.normal[3] = 0.0F;
+
+    triangles.push_back(triangle);
+  }
+}
+
+void CollisionBvh::clear() {
+  nodes.clear();
+  triangles.clear();
+}
+
+void CollisionBvh::build() {
+  nodes.clear();
+  if (triangles.empty()) return;
+
+  std::vector<unsigned int> indices(triangles.size());
+  std::vector<float> centroids(triangles.size() * 3);
+
+  for (unsigned int i = 0; i < triangles.size(); i++) {
+    const auto& triangle = triangles[i];
+    indices[i] = i;
+    for (int k = 0; k < 3; k++) {
+      centroids[i * 3 + k] = triangle.v0[k] + (triangle.edge1[k] +
+                                               triangle.edge2[k]) / 3.0F;
+    }
+  }
+
+  nodes.reserve(triangles.size() / maxLeafTriangles * 2 + 1);
+  nodes.resize(1);
+  buildNode(0, indices, centroids, 0, triangles.size());
+
+  // Leaves point to continuous triangle ranges
+  std::vector<CollisionTriangle> sorted(triangles.size());
+  for (unsigned int i = 0; i < indices.size(); i++) {
+    sorted[i] = triangles[indices[i]];
+  }
+  triangles.swap(sorted);
+}
+
+void CollisionBvh::buildNode(const unsigned int& t_node,
+                             std::vector<unsigned int>& indices,
+                             const std::vector<float>& centroids,
+                             const unsigned int& t_first,
+                             const unsigned int& t_count) {
+  float min[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+  float max[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+  float centroidMin[3] = {FLT_MAX, FLT_MAX, FLT_MAX};
+  float centroidMax[3] = {-FLT_MAX, -FLT_MAX, -FLT_MAX};
+
+  for (unsigned int i = t_first; i < t_first + t_count; i++) {
+    const auto& triangle = triangles[indices[i]];
+    for (int k = 0; k < 3; k++) {
+      const float a = triangle.v0[k];
+      const float b = a + triangle.edge1[k];
+      const float c = a + triangle.edge2[k];
+      min[k] = fminf(min[k], fminf(a, fminf(b, c)));
+      max[k] = fmaxf(max[k], fmaxf(a, fmaxf(b, c)));
+
+      const float centroid = centroids[indices[i] * 3 + k];
+      centroidMin[k] = fminf(centroidMin[k], centroid);
+      centroidMax[k] = fmaxf(centroidMax[k], centroid);
+    }
+  }
+
+  auto& node = nodes[t_node];
+  copy3(node.min, min);
+  copy3(node.max, max);
+
+  if (t_count <= maxLeafTriangles) {
+    node.index = t_first;
+    node.count = t_count;
+    return;
+  }
+
+  // Median split on longest axis of centroids
+  int axis = 0;
+  for (int k = 1; k < 3; k++) {
+    if (centroidMax[k] - centroidMin[k] >
+        centroidMax[axis] - centroidMin[axis]) {
+      axis = k;
+    }
+  }
+
+  const unsigned int half = t_count / 2;
+  std::nth_element(indices.begin() + t_first, indices.begin() + t_first + half,
+                   indices.begin() + t_first + t_count,
+                   [&centroids, axis](const unsigned int& a,
+                                      const unsigned int& b) {
+                     return centroids[a * 3 + axis] < centroids[b * 3 + axis];
+                   });
+
+  const unsigned int left = nodes.size();
+  nodes[t_node].index = left;
+  nodes[t_node].count = 0;
+  nodes.resize(nodes.size() + 2);
+
+  buildNode(left, indices, centroids, t_first, half);
+  buildNode(left + 1, indices, centroids, t_first + half, t_count - half);
+}
+
+bool CollisionBvh::raycast(const CollisionRay& t_ray,
+                           CollisionHit* o_hit) const {
+  o_hit->distance = -1.0F;
+  if (nodes.empty()) return false;
+
+  const float invDir[3] = {1.0F / t_ray.direction[0], 1.0F / t_ray.direction[1],
+                           1.0F / t_ray.direction[2]};
+
+  float best = t_ray.maxDistance;
+  int bestTriangle = -1;
+
+  unsigned int stack[maxStackSize];
+  unsigned int stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const auto& node = nodes[stack[--stackSize]];
+    if (intersectNode(node, t_ray.origin, invDir, best) < 0.0F) continue;
+
+    if (node.count == 0) {
+      stack[stackSize++] = node.index + 1;
+      stack[stackSize++] = node.index;
+      continue;
+    }
+
+    for (unsigned int i = node.index; i < node.index + node.count; i++) {
+      const float t =
+          intersectTriangle(triangles[i], t_ray.origin, t_ray.direction);
+      if (t >= 0.0F && t < best) {
+        best = t;
+        bestTriangle = i;
+      }
+    }
+  }
+
+  if (bestTriangle < 0) return false;
+
+  const auto& triangle = triangles[bestTriangle];
+  o_hit->distance = best;
+  o_hit->triangle = bestTriangle;
+  madd3(o_hit->point, t_ray.origin, t_ray.direction, best);
+  o_hit->point[3] = 1.0F;
+  copy3(o_hit->normal, triangle.normal);
+  o_hit->normal[3] = 0.0F;
+  return true;
+}
+
+unsigned int CollisionBvh::raycast(const CollisionRay* t_rays,
+                                   const unsigned int& t_count,
+                                   CollisionHit* o_hits) const {
+  unsigned int result = 0;
+  for (unsigned int i = 0; i < t_count; i++) {
+    if (raycast(t_rays[i], &o_hits[i])) result++;
+  }
+  return result;
+}
+
+bool CollisionBvh::isOccluded(const CollisionRay& t_ray) const {
+  if (nodes.empty()) return false;
+
+  const float invDir[3] = {1.0F / t_ray.direction[0], 1.0F / t_ray.direction[1],
+                           1.0F / t_ray.direction[2]};
+
+  unsigned int stack[maxStackSize];
+  unsigned int stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const auto& node = nodes[stack[--stackSize]];
+    if (intersectNode(node, t_ray.origin, invDir, t_ray.maxDistance) < 0.0F)
+      continue;
+
+    if (node.count == 0) {
+      stack[stackSize++] = node.index + 1;
+      stack[stackSize++] = node.index;
+      continue;
+    }
+
+    for (unsigned int i = node.index; i < node.index + node.count; i++) {
+      const float t =
+          intersectTriangle(triangles[i], t_ray.origin, t_ray.direction);
+      if (t >= 0.0F && t <= t_ray.maxDistance) return true;
+    }
+  }
+
+  return false;
+}
+
+float CollisionBvh::getSegmentTriangleDistance(
+    const float* t_a, const float* t_b, const CollisionTriangle& t_triangle,
+    float* o_segmentPoint, float* o_trianglePoint) {
+  float ab[3];
+  sub3(ab, t_b, t_a);
+
+  // Segment crosses triangle
+  const float t = intersectTriangle(t_triangle, t_a, ab);
+  if (t >= 0.0F && t <= 1.0F) {
+    madd3(o_segmentPoint, t_a, ab, t);
+    copy3(o_trianglePoint, o_segmentPoint);
+    return 0.0F;
+  }
+
+  // Endpoints vs triangle
+  float bestSegment[3], bestTriangle[3];
+  copy3(bestSegment, t_a);
+  getClosestPointOnTriangle(bestTriangle, t_a, t_triangle);
+  float best = getDistance(bestSegment, bestTriangle);
+
+  float point[3];
+  getClosestPointOnTriangle(point, t_b, t_triangle);
+  float distance = getDistance(t_b, point);
+  if (distance < best) {
+    best = distance;
+    copy3(bestSegment, t_b);
+    copy3(bestTriangle, point);
+  }
+
+  // Segment vs triangle edges
+  if (dot3(ab, ab) > FLT_EPSILON) {
+    float v1[3], v2[3];
+    madd3(v1, t_triangle.v0, t_triangle.edge1, 1.0F);
+    madd3(v2, t_triangle.v0, t_triangle.edge2, 1.0F);
+    const float* edges[3][2] = {{t_triangle.v0, v1}, {v1, v2},
+                                {v2, t_triangle.v0}};
+
+    for (int i = 0; i < 3; i++) {
+      float onSegment[3], onEdge[3];
+      getClosestPointsOfSegments(onSegment, onEdge, t_a, t_b, edges[i][0],
+                                 edges[i][1]);
+      distance = getDistance(onSegment, onEdge);
+      if (distance < best) {
+        best = distance;
+        copy3(bestSegment, onSegment);
+        copy3(bestTriangle, onEdge);
+      }
+    }
+  }
+
+  copy3(o_segmentPoint, bestSegment);
+  copy3(o_trianglePoint, bestTriangle);
+  return best;
+}
+
+bool CollisionBvh::sweepTriangle(const float* t_a, const float* t_b,
+                                 const float& t_radius,
+                                 const float* t_direction,
+                                 const float& t_distance,
+                                 const CollisionTriangle& t_triangle,
+                                 CollisionHit* o_hit) const {
+  float t = 0.0F;
+
+  for (unsigned int i = 0; i < maxSweepIterations; i++) {
+    float a[3], b[3], onSegment[3], onTriangle[3], normal[3];
+    madd3(a, t_a, t_direction, t);
+    madd3(b, t_b, t_direction, t);
+
+    const float distance =
+        getSegmentTriangleDistance(a, b, t_triangle, onSegment, onTriangle);
+
+    if (distance > 0.000001F) {
+      sub3(normal, onSegment, onTriangle);
+      for (int k = 0; k < 3; k++) normal[k] /= distance;
+    } else {
+      copy3(normal, t_triangle.normal);
+      if (dot3(normal, t_direction) > 0.0F) {
+        for (int k = 0; k < 3; k++) normal[k] = -normal[k];
+      }
+    }
+
+    // Rate of distance change, distance is convex so it only grows later
+    const float slope = dot3(t_direction, normal);
+    if (slope >= 0.0F) return false;
+
+    // Newton step, tangent of convex function never passes the root
+    const float step = (distance - t_radius) / -slope;
+
+    if (step <= sweepEpsilon || i == maxSweepIterations - 1) {
+      // Grazing contact (ex. shared edges of flat floor) doesn't block
+      if (slope > -sweepMinApproach) return false;
+
+      o_hit->distance = t;
+      copy3(o_hit->point, onTriangle);
+      o_hit->point[3] = 1.0F;
+      copy3(o_hit->normal, normal);
+      o_hit->normal[3] = 0.0F;
+      return true;
+    }
+
+    t += step;
+    if (t > t_distance) return false;
+  }
+
+  return false;
+}
+
+bool CollisionBvh::sweep(const float* t_a, const float* t_b,
+                         const float& t_radius, const float* t_direction,
+                         const float& t_distance, CollisionHit* o_hit) const {
+  o_hit->distance = -1.0F;
+  if (nodes.empty()) return false;
+
+  float min[3], max[3];
+  for (int k = 0; k < 3; k++) {
+    const float move = t_direction[k] * t_distance;
+    min[k] = fminf(t_a[k], t_b[k]) + fminf(move, 0.0F) - t_radius;
+    max[k] = fmaxf(t_a[k], t_b[k]) + fmaxf(move, 0.0F) + t_radius;
+  }
+
+  float best = t_distance;
+  CollisionHit hit;
+
+  unsigned int stack[maxStackSize];
+  unsigned int stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const auto& node = nodes[stack[--stackSize]];
+    if (!overlapsNode(node, min, max)) continue;
+
+    if (node.count == 0) {
+      stack[stackSize++] = node.index + 1;
+      stack[stackSize++] = node.index;
+      continue;
+    }
+
+    for (unsigned int i = node.index; i < node.index + node.count; i++) {
+      if (sweepTriangle(t_a, t_b, t_radius, t_direction, best, triangles[i],
+                        &hit) &&
+          (o_hit->distance < 0.0F || hit.distance < best)) {
+        best = hit.distance;
+        *o_hit = hit;
+        o_hit->triangle = i;
+      }
+    }
+  }
+
+  return o_hit->distance >= 0.0F;
+}
+
+bool CollisionBvh::sweepSphere(const float* t_center, const float& t_radius,
+                               const float* t_direction,
+                               const float& t_distance,
+                               CollisionHit* o_hit) const {
+  return sweep(t_center, t_center, t_radius, t_direction, t_distance, o_hit);
+}
+
+bool CollisionBvh::sweepCapsule(const float* t_a, const float* t_b,
+                                const float& t_radius,
+                                const float* t_direction,
+                                const float& t_distance,
+                                CollisionHit* o_hit) const {
+  return sweep(t_a, t_b, t_radius, t_direction, t_distance, o_hit);
+}
+
+bool CollisionBvh::closestPoint(const float* t_point,
+                                const float& t_maxDistance,
+                                CollisionHit* o_hit) const {
+  o_hit->distance = -1.0F;
+  if (nodes.empty()) return false;
+
+  float bestSq = t_maxDistance * t_maxDistance;
+  int bestTriangle = -1;
+  float bestPoint[3] = {0.0F, 0.0F, 0.0F};
+
+  unsigned int stack[maxStackSize];
+  unsigned int stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const auto& node = nodes[stack[--stackSize]];
+    if (getNodeDistanceSq(node, t_point) > bestSq) continue;
+
+    if (node.count == 0) {
+      // Nearer child on top of stack
+      const auto& left = nodes[node.index];
+      const auto& right = nodes[node.index + 1];
+      const bool isLeftNearer = getNodeDistanceSq(left, t_point) <
+                                getNodeDistanceSq(right, t_point);
+      stack[stackSize++] = isLeftNearer ? node.index + 1 : node.index;
+      stack[stackSize++] = isLeftNearer ? node.index : node.index + 1;
+      continue;
+    }
+
+    for (unsigned int i = node.index; i < node.index + node.count; i++) {
+      float point[3], d[3];
+      getClosestPointOnTriangle(point, t_point, triangles[i]);
+      sub3(d, t_point, point);
+
+      const float distanceSq = dot3(d, d);
+      if (distanceSq <= bestSq) {
+        bestSq = distanceSq;
+        bestTriangle = i;
+        copy3(bestPoint, point);
+      }
+    }
+  }
+
+  if (bestTriangle < 0) return false;
+
+  o_hit->distance = sqrtf(bestSq);
+  o_hit->triangle = bestTriangle;
+  copy3(o_hit->point, bestPoint);
+  o_hit->point[3] = 1.0F;
+
+  if (o_hit->distance > 0.000001F) {
+    sub3(o_hit->normal, t_point, bestPoint);
+    for (int k = 0; k < 3; k++) o_hit->normal[k] /= o_hit->distance;
+  } else {
+    copy3(o_hit->normal, triangles[bestTriangle].normal);
+  }
+  o_hit->normal[3] = 0.0F;
+
+  return true;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,78 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "renderer/dynamic_resolution.hpp"
+#include <cmath>
+
+namespace Tyra {
+
+const float DynamicResolution::scaleStep = 1.0F / 32.0F;
+const float DynamicResolution::upThreshold = 0.8F;
+// Multiple of scale step, so limited scale stays quantized
+const float DynamicResolution::maxChange = 3.0F / 32.0F;
+const float DynamicResolution::smoothing = 0.25F;
+
+DynamicResolution::DynamicResolution() { init(16683, 0.5F); }
+
+DynamicResolution::~DynamicResolution() {}
+
+void DynamicResolution::init(const unsigned int& t_targetTime,
+                             const float& t_minScale) {
+  targetTime = t_targetTime > 0 ? t_targetTime : 1;
+  minScale = t_minScale < scaleStep ? scaleStep : t_minScale;
+  if (minScale > 1.0F) minScale = 1.0F;
+  reset();
+}
+
+void DynamicResolution::reset() {
+  scale = 1.0F;
+  averageTime = 0.0F;
+}
+
+const float& DynamicResolution::update(const unsigned int& t_busyTime) {
+  if (averageTime == 0.0F) {
+    averageTime = static_cast<float>(t_busyTime);
+  } else {
+    averageTime += (t_busyTime - averageTime) * smoothing;
+  }
+
+  if (averageTime <= 0.0F) return scale;
+
+  // Hysteresis, scale up only with clear headroom
+  const auto ratio = targetTime / averageTime;
+  if (ratio >= 1.0F && ratio * upThreshold < 1.0F) return scale;
+
+  auto wanted = scale * std::sqrt(ratio);
+
+  if (wanted > scale + maxChange) wanted = scale + maxChange;
+  if (wanted < scale - maxChange) wanted = scale - maxChange;
+
+  // Round towards lower cost, so budget is kept after quantization
+  wanted = ratio < 1.0F ? std::floor(wanted / scaleStep) * scaleStep
+                        : std::floor(wanted / scaleStep + 0.001F) * scaleStep;
+
+  if (wanted > 1.0F) wanted = 1.0F;
+  if (wanted < minScale) wanted = minScale;
+
+  scale = wanted;
+  return scale;
+}
+
+unsigned int DynamicResolution::getScaledSize(
+    const unsigned int& t_size, const unsigned int& t_alignment) const {
+  const auto alignment = t_alignment > 0 ? t_alignment : 1;
+  auto result = static_cast<unsigned int>(t_size * scale / alignment + 0.5F);
+  if (result == 0) result = 1;
+  result *= alignment;
+
+  return result < t_size ? result : t_size;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,122 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "terrain/heightfield.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Tyra {
+
+Heightfield::Heightfield(const unsigned short* t_data,
+                         const unsigned int& t_width,
+                         const unsigned int& t_depth, const float& t_cellSize,
+                         const float& t_heightScale,
+                         const float& t_heightOffset)
+    : data(t_data, t_data + t_width * t_depth) {
+  width = t_width;
+  depth = t_depth;
+  cellSize = t_cellSize;
+  invCellSize = 1.0F / t_cellSize;
+  heightScale = t_heightScale;
+  heightOffset = t_heightOffset;
+}
+
+Heightfield::~Heightfield() {}
+
+float Heightfield::getSample(const int& t_x, const int& t_z) const {
+  const int x = std::min(std::max(t_x, 0), static_cast<int>(width) - 1);
+  const int z = std::min(std::max(t_z, 0), static_cast<int>(depth) - 1);
+  return data[z * width + x] * heightScale + heightOffset;
+}
+
+float Heightfield::getHeight(const float& t_x, const float& t_z) const {
+  const float maxX = static_cast<float>(width - 1);
+  const float maxZ = static_cast<float>(depth - 1);
+  const float gx = std::min(std::max(t_x * invCellSize, 0.0F), maxX);
+  const float gz = std::min(std::max(t_z * invCellSize, 0.0F), maxZ);
+
+  const int lastX = static_cast<int>(width) - 1;
+  const int lastZ = static_cast<int>(depth) - 1;
+  const int x = std::max(std::min(static_cast<int>(gx), lastX - 1), 0);
+  const int z = std::max(std::min(static_cast<int>(gz), lastZ - 1), 0);
+  const float fx = gx - x;
+  const float fz = gz - z;
+
+  // Single row/column heightfields have no second sample to blend with
+  const int x1 = std::min(x + 1, lastX);
+  const int z1 = std::min(z + 1, lastZ);
+
+  const float h00 = data[z * width + x];
+  const float h10 = data[z * width + x1];
+  const float h01 = data[z1 * width + x];
+  const float h11 = data[z1 * width + x1];
+
+  const float near = h00 + (h10 - h00) * fx;
+  const float far = h01 + (h11 - h01) * fx;
+  return (near + (far - near) * fz) * heightScale + heightOffset;
+}
+
+void Heightfield::getNormal(const float& t_x, const float& t_z,
+                            float* o_normal) const {
+  const float left = getHeight(t_x - cellSize, t_z);
+  const float right = getHeight(t_x + cellSize, t_z);
+  const float near = getHeight(t_x, t_z - cellSize);
+  const float far = getHeight(t_x, t_z + cellSize);
+
+  // Cross of (2 * cell, dx, 0) and (0, dz, 2 * cell), y up
+  const float x = left - right;
+  const float y = 2.0F * cellSize;
+  const float z = near - far;
+  const float invLength = 1.0F / sqrtf(x * x + y * y + z * z);
+
+  o_normal[0] = x * invLength;
+  o_normal[1] = y * invLength;
+  o_normal[2] = z * invLength;
+  o_normal[3] = 0.0F;
+}
+
+void Heightfield::getHeights(const float* t_positions,
+                             const unsigned int& t_count,
+                             float* o_heights) const {
+  for (unsigned int i = 0; i < t_count; i++) {
+    o_heights[i] = getHeight(t_positions[i * 4], t_positions[i * 4 + 2]);
+  }
+}
+
+void Heightfield::getRange(const int& t_x0, const int& t_z0, const int& t_x1,
+                           const int& t_z1, float* o_min,
+                           float* o_max) const {
+  unsigned short min = 0xFFFF;
+  unsigned short max = 0;
+
+  const int x0 = std::max(t_x0, 0);
+  const int z0 = std::max(t_z0, 0);
+  const int x1 = std::min(t_x1, static_cast<int>(width) - 1);
+  const int z1 = std::min(t_z1, static_cast<int>(depth) - 1);
+
+  for (int z = z0; z <= z1; z++) {
+    const unsigned short* row = &data[z * width];
+    for (int x = x0; x <= x1; x++) {
+      min = std::min(min, row[x]);
+      max = std::max(max, row[x]);
+    }
+  }
+
+  *o_min = min * heightScale + heightOffset;
+  *o_max = max * heightScale + heightOffset;
+  if (*o_min > *o_max) std::swap(*o_min, *o_max);  // Negative scale
+}
+
+bool Heightfield::isInside(const float& t_x, const float& t_z) const {
+  return t_x >= 0.0F && t_z >= 0.0F && t_x <= getSizeX() &&
+         t_z <= getSizeZ();
+}
+
+}  // namespace Tyra
@@ -0,0 +1,153 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "terrain/terrain_geomipmap.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Tyra {
+
+unsigned int TerrainGeomipmap::getChunksCount(
+    const unsigned int& t_samples, const unsigned int& t_chunkSize) {
+  return (t_samples - 1) / t_chunkSize;
+}
+
+unsigned int TerrainGeomipmap::selectLod(const float& t_distance,
+                                         const float& t_lodDistance,
+                                         const unsigned int& t_lodCount) {
+  const auto lod = static_cast<unsigned int>(t_distance / t_lodDistance);
+  return std::min(lod, t_lodCount - 1);
+}
+
+void TerrainGeomipmap::selectLods(const Heightfield& t_heightfield,
+                                  const unsigned int& t_chunkSize,
+                                  const float& t_x, const float& t_z,
+                                  const float& t_lodDistance,
+                                  const unsigned int& t_lodCount,
+                                  unsigned char* o_lods) {
+  const auto chunksX = getChunksCount(t_heightfield.getWidth(), t_chunkSize);
+  const auto chunksZ = getChunksCount(t_heightfield.getDepth(), t_chunkSize);
+  const float chunkWorldSize = t_chunkSize * t_heightfield.getCellSize();
+
+  for (unsigned int z = 0; z < chunksZ; z++) {
+    for (unsigned int x = 0; x < chunksX; x++) {
+      const float minX = x * chunkWorldSize;
+      const float minZ = z * chunkWorldSize;
+      const float dx = std::max(std::max(minX - t_x, 0.0F),
+                                t_x - (minX + chunkWorldSize));
+      const float dz = std::max(std::max(minZ - t_z, 0.0F),
+                                t_z - (minZ + chunkWorldSize));
+
+      o_lods[z * chunksX + x] = static_cast<unsigned char>(
+          selectLod(sqrtf(dx * dx + dz * dz), t_lodDistance, t_lodCount));
+    }
+  }
+}
+
+unsigned int TerrainGeomipmap::getVertexCount(const unsigned int& t_chunkSize,
+                                              const unsigned int& t_lod) {
+  const unsigned int quads = t_chunkSize >> t_lod;
+  return quads * quads * 6;
+}
+
+float TerrainGeomipmap::getVertexHeight(const Heightfield& t_heightfield,
+                                        const int& t_x, const int& t_z,
+                                        const int& t_x0, const int& t_z0,
+                                        const int& t_chunkSize,
+                                        const int* t_neighborSteps) {
+  const int localX = t_x - t_x0;
+  const int localZ = t_z - t_z0;
+
+  // Vertex on edge of X neighbor -> interpolate along Z
+  int step = 1;
+  if (localX == 0) step = t_neighborSteps[TERRAIN_EDGE_LEFT];
+  if (localX == t_chunkSize) step = t_neighborSteps[TERRAIN_EDGE_RIGHT];
+
+  if (step > 1 && localZ % step != 0) {
+    const int z0 = t_z0 + localZ / step * step;
+    const float fraction = static_cast<float>(t_z - z0) / step;
+    const float a = t_heightfield.getSample(t_x, z0);
+    const float b = t_heightfield.getSample(t_x, z0 + step);
+    return a + (b - a) * fraction;
+  }
+
+  step = 1;
+  if (localZ == 0) step = t_neighborSteps[TERRAIN_EDGE_NEAR];
+  if (localZ == t_chunkSize) step = t_neighborSteps[TERRAIN_EDGE_FAR];
+
+  if (step > 1 && localX % step != 0) {
+    const int x0 = t_x0 + localX / step * step;
+    const float fraction = static_cast<float>(t_x - x0) / step;
+    const float a = t_heightfield.getSample(x0, t_z);
+    const float b = t_heightfield.getSample(x0 + step, t_z);
+    return a + (b - a) * fraction;
+  }
+
+  return t_heightfield.getSample(t_x, t_z);
+}
+
+void TerrainGeomipmap::buildChunk(const Heightfield& t_heightfield,
+                                  const unsigned int& t_chunkX,
+                                  const unsigned int& t_chunkZ,
+                                  const unsigned int& t_chunkSize,
+                                  const unsigned int& t_lod,
+                                  const unsigned int* t_neighborLods,
+                                  float* o_positions, float* o_uvs,
+                                  const float& t_uvScale) {
+  const int step = 1 << t_lod;
+  const int size = t_chunkSize;
+  const int x0 = t_chunkX * t_chunkSize;
+  const int z0 = t_chunkZ * t_chunkSize;
+  const float cellSize = t_heightfield.getCellSize();
+  const float uScale = t_uvScale / (t_heightfield.getWidth() - 1);
+  const float vScale = t_uvScale / (t_heightfield.getDepth() - 1);
+
+  // Only coarser neighbors matter, finer ones snap to this chunk
+  int neighborSteps[TERRAIN_EDGES_COUNT];
+  for (int i = 0; i < TERRAIN_EDGES_COUNT; i++) {
+    neighborSteps[i] =
+        t_neighborLods[i] > t_lod ? 1 << t_neighborLods[i] : 1;
+  }
+
+  unsigned int index = 0;
+  auto addVertex = [&](const int& x, const int& z) {
+    float* position = &o_positions[index * 4];
+    position[0] = x * cellSize;
+    position[1] = getVertexHeight(t_heightfield, x, z, x0, z0, size,
+                                  neighborSteps);
+    position[2] = z * cellSize;
+    position[3] = 1.0F;
+
+    if (o_uvs) {
+      float* uv = &o_uvs[index * 4];
+      uv[0] = x * uScale;
+      uv[1] = z * vScale;
+      uv[2] = 1.0F;
+      uv[3] = 0.0F;
+    }
+
+    index++;
+  };
+
+  for (int z = z0; z < z0 + size; z += step) {
+    for (int x = x0; x < x0 + size; x += step) {
+      // Counter clockwise from above (+Y)
+      addVertex(x, z);
+      addVertex(x, z + step);
+      addVertex(x + step, z + step);
+
+      addVertex(x, z);
+      addVertex(x + step, z + step);
+      addVertex(x + step, z);
+    }
+  }
+}
+
+}  // namespace Tyra
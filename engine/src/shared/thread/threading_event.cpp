@@ -0,0 +1,21 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "thread/threading_event.hpp"
+
+namespace Tyra {
+
+ThreadingEvent::ThreadingEvent() {}
+
+ThreadingEvent::~ThreadingEvent() {}
+
+void ThreadingEvent::init() { sema.init(0, 1); }
+
+}  // namespace Tyra
@@ -0,0 +1,64 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "thread/threading_semaphore.hpp"
+
+#ifndef __mips__
+
+namespace Tyra {
+
+// Host version, EE one is in src/ps2/thread/threading_semaphore.cpp
+
+ThreadingSemaphore::ThreadingSemaphore() {
+  count = 0;
+  maxCount = 0;
+}
+
+ThreadingSemaphore::~ThreadingSemaphore() {}
+
+void ThreadingSemaphore::init(const int& t_initCount, const int& t_maxCount) {
+  count = t_initCount;
+  maxCount = t_maxCount;
+}
+
+void ThreadingSemaphore::wait() {
+  std::unique_lock<std::mutex> lock(mutex);
+  condition.wait(lock, [this]() { return count > 0; });
+  count--;
+}
+
+bool ThreadingSemaphore::tryWait() {
+  std::lock_guard<std::mutex> lock(mutex);
+  if (count == 0) return false;
+
+  count--;
+  return true;
+}
+
+void ThreadingSemaphore::signal() {
+  {
+    // Like SignalSema(), signal above max count is dropped
+    std::lock_guard<std::mutex> lock(mutex);
+    if (count >= maxCount) return;
+    count++;
+  }
+  condition.notify_one();
+}
+
+void ThreadingSemaphore::signalFromInterrupt() { signal(); }
+
+int ThreadingSemaphore::getCount() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return count;
+}
+
+}  // namespace Tyra
+
+#endif
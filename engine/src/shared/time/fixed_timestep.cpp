@@ -0,0 +1,48 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "time/fixed_timestep.hpp"
+
+namespace Tyra {
+
+FixedTimestep::FixedTimestep() { init(60.0F, 4); }
+
+FixedTimestep::~FixedTimestep() {}
+
+void FixedTimestep::init(const float& t_rate, const unsigned int& t_maxSteps) {
+  stepTime = 1.0F / t_rate;
+  maxSteps = t_maxSteps > 0 ? t_maxSteps : 1;
+  accumulator = 0.0F;
+  steps = 0;
+  dropped = 0;
+}
+
+void FixedTimestep::advance(const float& t_seconds) {
+  accumulator += t_seconds > 0.0F ? t_seconds : 0.0F;
+  steps = 0;
+
+  const float maxTime = stepTime * maxSteps;
+  if (accumulator >= maxTime + stepTime) {
+    const auto skipped =
+        static_cast<unsigned int>((accumulator - maxTime) / stepTime);
+    accumulator -= skipped * stepTime;
+    dropped += skipped;
+  }
+}
+
+bool FixedTimestep::step() {
+  if (accumulator < stepTime || steps >= maxSteps) return false;
+
+  accumulator -= stepTime;
+  steps++;
+  return true;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,103 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "time/frame_stats.hpp"
+#include <algorithm>
+#include <stdio.h>
+
+namespace Tyra {
+
+const unsigned int FrameStats::windowSize;
+const unsigned int FrameStats::bucketsCount;
+
+FrameStats::FrameStats(const unsigned int& t_bucketSize) {
+  bucketSize = t_bucketSize > 0 ? t_bucketSize : 1;
+  reset();
+}
+
+FrameStats::~FrameStats() {}
+
+void FrameStats::reset() {
+  for (auto& bucket : histogram) bucket = 0;
+  count = 0;
+  next = 0;
+  sum = 0;
+}
+
+void FrameStats::add(const unsigned int& t_microseconds) {
+  if (count == windowSize) {
+    const auto oldest = samples[next];
+    sum -= oldest;
+    histogram[getBucket(oldest)]--;
+  } else {
+    count++;
+  }
+
+  samples[next] = t_microseconds;
+  sum += t_microseconds;
+  histogram[getBucket(t_microseconds)]++;
+
+  next = (next + 1) % windowSize;
+}
+
+unsigned int FrameStats::getLast() const {
+  if (count == 0) return 0;
+  return samples[(next + windowSize - 1) % windowSize];
+}
+
+unsigned int FrameStats::getAverage() const {
+  if (count == 0) return 0;
+  return static_cast<unsigned int>(sum / count);
+}
+
+unsigned int FrameStats::getMin() const {
+  if (count == 0) return 0;
+  return *std::min_element(samples, samples + count);
+}
+
+unsigned int FrameStats::getMax() const {
+  if (count == 0) return 0;
+  return *std::max_element(samples, samples + count);
+}
+
+unsigned int FrameStats::getPercentile(const float& t_percent) const {
+  if (count == 0) return 0;
+
+  unsigned int sorted[windowSize];
+  std::copy(samples, samples + count, sorted);
+
+  // Nearest rank
+  auto rank = static_cast<unsigned int>(t_percent / 100.0F * count + 0.999F);
+  if (rank < 1) rank = 1;
+  if (rank > count) rank = count;
+
+  std::nth_element(sorted, sorted + rank - 1, sorted + count);
+  return sorted[rank - 1];
+}
+
+void FrameStats::print() const {
+  printf("Frame time (us): avg %u, min %u, max %u, p50 %u, p95 %u, p99 %u\n",
+         getAverage(), getMin(), getMax(), getPercentile(50.0F),
+         getPercentile(95.0F), getPercentile(99.0F));
+
+  for (unsigned int i = 0; i < bucketsCount; i++) {
+    if (histogram[i] == 0) continue;
+    printf("  %s%5.1f ms: %u\n", i == bucketsCount - 1 ? ">=" : "<",
+           (i + (i == bucketsCount - 1 ? 0 : 1)) * bucketSize / 1000.0F,
+           histogram[i]);
+  }
+}
+
+unsigned int FrameStats::getBucket(const unsigned int& t_microseconds) const {
+  const auto bucket = t_microseconds / bucketSize;
+  return bucket < bucketsCount ? bucket : bucketsCount - 1;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,37 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "utils/hash.hpp"
+
+namespace Tyra {
+
+const unsigned int Hash::offsetBasis = 2166136261U;
+const unsigned int Hash::prime = 16777619U;
+
+unsigned int Hash::fnv1a(const char* t_text) {
+  unsigned int result = offsetBasis;
+  while (*t_text) {
+    result ^= static_cast<unsigned char>(*t_text++);
+    result *= prime;
+  }
+  return result;
+}
+
+unsigned int Hash::fnv1a(const void* t_data, const unsigned int& t_size) {
+  const auto* data = static_cast<const unsigned char*>(t_data);
+  unsigned int result = offsetBasis;
+  for (unsigned int i = 0; i < t_size; i++) {
+    result ^= data[i];
+    result *= prime;
+  }
+  return result;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,143 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "utils/lz.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+const unsigned int Lz::minMatch = 4;
+const unsigned int Lz::maxOffset = 0xFFFF;
+const unsigned int Lz::hashBits = 14;
+
+/**
+ * Sequence: token (4 bits literals count, 4 bits match length - minMatch),
+ * [extra literals count], literals, 16bit LE offset, [extra match length].
+ * Count of 15 is extended by following bytes, 255 means "continue".
+ * Last sequence has literals only.
+ */
+std::vector<unsigned char> Lz::compress(const unsigned char* t_data,
+                                        const unsigned int& t_size) {
+  std::vector<unsigned char> result;
+  result.reserve(t_size + t_size / 255 + 16);
+
+  std::vector<int> table(1 << hashBits, -1);
+  auto hash = [](const unsigned char* p) {
+    unsigned int value;
+    memcpy(&value, p, 4);
+    return (value * 2654435761U) >> (32 - hashBits);
+  };
+
+  unsigned int anchor = 0;
+  unsigned int pos = 0;
+
+  while (t_size >= minMatch && pos <= t_size - minMatch) {
+    auto h = hash(t_data + pos);
+    int candidate = table[h];
+    table[h] = pos;
+
+    if (candidate < 0 || pos - candidate > maxOffset ||
+        memcmp(t_data + candidate, t_data + pos, minMatch) != 0) {
+      pos++;
+      continue;
+    }
+
+    unsigned int length = minMatch;
+    while (pos + length < t_size &&
+           t_data[candidate + length] == t_data[pos + length])
+      length++;
+
+    const unsigned int literals = pos - anchor;
+    const unsigned int matchExtra = length - minMatch;
+    result.push_back(((literals < 15 ? literals : 15) << 4) |
+                     (matchExtra < 15 ? matchExtra : 15));
+    if (literals >= 15) writeLength(result, literals - 15);
+    result.insert(result.end(), t_data + anchor, t_data + pos);
+
+    const unsigned int offset = pos - candidate;
+    result.push_back(offset & 0xFF);
+    result.push_back(offset >> 8);
+    if (matchExtra >= 15) writeLength(result, matchExtra - 15);
+
+    pos += length;
+    anchor = pos;
+  }
+
+  const unsigned int literals = t_size - anchor;
+  result.push_back((literals < 15 ? literals : 15) << 4);
+  if (literals >= 15) writeLength(result, literals - 15);
+  result.insert(result.end(), t_data + anchor, t_data + t_size);
+
+  return result;
+}
+
+void Lz::writeLength(std::vector<unsigned char>& output, unsigned int length) {
+  while (length >= 255) {
+    output.push_back(255);
+    length -= 255;
+  }
+  output.push_back(length);
+}
+
+bool Lz::decompress(const unsigned char* t_data, const unsigned int& t_size,
+                    unsigned char* o_output, const unsigned int& t_outputSize) {
+  const unsigned char* input = t_data;
+  const unsigned char* inputEnd = t_data + t_size;
+  unsigned char* output = o_output;
+  unsigned char* outputEnd = o_output + t_outputSize;
+
+  auto readLength = [&](unsigned int length, bool& ok) {
+    if (length != 15) return length;
+    unsigned char byte;
+    do {
+      if (input >= inputEnd) {
+        ok = false;
+        return length;
+      }
+      byte = *input++;
+      length += byte;
+    } while (byte == 255);
+    return length;
+  };
+
+  while (input < inputEnd) {
+    bool ok = true;
+    const unsigned char token = *input++;
+
+    const unsigned int literals = readLength(token >> 4, ok);
+    if (!ok || literals > static_cast<unsigned int>(inputEnd - input) ||
+        literals > static_cast<unsigned int>(outputEnd - output))
+      return false;
+    // Output can be null for empty buffer, memcpy doesn't allow it
+    if (literals) memcpy(output, input, literals);
+    input += literals;
+    output += literals;
+
+    if (input == inputEnd) break;  // Last sequence
+
+    if (inputEnd - input < 2) return false;
+    const unsigned int offset = input[0] | (input[1] << 8);
+    input += 2;
+
+    const unsigned int length = readLength(token & 0x0F, ok) + minMatch;
+    if (!ok || offset == 0 ||
+        offset > static_cast<unsigned int>(output - o_output) ||
+        length > static_cast<unsigned int>(outputEnd - output))
+      return false;
+
+    // Byte by byte, because match can overlap with itself
+    const unsigned char* match = output - offset;
+    for (unsigned int i = 0; i < length; i++) *output++ = *match++;
+  }
+
+  return output == outputEnd;
+}
+
+}  // namespace Tyra
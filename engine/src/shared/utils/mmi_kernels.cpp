@@ -0,0 +1,326 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "utils/mmi_kernels.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+typedef unsigned int uint128 __attribute__((mode(TI)));
+typedef unsigned long long uint64;
+
+#ifdef __mips__
+
+static const unsigned int halveAlphaConstants[8] __attribute__((aligned(16))) =
+    {0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 0x00FFFFFF, 1, 1, 1, 1};
+
+static const unsigned int swapNibblesConstants[8] __attribute__((aligned(16))) =
+    {0xF0F0F0F0, 0xF0F0F0F0, 0xF0F0F0F0, 0xF0F0F0F0,
+     0x0F0F0F0F, 0x0F0F0F0F, 0x0F0F0F0F, 0x0F0F0F0F};
+
+#endif
+
+void MmiKernels::halveAlpha(unsigned char* t_pixels,
+                            const unsigned int& t_count) {
+#ifdef __mips__
+  unsigned char* pixels = t_pixels;
+  unsigned int count = t_count;
+
+  if (!isAligned(pixels, 4)) {
+    halveAlphaScalar(pixels, count);
+    return;
+  }
+
+  while (count > 0 && !isAligned(pixels, 16)) {
+    halveAlphaScalar(pixels, 1);
+    pixels += 4;
+    count--;
+  }
+
+  // Per word: a = (a + ((a + 1) >> 8)) >> 1, equal to a * 128 / 255
+  unsigned int qwords = count / 4;
+  if (qwords > 0) {
+    asm volatile(
+        "lq       $9, 0(%2)         \n"
+        "lq       $10, 16(%2)       \n"
+        "1:                         \n"
+        "lq       $8, 0(%0)         \n"
+        "psrlw    $11, $8, 24       \n"
+        "paddw    $12, $11, $10     \n"
+        "psrlw    $12, $12, 8       \n"
+        "paddw    $11, $11, $12     \n"
+        "psrlw    $11, $11, 1       \n"
+        "psllw    $11, $11, 24      \n"
+        "pand     $8, $8, $9        \n"
+        "por      $8, $8, $11       \n"
+        "sq       $8, 0(%0)         \n"
+        "addiu    %1, %1, -1        \n"
+        "addiu    %0, %0, 16        \n"
+        "bnez     %1, 1b            \n"
+        : "+r"(pixels), "+r"(qwords)
+        : "r"(halveAlphaConstants)
+        : "$8", "$9", "$10", "$11", "$12", "memory");
+  }
+
+  halveAlphaScalar(pixels, count % 4);
+#else
+  halveAlphaScalar(t_pixels, t_count);
+#endif
+}
+
+void MmiKernels::halveAlphaScalar(unsigned char* t_pixels,
+                                  const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    t_pixels[i * 4 + 3] = static_cast<int>(t_pixels[i * 4 + 3]) * 128 / 255;
+  }
+}
+
+void MmiKernels::rgbxToRgb(unsigned char* o_pixels,
+                           const unsigned char* t_pixels,
+                           const unsigned int& t_count) {
+  if (!isAligned(o_pixels, 8) || !isAligned(t_pixels, 8)) {
+    rgbxToRgbScalar(o_pixels, t_pixels, t_count);
+    return;
+  }
+
+  // 8 pixels: 4 doublewords (2 pixels each) -> 3 doublewords
+  const auto* input = reinterpret_cast<const uint64*>(t_pixels);
+  auto* output = reinterpret_cast<uint64*>(o_pixels);
+  const unsigned int blocks = t_count / 8;
+
+  for (unsigned int i = 0; i < blocks; i++) {
+    uint64 packed[4];
+    for (unsigned int j = 0; j < 4; j++) {
+      const uint64 pair = input[j];
+      packed[j] = (pair & 0xFFFFFFULL) | ((pair >> 8) & 0xFFFFFF000000ULL);
+    }
+
+    output[0] = packed[0] | (packed[1] << 48);
+    output[1] = (packed[1] >> 16) | (packed[2] << 32);
+    output[2] = (packed[2] >> 32) | (packed[3] << 16);
+
+    input += 4;
+    output += 3;
+  }
+
+  rgbxToRgbScalar(o_pixels + blocks * 24, t_pixels + blocks * 32,
+                  t_count % 8);
+}
+
+void MmiKernels::rgbxToRgbScalar(unsigned char* o_pixels,
+                                 const unsigned char* t_pixels,
+                                 const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    o_pixels[i * 3] = t_pixels[i * 4];
+    o_pixels[i * 3 + 1] = t_pixels[i * 4 + 1];
+    o_pixels[i * 3 + 2] = t_pixels[i * 4 + 2];
+  }
+}
+
+void MmiKernels::rgbToRgba(unsigned char* o_pixels,
+                           const unsigned char* t_pixels,
+                           const unsigned int& t_count,
+                           const unsigned char& t_alpha) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    o_pixels[i * 4] = t_pixels[i * 3];
+    o_pixels[i * 4 + 1] = t_pixels[i * 3 + 1];
+    o_pixels[i * 4 + 2] = t_pixels[i * 3 + 2];
+    o_pixels[i * 4 + 3] = t_alpha;
+  }
+}
+
+void MmiKernels::swapNibbles(unsigned char* t_data,
+                             const unsigned int& t_size) {
+#ifdef __mips__
+  unsigned char* data = t_data;
+  unsigned int size = t_size;
+
+  while (size > 0 && !isAligned(data, 16)) {
+    swapNibblesScalar(data++, 1);
+    size--;
+  }
+
+  unsigned int qwords = size / 16;
+  if (qwords > 0) {
+    asm volatile(
+        "lq       $10, 0(%2)        \n"
+        "lq       $12, 16(%2)       \n"
+        "1:                         \n"
+        "lq       $8, 0(%0)         \n"
+        "psllh    $9, $8, 4         \n"
+        "pand     $9, $9, $10       \n"
+        "psrlh    $11, $8, 4        \n"
+        "pand     $11, $11, $12     \n"
+        "por      $8, $9, $11       \n"
+        "sq       $8, 0(%0)         \n"
+        "addiu    %1, %1, -1        \n"
+        "addiu    %0, %0, 16        \n"
+        "bnez     %1, 1b            \n"
+        : "+r"(data), "+r"(qwords)
+        : "r"(swapNibblesConstants)
+        : "$8", "$9", "$10", "$11", "$12", "memory");
+  }
+
+  swapNibblesScalar(data, size % 16);
+#else
+  swapNibblesScalar(t_data, t_size);
+#endif
+}
+
+void MmiKernels::swapNibblesScalar(unsigned char* t_data,
+                                   const unsigned int& t_size) {
+  for (unsigned int i = 0; i < t_size; i++) {
+    t_data[i] = (t_data[i] << 4) | (t_data[i] >> 4);
+  }
+}
+
+void MmiKernels::swizzleClutCsm1(unsigned int* t_clut,
+                                 const unsigned int& t_count) {
+  if (!isAligned(t_clut, 16)) {
+    swizzleClutCsm1Scalar(t_clut, t_count);
+    return;
+  }
+
+  // 32 entries = 8 qwords, swap qwords 2-3 with 4-5
+  auto* clut = reinterpret_cast<uint128*>(t_clut);
+  for (unsigned int i = 0; i < t_count / 32; i++, clut += 8) {
+    uint128 a = clut[2];
+    uint128 b = clut[3];
+    clut[2] = clut[4];
+    clut[3] = clut[5];
+    clut[4] = a;
+    clut[5] = b;
+  }
+}
+
+void MmiKernels::swizzleClutCsm1Scalar(unsigned int* t_clut,
+                                       const unsigned int& t_count) {
+  for (unsigned int i = 0; i < t_count; i++) {
+    if ((i & 0x18) == 8) {
+      unsigned int tmp = t_clut[i];
+      t_clut[i] = t_clut[i + 8];
+      t_clut[i + 8] = tmp;
+    }
+  }
+}
+
+void MmiKernels::bytesToFloats(float* o_vectors, const unsigned char* t_data,
+                               const unsigned int& t_count,
+                               const float* t_scale, const float* t_offset) {
+#ifdef __mips__
+  if (t_count == 0) return;
+
+  float* output = o_vectors;
+  const unsigned char* input = t_data;
+  unsigned int count = t_count;
+
+  // lwl/lwr - unaligned word, MMI unpack to 4 words, VU0 int -> float
+  asm volatile(
+      "lqc2     $vf2, 0(%3)           \n"
+      "lqc2     $vf3, 0(%4)           \n"
+      "1:                             \n"
+      "lwl      $8, 3(%1)             \n"
+      "lwr      $8, 0(%1)             \n"
+      "pextlb   $8, $0, $8            \n"
+      "pextlh   $8, $0, $8            \n"
+      "qmtc2    $8, $vf1              \n"
+      "vitof0.xyzw  $vf1, $vf1        \n"
+      "vmul.xyzw    $vf1, $vf1, $vf2  \n"
+      "vadd.xyzw    $vf1, $vf1, $vf3  \n"
+      "sqc2     $vf1, 0(%0)           \n"
+      "addiu    %2, %2, -1            \n"
+      "addiu    %1, %1, 4             \n"
+      "addiu    %0, %0, 16            \n"
+      "bnez     %2, 1b                \n"
+      : "+r"(output), "+r"(input), "+r"(count)
+      : "r"(t_scale), "r"(t_offset)
+      : "$8", "memory");
+#else
+  bytesToFloatsScalar(o_vectors, t_data, t_count, t_scale, t_offset);
+#endif
+}
+
+void MmiKernels::bytesToFloatsScalar(float* o_vectors,
+                                     const unsigned char* t_data,
+                                     const unsigned int& t_count,
+                                     const float* t_scale,
+                                     const float* t_offset) {
+  for (unsigned int i = 0; i < t_count * 4; i++) {
+    o_vectors[i] =
+        static_cast<float>(t_data[i]) * t_scale[i % 4] + t_offset[i % 4];
+  }
+}
+
+void MmiKernels::halfwordsToFloats(float* o_vectors,
+                                   const unsigned short* t_data,
+                                   const unsigned int& t_count,
+                                   const float* t_scale,
+                                   const float* t_offset) {
+#ifdef __mips__
+  if (t_count == 0) return;
+
+  float* output = o_vectors;
+  const unsigned short* input = t_data;
+  unsigned int count = t_count;
+
+  // ldl/ldr - unaligned doubleword, MMI unpack to 4 words, VU0 int -> float
+  asm volatile(
+      "lqc2     $vf2, 0(%3)           \n"
+      "lqc2     $vf3, 0(%4)           \n"
+      "1:                             \n"
+      "ldl      $8, 7(%1)             \n"
+      "ldr      $8, 0(%1)             \n"
+      "pextlh   $8, $0, $8            \n"
+      "qmtc2    $8, $vf1              \n"
+      "vitof0.xyzw  $vf1, $vf1        \n"
+      "vmul.xyzw    $vf1, $vf1, $vf2  \n"
+      "vadd.xyzw    $vf1, $vf1, $vf3  \n"
+      "sqc2     $vf1, 0(%0)           \n"
+      "addiu    %2, %2, -1            \n"
+      "addiu    %1, %1, 8             \n"
+      "addiu    %0, %0, 16            \n"
+      "bnez     %2, 1b                \n"
+      : "+r"(output), "+r"(input), "+r"(count)
+      : "r"(t_scale), "r"(t_offset)
+      : "$8", "memory");
+#else
+  halfwordsToFloatsScalar(o_vectors, t_data, t_count, t_scale, t_offset);
+#endif
+}
+
+void MmiKernels::halfwordsToFloatsScalar(float* o_vectors,
+                                         const unsigned short* t_data,
+                                         const unsigned int& t_count,
+                                         const float* t_scale,
+                                         const float* t_offset) {
+  for (unsigned int i = 0; i < t_count * 4; i++) {
+    o_vectors[i] =
+        static_cast<float>(t_data[i]) * t_scale[i % 4] + t_offset[i % 4];
+  }
+}
+
+void MmiKernels::copy128(void* o_data, const void* t_data,
+                         const unsigned int& t_qwords) {
+  auto* output = static_cast<uint128*>(o_data);
+  const auto* input = static_cast<const uint128*>(t_data);
+  for (unsigned int i = 0; i < t_qwords; i++) output[i] = input[i];
+}
+
+void MmiKernels::fill128(void* o_data, const unsigned int& t_value,
+                         const unsigned int& t_qwords) {
+  uint128 value = t_value;
+  value |= value << 32;
+  value |= value << 64;
+
+  auto* output = static_cast<uint128*>(o_data);
+  for (unsigned int i = 0; i < t_qwords; i++) output[i] = value;
+}
+
+}  // namespace Tyra
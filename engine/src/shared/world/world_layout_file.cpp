@@ -0,0 +1,177 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "world/world_layout_file.hpp"
+#include <cstring>
+
+namespace Tyra {
+
+const unsigned int WorldLayoutFile::version = 1;
+
+unsigned int WorldLayoutFile::getIndicesOffset(
+    const WorldLayoutHeader* header) {
+  return sizeof(WorldLayoutHeader) +
+         header->cellsCount * sizeof(WorldLayoutCell) +
+         header->texturesCount * sizeof(WorldLayoutTexture);
+}
+
+bool WorldLayoutFile::validate(const unsigned char* t_data,
+                               const unsigned int& t_size) {
+  if (t_size < sizeof(WorldLayoutHeader)) return false;
+
+  const auto* header = getHeader(t_data);
+  if (memcmp(header->magic, "TYWL", 4) != 0 || header->version != version ||
+      header->size != t_size || !(header->cellSize > 0.0F))
+    return false;
+
+  const unsigned long long tablesEnd =
+      sizeof(WorldLayoutHeader) +
+      static_cast<unsigned long long>(header->cellsCount) *
+          sizeof(WorldLayoutCell) +
+      static_cast<unsigned long long>(header->texturesCount) *
+          sizeof(WorldLayoutTexture);
+  if (tablesEnd > header->stringsOffset || header->stringsOffset > t_size ||
+      header->stringsSize > t_size - header->stringsOffset)
+    return false;
+
+  if (header->stringsSize > 0 &&
+      t_data[header->stringsOffset + header->stringsSize - 1] != 0)
+    return false;
+
+  const unsigned int indicesCount =
+      (header->stringsOffset - tablesEnd) / sizeof(unsigned int);
+
+  for (unsigned int i = 0; i < header->cellsCount; i++) {
+    const auto* cell = getCell(t_data, i);
+    if (cell->meshPathOffset >= header->stringsSize ||
+        cell->firstTexture > indicesCount ||
+        cell->texturesCount > indicesCount - cell->firstTexture)
+      return false;
+
+    for (unsigned int j = 0; j < cell->texturesCount; j++)
+      if (getCellTexture(t_data, cell, j) >= header->texturesCount)
+        return false;
+  }
+
+  for (unsigned int i = 0; i < header->texturesCount; i++)
+    if (getTexture(t_data, i)->nameOffset >= header->stringsSize) return false;
+
+  return true;
+}
+
+const WorldLayoutHeader* WorldLayoutFile::getHeader(
+    const unsigned char* t_data) {
+  return reinterpret_cast<const WorldLayoutHeader*>(t_data);
+}
+
+const WorldLayoutCell* WorldLayoutFile::getCell(const unsigned char* t_data,
+                                                const unsigned int& t_index) {
+  return reinterpret_cast<const WorldLayoutCell*>(
+             t_data + sizeof(WorldLayoutHeader)) +
+         t_index;
+}
+
+const WorldLayoutTexture* WorldLayoutFile::getTexture(
+    const unsigned char* t_data, const unsigned int& t_index) {
+  return reinterpret_cast<const WorldLayoutTexture*>(
+             t_data + sizeof(WorldLayoutHeader) +
+             getHeader(t_data)->cellsCount * sizeof(WorldLayoutCell)) +
+         t_index;
+}
+
+unsigned int WorldLayoutFile::getCellTexture(const unsigned char* t_data,
+                                             const WorldLayoutCell* t_cell,
+                                             const unsigned int& t_index) {
+  const auto* indices = reinterpret_cast<const unsigned int*>(
+      t_data + getIndicesOffset(getHeader(t_data)));
+  return indices[t_cell->firstTexture + t_index];
+}
+
+const char* WorldLayoutFile::getString(const unsigned char* t_data,
+                                       const unsigned int& t_offset) {
+  return reinterpret_cast<const char*>(
+      t_data + getHeader(t_data)->stringsOffset + t_offset);
+}
+
+std::vector<unsigned char> WorldLayoutFile::build(
+    const WorldLayoutSource& t_source) {
+  if (!(t_source.cellSize > 0.0F)) return {};
+
+  std::vector<WorldLayoutCell> cells(t_source.cells.size());
+  std::vector<WorldLayoutTexture> textures(t_source.textures.size());
+  std::vector<unsigned int> indices;
+  std::string strings;
+
+  auto addString = [&strings](const std::string& text) {
+    unsigned int offset = strings.size();
+    strings.append(text);
+    strings.push_back('\0');
+    return offset;
+  };
+
+  for (unsigned int i = 0; i < textures.size(); i++) {
+    textures[i].nameOffset = addString(t_source.textures[i].name);
+    textures[i].vramSize = t_source.textures[i].vramSize;
+  }
+
+  for (unsigned int i = 0; i < cells.size(); i++) {
+    const auto& source = t_source.cells[i];
+    auto& cell = cells[i];
+    memset(&cell, 0, sizeof(WorldLayoutCell));
+
+    cell.x = source.x;
+    cell.z = source.z;
+    cell.meshPathOffset = addString(source.meshPath);
+    cell.ramSize = source.ramSize;
+    cell.firstTexture = indices.size();
+    cell.texturesCount = source.textures.size();
+
+    for (const auto& texture : source.textures) {
+      if (texture >= textures.size()) return {};
+      indices.push_back(texture);
+    }
+
+    for (unsigned int axis = 0; axis < 3; axis++) {
+      cell.min[axis] = source.min[axis];
+      cell.max[axis] = source.max[axis];
+    }
+    cell.min[3] = cell.max[3] = 1.0F;
+  }
+
+  WorldLayoutHeader header;
+  memcpy(header.magic, "TYWL", 4);
+  header.version = version;
+  header.cellsCount = cells.size();
+  header.texturesCount = textures.size();
+  header.cellSize = t_source.cellSize;
+  header.stringsOffset =
+      getIndicesOffset(&header) + indices.size() * sizeof(unsigned int);
+  header.stringsSize = strings.size();
+  header.size = header.stringsOffset + strings.size();
+
+  std::vector<unsigned char> result(header.size, 0);
+  auto* output = result.data();
+
+  auto write = [&output](const void* data, const unsigned int& size) {
+    if (size == 0) return;
+    memcpy(output, data, size);
+    output += size;
+  };
+
+  write(&header, sizeof(WorldLayoutHeader));
+  write(cells.data(), cells.size() * sizeof(WorldLayoutCell));
+  write(textures.data(), textures.size() * sizeof(WorldLayoutTexture));
+  write(indices.data(), indices.size() * sizeof(unsigned int));
+  write(strings.data(), strings.size());
+
+  return result;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,105 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "world/world_splitter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+
+namespace Tyra {
+
+std::vector<WorldSplitCell> WorldSplitter::split(
+    const BinaryMeshSource& t_mesh, const float& t_cellSize) {
+  std::map<std::pair<int, int>, WorldSplitCell> cells;
+
+  for (unsigned int m = 0; m < t_mesh.materials.size(); m++) {
+    const auto& material = t_mesh.materials[m];
+    if (material.frames.empty()) continue;
+
+    const auto& frame = material.frames[0];
+    const auto& vertices = frame.arrays[BINARY_MESH_VERTICES];
+
+    for (unsigned int t = 0; t + 3 <= frame.count; t += 3) {
+      const float x =
+          (vertices[t * 4] + vertices[t * 4 + 4] + vertices[t * 4 + 8]) / 3;
+      const float z = (vertices[t * 4 + 2] + vertices[t * 4 + 6] +
+                       vertices[t * 4 + 10]) /
+                      3;
+      const int cellX = static_cast<int>(floorf(x / t_cellSize));
+      const int cellZ = static_cast<int>(floorf(z / t_cellSize));
+
+      auto found = cells.find({cellZ, cellX});
+      if (found == cells.end()) {
+        WorldSplitCell cell;
+        cell.x = cellX;
+        cell.z = cellZ;
+        cell.mesh.loadNormals = t_mesh.loadNormals;
+        cell.mesh.loadLightmap = t_mesh.loadLightmap;
+        for (unsigned int axis = 0; axis < 3; axis++) {
+          cell.min[axis] = vertices[t * 4 + axis];
+          cell.max[axis] = vertices[t * 4 + axis];
+        }
+        found = cells.insert({{cellZ, cellX}, cell}).first;
+      }
+
+      auto& cell = found->second;
+
+      // Materials are visited in order, so current one is always the last
+      if (cell.mesh.materials.empty() ||
+          cell.mesh.materials.back().name != material.name) {
+        BinaryMeshSourceMaterial outMaterial;
+        outMaterial.name = material.name;
+        outMaterial.texturePath = material.texturePath;
+        std::copy(material.ambient, material.ambient + 4,
+                  outMaterial.ambient);
+        outMaterial.frames.resize(1);
+        outMaterial.frames[0].count = 0;
+        cell.mesh.materials.push_back(outMaterial);
+      }
+
+      auto& outFrame = cell.mesh.materials.back().frames[0];
+      outFrame.count += 3;
+
+      for (unsigned int k = 0; k < BINARY_MESH_ARRAYS_COUNT; k++) {
+        const auto& array = frame.arrays[k];
+        if (array.empty()) continue;
+        outFrame.arrays[k].insert(outFrame.arrays[k].end(),
+                                  array.begin() + t * 4,
+                                  array.begin() + (t + 3) * 4);
+      }
+
+      for (unsigned int v = t; v < t + 3; v++)
+        for (unsigned int axis = 0; axis < 3; axis++) {
+          cell.min[axis] = std::min(cell.min[axis], vertices[v * 4 + axis]);
+          cell.max[axis] = std::max(cell.max[axis], vertices[v * 4 + axis]);
+        }
+    }
+  }
+
+  std::vector<WorldSplitCell> result;
+  result.reserve(cells.size());
+  for (auto& cell : cells) result.push_back(std::move(cell.second));
+
+  return result;
+}
+
+unsigned int WorldSplitter::getArraysSize(const BinaryMeshSource& t_mesh) {
+  unsigned int result = 0;
+
+  for (const auto& material : t_mesh.materials)
+    for (const auto& frame : material.frames)
+      for (unsigned int k = 0; k < BINARY_MESH_ARRAYS_COUNT; k++)
+        result += frame.arrays[k].size() * sizeof(float);
+
+  return result;
+}
+
+}  // namespace Tyra
@@ -0,0 +1,177 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+#include "world/world_streaming_planner.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Tyra {
+
+float WorldStreamingPlanner::getDistance(const WorldLayoutCell* t_cell,
+                                         const float& t_x, const float& t_z) {
+  const float dx = std::max(std::max(t_cell->min[0] - t_x, 0.0F),
+                            t_x - t_cell->max[0]);
+  const float dz = std::max(std::max(t_cell->min[2] - t_z, 0.0F),
+                            t_z - t_cell->max[2]);
+  return sqrtf(dx * dx + dz * dz);
+}
+
+void WorldStreamingPlanner::getUsage(
+    const unsigned char* t_layout, const std::vector<WorldCellState>& t_states,
+    unsigned int* o_ram, unsigned int* o_vram) {
+  const auto* header = WorldLayoutFile::getHeader(t_layout);
+  std::vector<bool> textures(header->texturesCount, false);
+
+  *o_ram = 0;
+  *o_vram = 0;
+
+  for (unsigned int i = 0; i < header->cellsCount; i++) {
+    if (t_states[i] == WORLD_CELL_UNLOADED) continue;
+
+    const auto* cell = WorldLayoutFile::getCell(t_layout, i);
+    *o_ram += cell->ramSize;
+
+    for (unsigned int j = 0; j < cell->texturesCount; j++) {
+      const auto texture = WorldLayoutFile::getCellTexture(t_layout, cell, j);
+      if (textures[texture]) continue;
+      textures[texture] = true;
+      *o_vram += WorldLayoutFile::getTexture(t_layout, texture)->vramSize;
+    }
+  }
+}
+
+WorldStreamingPlan WorldStreamingPlanner::plan(
+    const unsigned char* t_layout, const std::vector<WorldCellState>& t_states,
+    const float& t_x, const float& t_z,
+    const WorldStreamingOptions& t_options) {
+  const auto* header = WorldLayoutFile::getHeader(t_layout);
+  const unsigned int cellsCount = header->cellsCount;
+
+  WorldStreamingPlan result;
+  result.overBudget = 0;
+
+  std::vector<WorldCellState> states = t_states;
+  std::vector<float> distances(cellsCount);
+  std::vector<unsigned int> textureRefs(header->texturesCount, 0);
+  unsigned int ram = 0, vram = 0, inFlight = 0;
+
+  auto forEachTexture = [&](const WorldLayoutCell* cell, auto callback) {
+    for (unsigned int j = 0; j < cell->texturesCount; j++)
+      callback(WorldLayoutFile::getCellTexture(t_layout, cell, j));
+  };
+
+  auto getVramSize = [&](const unsigned int& texture) {
+    return WorldLayoutFile::getTexture(t_layout, texture)->vramSize;
+  };
+
+  auto acquire = [&](const unsigned int& index) {
+    const auto* cell = WorldLayoutFile::getCell(t_layout, index);
+    ram += cell->ramSize;
+    forEachTexture(cell, [&](const unsigned int& texture) {
+      if (textureRefs[texture]++ == 0) vram += getVramSize(texture);
+    });
+  };
+
+  auto release = [&](const unsigned int& index) {
+    const auto* cell = WorldLayoutFile::getCell(t_layout, index);
+    ram -= cell->ramSize;
+    forEachTexture(cell, [&](const unsigned int& texture) {
+      if (--textureRefs[texture] == 0) vram -= getVramSize(texture);
+    });
+    states[index] = WORLD_CELL_UNLOADED;
+    result.evictions.push_back(index);
+  };
+
+  std::vector<unsigned int> candidates;
+
+  for (unsigned int i = 0; i < cellsCount; i++) {
+    distances[i] = getDistance(WorldLayoutFile::getCell(t_layout, i), t_x, t_z);
+
+    if (states[i] != WORLD_CELL_UNLOADED) acquire(i);
+    if (states[i] == WORLD_CELL_LOADING) inFlight++;
+    if (states[i] == WORLD_CELL_UNLOADED &&
+        distances[i] <= t_options.prefetchRadius)
+      candidates.push_back(i);
+  }
+
+  for (unsigned int i = 0; i < cellsCount; i++) {
+    if (states[i] == WORLD_CELL_RESIDENT &&
+        distances[i] > t_options.evictRadius)
+      release(i);
+  }
+
+  std::sort(candidates.begin(), candidates.end(),
+            [&](const unsigned int& a, const unsigned int& b) {
+              return distances[a] < distances[b];
+            });
+
+  // Resident cells outside load radius, furthest first
+  auto getVictim = [&](const float& closerThan) {
+    int victim = -1;
+    for (unsigned int i = 0; i < cellsCount; i++) {
+      if (states[i] != WORLD_CELL_RESIDENT ||
+          distances[i] <= t_options.loadRadius || distances[i] <= closerThan)
+        continue;
+      if (victim == -1 || distances[i] > distances[victim]) victim = i;
+    }
+    return victim;
+  };
+
+  for (const auto& index : candidates) {
+    const bool required = distances[index] <= t_options.loadRadius;
+
+    if (inFlight >= t_options.maxLoadsInFlight) break;
+
+    const auto* cell = WorldLayoutFile::getCell(t_layout, index);
+
+    auto fits = [&]() {
+      unsigned int extraVram = 0;
+      forEachTexture(cell, [&](const unsigned int& texture) {
+        if (textureRefs[texture] == 0) extraVram += getVramSize(texture);
+      });
+      return ram + cell->ramSize <= t_options.ramBudget &&
+             vram + extraVram <= t_options.vramBudget;
+    };
+
+    // Make room only by evicting cells further than this one, no thrashing.
+    // Victims are released on trial, and restored if room is still too
+    // small, otherwise they would be evicted and reloaded every frame.
+    const unsigned int savedRam = ram, savedVram = vram;
+    const auto savedEvictions = result.evictions.size();
+    const auto savedTextureRefs = textureRefs;
+
+    while (!fits()) {
+      const int victim = getVictim(distances[index]);
+      if (victim == -1) break;
+      release(victim);
+    }
+
+    if (!fits()) {
+      for (auto i = savedEvictions; i < result.evictions.size(); i++)
+        states[result.evictions[i]] = WORLD_CELL_RESIDENT;
+      result.evictions.resize(savedEvictions);
+      textureRefs = savedTextureRefs;
+      ram = savedRam;
+      vram = savedVram;
+
+      if (required) result.overBudget++;
+      continue;
+    }
+
+    acquire(index);
+    states[index] = WORLD_CELL_LOADING;
+    inFlight++;
+    result.loads.push_back(index);
+  }
+
+  return result;
+}
+
+}  // namespace Tyra
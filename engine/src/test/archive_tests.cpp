@@ -0,0 +1,166 @@
+#include "doctest.hpp"
+#include "archive/archive_file.hpp"
+#include "utils/lz.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace Tyra;
+
+static std::vector<unsigned char> makeText(const unsigned int& size) {
+  const std::string line = "v 1.000000 -1.000000 0.500000\nvt 0.25 0.75\n";
+  std::vector<unsigned char> result(size);
+  for (unsigned int i = 0; i < size; i++) result[i] = line[i % line.size()];
+  return result;
+}
+
+TEST_CASE("LZ roundtrip") {
+  std::vector<std::vector<unsigned char>> inputs;
+  inputs.push_back({});
+  inputs.push_back({1, 2, 3});
+  inputs.push_back(makeText(100000));
+  inputs.push_back(std::vector<unsigned char>(5000, 0xAB));
+
+  std::vector<unsigned char> noise(3000);
+  srand(7);
+  for (auto& byte : noise) byte = rand() & 0xFF;
+  inputs.push_back(noise);
+
+  for (const auto& input : inputs) {
+    auto packed = Lz::compress(input.data(), input.size());
+    std::vector<unsigned char> output(input.size());
+    CHECK(Lz::decompress(packed.data(), packed.size(), output.data(),
+                         output.size()));
+    CHECK(output == input);
+  }
+
+  auto text = makeText(100000);
+  CHECK(Lz::compress(text.data(), text.size()).size() < text.size() / 10);
+}
+
+TEST_CASE("LZ rejects corrupted data") {
+  auto text = makeText(4000);
+  auto packed = Lz::compress(text.data(), text.size());
+  std::vector<unsigned char> output(text.size());
+
+  CHECK_FALSE(Lz::decompress(packed.data(), packed.size() - 3, output.data(),
+                             output.size()));
+  CHECK_FALSE(Lz::decompress(packed.data(), packed.size(), output.data(),
+                             output.size() - 1));
+}
+
+TEST_CASE("Archive build and find") {
+  std::vector<ArchiveSource> sources;
+  sources.push_back({"meshes/Warrior.obj", makeText(30000), true});
+  sources.push_back({"textures\\warrior.png", {9, 8, 7, 6}, true});
+  sources.push_back({"./sounds/shoot.adpcm", makeText(5000), false});
+
+  auto archive = ArchiveFile::build(sources);
+  REQUIRE(ArchiveFile::validate(archive.data(), archive.size(),
+                                archive.size()));
+  CHECK(archive.size() % ArchiveFile::sectorSize == 0);
+
+  const auto* header = ArchiveFile::getHeader(archive.data());
+  CHECK(header->count == 3);
+  CHECK(header->dataOffset == ArchiveFile::sectorSize);
+
+  const auto* obj = ArchiveFile::find(
+      archive.data(), ArchiveFile::getNameHash("MESHES/warrior.obj"));
+  REQUIRE(obj != nullptr);
+  CHECK(obj->offset == header->dataOffset);
+  CHECK(obj->compression == ARCHIVE_COMPRESSION_LZ);
+  CHECK(obj->size < obj->unpackedSize);
+
+  std::vector<unsigned char> unpacked(obj->unpackedSize);
+  CHECK(Lz::decompress(archive.data() + obj->offset, obj->size,
+                       unpacked.data(), unpacked.size()));
+  CHECK(unpacked == sources[0].data);
+
+  // Too small to gain anything, stored as is
+  const auto* png = ArchiveFile::find(
+      archive.data(), ArchiveFile::getNameHash("textures/warrior.png"));
+  REQUIRE(png != nullptr);
+  CHECK(png->compression == ARCHIVE_COMPRESSION_NONE);
+  CHECK(png->offset % ArchiveFile::sectorSize == 0);
+  CHECK(png->offset > obj->offset);
+
+  const auto* adpcm = ArchiveFile::find(
+      archive.data(), ArchiveFile::getNameHash("sounds/shoot.adpcm"));
+  REQUIRE(adpcm != nullptr);
+  CHECK(adpcm->compression == ARCHIVE_COMPRESSION_NONE);
+  CHECK(adpcm->size == 5000);
+
+  CHECK(ArchiveFile::find(archive.data(), ArchiveFile::getNameHash("x")) ==
+        nullptr);
+
+  sources.push_back({"Meshes/warrior.OBJ", {1}, false});
+  CHECK(ArchiveFile::build(sources).empty());
+}
+
+TEST_CASE("Archive empty entry before bigger one") {
+  std::vector<ArchiveSource> sources;
+  sources.push_back({"empty.txt", {}, true});
+  sources.push_back({"mesh.obj", makeText(3000), false});
+
+  auto archive = ArchiveFile::build(sources);
+  REQUIRE(ArchiveFile::validate(archive.data(), archive.size(),
+                                archive.size()));
+
+  const auto* empty =
+      ArchiveFile::find(archive.data(), ArchiveFile::getNameHash("empty.txt"));
+  const auto* mesh =
+      ArchiveFile::find(archive.data(), ArchiveFile::getNameHash("mesh.obj"));
+  REQUIRE(empty != nullptr);
+  REQUIRE(mesh != nullptr);
+  CHECK(empty->size == 0);
+  CHECK(empty->unpackedSize == 0);
+  CHECK(mesh->size == 3000);
+
+  // Same offset, so reader can't tell entries apart by it
+  CHECK(empty->offset == mesh->offset);
+
+  std::vector<const ArchiveEntry*> wanted = {empty, mesh};
+  auto spans = ArchiveFile::planReads(wanted, 4096, 64 * 1024);
+  REQUIRE(spans.size() == 1);
+  CHECK(spans[0].offset == mesh->offset);
+  CHECK(spans[0].size == mesh->size);
+  CHECK(spans[0].entries.size() == 2);
+}
+
+TEST_CASE("Archive validation rejects broken TOC") {
+  std::vector<ArchiveSource> sources;
+  sources.push_back({"a", makeText(100), false});
+  auto archive = ArchiveFile::build(sources);
+
+  // Truncated file
+  CHECK_FALSE(ArchiveFile::validate(archive.data(), archive.size(),
+                                    ArchiveFile::sectorSize + 50));
+
+  auto broken = archive;
+  broken[0] = 'X';
+  CHECK_FALSE(ArchiveFile::validateHeader(broken.data(), broken.size()));
+}
+
+TEST_CASE("Archive read planning merges neighbors") {
+  ArchiveEntry entries[4];
+  const unsigned int offsets[4] = {2048, 4096, 8192, 1024 * 1024};
+  for (unsigned int i = 0; i < 4; i++) {
+    entries[i].offset = offsets[i];
+    entries[i].size = 1000;
+  }
+
+  std::vector<const ArchiveEntry*> wanted = {&entries[3], &entries[0],
+                                             &entries[2], &entries[1],
+                                             &entries[0]};
+  auto spans = ArchiveFile::planReads(wanted, 4096, 64 * 1024);
+
+  REQUIRE(spans.size() == 2);
+  CHECK(spans[0].offset == 2048);
+  CHECK(spans[0].size == 8192 + 1000 - 2048);
+  CHECK(spans[0].entries.size() == 3);
+  CHECK(spans[1].offset == 1024 * 1024);
+  CHECK(spans[1].entries.size() == 1);
+
+  spans = ArchiveFile::planReads(wanted, 4096, 4000);
+  CHECK(spans.size() == 3);
+}
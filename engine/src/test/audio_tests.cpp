@@ -0,0 +1,315 @@
+#include "doctest.hpp"
+#include "audio/audio_stream_ring.hpp"
+#include "audio/ima_adpcm.hpp"
+#include "audio/wav_parser.hpp"
+#include "audio/sound_bank_file.hpp"
+#include "audio/voice_manager.hpp"
+#include "utils/hash.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace Tyra;
+
+TEST_CASE("IMA ADPCM roundtrip keeps the signal") {
+  const unsigned int channels = 2;
+  const unsigned int blockAlign = 512 * channels;
+  const unsigned int samples =
+      ImaAdpcm::getSamplesPerBlock(blockAlign, channels);
+
+  CHECK(samples == 1017);
+
+  std::vector<short> pcm(samples * channels);
+  for (unsigned int i = 0; i < samples; i++) {
+    pcm[i * channels] = static_cast<short>(8000.0F * sinf(i * 0.05F));
+    pcm[i * channels + 1] = static_cast<short>(4000.0F * sinf(i * 0.11F));
+  }
+
+  std::vector<unsigned char> block(blockAlign);
+  unsigned char indexes[channels] = {0, 0};
+  ImaAdpcm::encodeBlock(pcm.data(), samples, blockAlign, channels, indexes,
+                        block.data());
+
+  std::vector<short> decoded(samples * channels);
+  CHECK(ImaAdpcm::decodeBlock(block.data(), blockAlign, channels,
+                              decoded.data()) == samples);
+
+  // Header sample is stored losslessly
+  CHECK(decoded[0] == pcm[0]);
+  CHECK(decoded[1] == pcm[1]);
+
+  // Skip the attack, where step index is still adapting
+  int maxError = 0;
+  for (unsigned int i = 64 * channels; i < samples * channels; i++)
+    maxError = std::max(maxError, std::abs(decoded[i] - pcm[i]));
+  CHECK(maxError < 600);
+}
+
+TEST_CASE("IMA ADPCM decodes shorter last block") {
+  const unsigned int channels = 1;
+  const unsigned int blockAlign = 256;
+  unsigned char block[blockAlign] = {};
+  short decoded[1 + (blockAlign - 4) * 2];
+
+  CHECK(ImaAdpcm::decodeBlock(block, 4 + 8, channels, decoded) == 1 + 16);
+  CHECK(ImaAdpcm::decodeBlock(block, 3, channels, decoded) == 0);
+}
+
+TEST_CASE("WAV header parsing") {
+  WavInfo info;
+  info.format = WAV_FORMAT_IMA_ADPCM;
+  info.channels = 2;
+  info.sampleRate = 22050;
+  info.bitsPerSample = 4;
+  info.blockAlign = 1024;
+  info.samplesPerBlock = ImaAdpcm::getSamplesPerBlock(1024, 2);
+  info.dataSize = 4096;
+
+  unsigned char header[64];
+  const unsigned int headerSize = WavParser::write(info, header);
+
+  WavInfo parsed;
+  REQUIRE(WavParser::parse(header, headerSize, 0, &parsed));
+  CHECK(parsed.format == WAV_FORMAT_IMA_ADPCM);
+  CHECK(parsed.channels == 2);
+  CHECK(parsed.sampleRate == 22050);
+  CHECK(parsed.blockAlign == 1024);
+  CHECK(parsed.samplesPerBlock == info.samplesPerBlock);
+  CHECK(parsed.dataOffset == headerSize);
+  CHECK(parsed.dataSize == 4096);
+
+  // Truncated file
+  REQUIRE(WavParser::parse(header, headerSize, headerSize + 100, &parsed));
+  CHECK(parsed.dataSize == 100);
+
+  header[0] = 'X';
+  CHECK_FALSE(WavParser::parse(header, headerSize, 0, &parsed));
+}
+
+TEST_CASE("WAV parsing rejects huge chunk size") {
+  unsigned char header[64] = {};
+  memcpy(header, "RIFF", 4);
+  memcpy(header + 8, "WAVE", 4);
+  memcpy(header + 12, "LIST", 4);
+  const unsigned char hugeSize[4] = {0xF8, 0xFF, 0xFF, 0xFF};
+  memcpy(header + 16, hugeSize, 4);
+  memcpy(header + 20, "data", 4);
+
+  WavInfo parsed;
+  CHECK_FALSE(WavParser::parse(header, sizeof(header), 0, &parsed));
+
+  header[16] = 0xFF;
+  CHECK_FALSE(WavParser::parse(header, sizeof(header), 0, &parsed));
+}
+
+class FakeVoiceBackend : public VoiceBackend {
+ public:
+  void* samples[VoiceManager::maxChannels] = {};
+  unsigned char volumes[VoiceManager::maxChannels] = {};
+  unsigned int queries = 0;
+
+  bool play(const int& t_channel, void* t_sample) override {
+    samples[t_channel] = t_sample;
+    return true;
+  }
+
+  bool isPlaying(const int& t_channel, void* t_sample) override {
+    queries++;
+    return samples[t_channel] == t_sample;
+  }
+
+  void setVolume(const int& t_channel,
+                 const unsigned char& t_volume) override {
+    volumes[t_channel] = t_volume;
+  }
+
+  void finish(const int& t_channel) { samples[t_channel] = nullptr; }
+};
+
+TEST_CASE("Voice manager steals least important voice") {
+  FakeVoiceBackend backend;
+  VoiceManager manager;
+  manager.init(&backend, 4, 2);
+
+  int a = 0, b = 0, c = 0, channel = -1;
+  VoiceRequest low;
+  low.priority = 10;
+  VoiceRequest high;
+  high.priority = 200;
+
+  CHECK(manager.play(&a, high) == VOICE_PLAYED);
+  CHECK(manager.play(&b, low, &channel) == VOICE_PLAYED);
+  CHECK(channel == 5);
+  CHECK(backend.queries == 0);
+
+  // Full, low priority sound can't steal high priority one
+  low.priority = 5;
+  CHECK(manager.play(&c, low) == VOICE_REJECTED);
+
+  CHECK(manager.play(&c, high, &channel) == VOICE_STOLEN);
+  CHECK(channel == 5);
+  CHECK(backend.samples[4] == &a);
+
+  // Finished voices are found by refresh, without stealing
+  backend.finish(4);
+  CHECK(manager.play(&b, low, &channel) == VOICE_PLAYED);
+  CHECK(channel == 4);
+
+  CHECK(manager.getStats().played == 4);
+  CHECK(manager.getStats().stolen == 1);
+  CHECK(manager.getStats().rejected == 1);
+}
+
+TEST_CASE("Voice manager category limits and distance culling") {
+  FakeVoiceBackend backend;
+  VoiceManager manager;
+  manager.init(&backend, 0, 8);
+  manager.setCategoryLimit(1, 2);
+
+  int shot = 0, step = 0, channel = -1;
+  VoiceRequest request;
+  request.category = 1;
+
+  CHECK(manager.play(&shot, request) == VOICE_PLAYED);
+  CHECK(manager.play(&shot, request) == VOICE_PLAYED);
+  CHECK(manager.play(&shot, request, &channel) == VOICE_STOLEN);
+  CHECK(channel == 0);  // oldest one
+  CHECK(manager.getActiveCount() == 2);
+
+  VoiceRequest far;
+  far.volume = 80;
+  far.distance = 150.0F;
+  far.maxDistance = 100.0F;
+  CHECK(manager.play(&step, far) == VOICE_CULLED);
+
+  far.distance = 50.0F;
+  CHECK(manager.play(&step, far, &channel) == VOICE_PLAYED);
+  CHECK(backend.volumes[channel] == 40);
+}
+
+TEST_CASE("Sound bank build and lookup") {
+  std::vector<SoundBankSource> sources(2);
+  sources[0].name = "shoot";
+  sources[0].data = {1, 2, 3};
+  sources[1].name = "punch";
+  sources[1].data = {4, 5, 6, 7, 8};
+
+  auto bank = SoundBankFile::build(sources);
+  REQUIRE(SoundBankFile::validate(bank.data(), bank.size()));
+  CHECK(SoundBankFile::getCount(bank.data()) == 2);
+
+  const auto* entry = SoundBankFile::find(bank.data(), Hash::fnv1a("punch"));
+  REQUIRE(entry != nullptr);
+  CHECK(entry->offset % SoundBankFile::alignment == 0);
+  CHECK(entry->size == 5);
+  CHECK(bank[entry->offset + 4] == 8);
+
+  CHECK(SoundBankFile::find(bank.data(), Hash::fnv1a("missing")) == nullptr);
+  CHECK_FALSE(SoundBankFile::validate(bank.data(), entry->offset));
+
+  // Entries table size wraps around to few bytes
+  auto* header = reinterpret_cast<SoundBankHeader*>(bank.data());
+  header->count = 0xFFFFFFFF / sizeof(SoundBankEntry) + 1;
+  CHECK_FALSE(SoundBankFile::validate(bank.data(), bank.size()));
+}
+
+static bool writeSlot(AudioStreamRing& ring, const unsigned int& size,
+                      const bool& end, const bool& loop) {
+  ring.beginWrite()->size = size;
+  return ring.endWrite(ring.getGeneration(), end, loop);
+}
+
+/** Writes slot after consumer is already blocked in acquire() */
+static std::thread writeSlotLater(AudioStreamRing& ring,
+                                  const unsigned int& size, const bool& end) {
+  return std::thread([&ring, size, end]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    writeSlot(ring, size, end, false);
+  });
+}
+
+TEST_CASE("Audio stream ring passes slots in order") {
+  AudioStreamSlot slots[3];
+  AudioStreamStats stats = {0, 0, 0, 0, 3};
+  AudioStreamRing ring;
+  ring.init(slots, 3, &stats);
+
+  CHECK_FALSE(writeSlot(ring, 10, false, false));
+  CHECK_FALSE(writeSlot(ring, 20, false, false));
+  CHECK(ring.getFilledCount() == 2);
+  CHECK(ring.getFreeCount() == 1);
+
+  auto* slot = ring.acquire();
+  CHECK(slot == &slots[0]);
+  CHECK(slot->size == 10);
+  ring.release();
+
+  slot = ring.acquire();
+  CHECK(slot == &slots[1]);
+  CHECK(slot->size == 20);
+  ring.release();
+
+  CHECK(ring.getFreeCount() == 3);
+  CHECK(stats.minFilledSlots == 1);
+  CHECK(stats.underruns == 0);
+}
+
+TEST_CASE("Audio stream ring drops slots of older generation") {
+  AudioStreamSlot slots[3];
+  AudioStreamStats stats = {0, 0, 0, 0, 3};
+  AudioStreamRing ring;
+  ring.init(slots, 3, &stats);
+
+  writeSlot(ring, 10, false, false);
+  writeSlot(ring, 20, false, false);
+  CHECK(ring.nextGeneration() == 1);
+  writeSlot(ring, 30, false, false);
+
+  auto* slot = ring.acquire();
+  CHECK(slot == &slots[2]);
+  CHECK(slot->size == 30);
+  CHECK(ring.isCurrent(slot));
+  CHECK(ring.getFreeCount() == 2);
+
+  ring.nextGeneration();
+  CHECK_FALSE(ring.isCurrent(slot));
+  ring.release();
+}
+
+TEST_CASE("Audio stream ring loop wrap and underruns") {
+  AudioStreamSlot slots[2];
+  AudioStreamStats stats = {0, 0, 0, 0, 2};
+  AudioStreamRing ring;
+  ring.init(slots, 2, &stats);
+
+  // Empty data can't loop, reader would spin on it
+  CHECK_FALSE(writeSlot(ring, 0, true, true));
+  CHECK_FALSE(ring.acquire()->wrapped);
+  ring.release();
+
+  CHECK(writeSlot(ring, 10, true, true));
+  CHECK(ring.acquire()->wrapped);
+  ring.release();
+
+  // Looping playback is primed, so waiting for data is underrun
+  auto writer = writeSlotLater(ring, 10, true);
+  auto* slot = ring.acquire();
+  writer.join();
+  CHECK(stats.underruns == 1);
+  CHECK(stats.minFilledSlots == 0);
+  CHECK(slot->last);
+  CHECK_FALSE(slot->wrapped);
+  ring.release();
+
+  // After end of data, waiting for next song is not underrun
+  writer = writeSlotLater(ring, 10, false);
+  ring.acquire();
+  writer.join();
+  ring.release();
+  CHECK(stats.underruns == 1);
+}
+
@@ -0,0 +1,173 @@
+#include "doctest.hpp"
+#include "physics/broadphase.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+using namespace Tyra;
+
+struct TestBox {
+  float min[3], max[3];
+};
+
+static TestBox createBox(const float& x, const float& y, const float& z,
+                         const float& size) {
+  return {{x, y, z}, {x + size, y + size, z + size}};
+}
+
+static bool overlaps(const TestBox& a, const TestBox& b) {
+  for (int k = 0; k < 3; k++) {
+    if (a.min[k] > b.max[k] || a.max[k] < b.min[k]) return false;
+  }
+  return true;
+}
+
+static std::vector<BroadphasePair> getSortedPairs(const Broadphase& t_broad) {
+  std::vector<BroadphasePair> result;
+  t_broad.findPairs(result);
+  std::sort(result.begin(), result.end(),
+            [](const BroadphasePair& a, const BroadphasePair& b) {
+              return a.a != b.a ? a.a < b.a : a.b < b.b;
+            });
+  return result;
+}
+
+static std::vector<BroadphasePair> getBruteForcePairs(
+    const std::vector<TestBox>& boxes) {
+  std::vector<BroadphasePair> result;
+  for (unsigned int i = 0; i < boxes.size(); i++) {
+    for (unsigned int j = i + 1; j < boxes.size(); j++) {
+      if (overlaps(boxes[i], boxes[j])) result.push_back({i, j});
+    }
+  }
+  return result;
+}
+
+static void checkPairs(const std::vector<BroadphasePair>& a,
+                       const std::vector<BroadphasePair>& b) {
+  REQUIRE(a.size() == b.size());
+  for (unsigned int i = 0; i < a.size(); i++) {
+    CHECK(a[i].a == b[i].a);
+    CHECK(a[i].b == b[i].b);
+  }
+}
+
+TEST_CASE("Broadphase pairs match brute force after moves") {
+  srand(1234);
+  auto random = [](const float& range) {
+    return (rand() / static_cast<float>(RAND_MAX)) * range - range * 0.5F;
+  };
+
+  // Small bucket count forces hash collisions
+  Broadphase broadphase(2.0F, 64);
+  std::vector<TestBox> boxes;
+
+  for (unsigned int i = 0; i < 300; i++) {
+    boxes.push_back(createBox(random(40.0F), random(4.0F), random(40.0F),
+                              0.5F + (i % 5) * 0.8F));
+    CHECK(broadphase.add(boxes[i].min, boxes[i].max, i * 10) == i);
+  }
+
+  checkPairs(getSortedPairs(broadphase), getBruteForcePairs(boxes));
+
+  for (int frame = 0; frame < 5; frame++) {
+    for (unsigned int i = 0; i < boxes.size(); i++) {
+      const float dx = random(3.0F);
+      const float dz = random(3.0F);
+      boxes[i].min[0] += dx;
+      boxes[i].max[0] += dx;
+      boxes[i].min[2] += dz;
+      boxes[i].max[2] += dz;
+      broadphase.update(i, boxes[i].min, boxes[i].max);
+    }
+
+    checkPairs(getSortedPairs(broadphase), getBruteForcePairs(boxes));
+  }
+
+  CHECK(broadphase.getUserData(7) == 70);
+}
+
+TEST_CASE("Broadphase remove reuses ids and drops pairs") {
+  Broadphase broadphase(1.0F);
+  auto a = createBox(0.0F, 0.0F, 0.0F, 1.0F);
+  auto b = createBox(0.5F, 0.5F, 0.5F, 1.0F);
+  auto c = createBox(-3.5F, 0.0F, 0.0F, 1.0F);
+
+  const auto idA = broadphase.add(a.min, a.max);
+  const auto idB = broadphase.add(b.min, b.max);
+  broadphase.add(c.min, c.max);
+
+  std::vector<BroadphasePair> pairs;
+  broadphase.findPairs(pairs);
+  REQUIRE(pairs.size() == 1);
+  CHECK(pairs[0].a == idA);
+  CHECK(pairs[0].b == idB);
+
+  broadphase.remove(idB);
+  broadphase.findPairs(pairs);
+  CHECK(pairs.empty());
+  CHECK(broadphase.getProxiesCount() == 2);
+
+  CHECK(broadphase.add(c.min, c.max) == idB);
+  broadphase.findPairs(pairs);
+  CHECK(pairs.size() == 1);
+}
+
+TEST_CASE("Broadphase box and ray queries") {
+  Broadphase broadphase(2.0F);
+  std::vector<TestBox> boxes;
+  for (int i = 0; i < 10; i++) {
+    boxes.push_back(createBox(i * 4.0F, 0.0F, -0.5F, 1.0F));
+    broadphase.add(boxes[i].min, boxes[i].max);
+  }
+
+  // Big box spanning many cells is reported once
+  auto big = createBox(-10.0F, -10.0F, -10.0F, 20.0F);
+  const auto idBig = broadphase.add(big.min, big.max);
+
+  std::vector<unsigned int> found;
+  const float min[3] = {3.5F, 0.2F, -1.0F};
+  const float max[3] = {8.5F, 0.4F, 1.0F};
+  broadphase.queryBox(min, max, found);
+  std::sort(found.begin(), found.end());
+  REQUIRE(found.size() == 3);
+  CHECK(found[0] == 1);
+  CHECK(found[1] == 2);
+  CHECK(found[2] == idBig);
+
+  std::vector<BroadphaseRayHit> hits;
+  const float origin[3] = {-1.0F, 0.5F, 0.0F};
+  const float direction[3] = {1.0F, 0.0F, 0.0F};
+  broadphase.queryRay(origin, direction, 13.5F, hits);
+
+  REQUIRE(hits.size() == 5);
+  CHECK(hits[0].proxy == idBig);
+  CHECK(hits[0].distance == doctest::Approx(0.0F));
+  CHECK(hits[1].proxy == 0);
+  CHECK(hits[1].distance == doctest::Approx(1.0F));
+  CHECK(hits[2].proxy == 1);
+  CHECK(hits[2].distance == doctest::Approx(5.0F));
+  CHECK(hits[4].proxy == 3);
+
+  // Negative direction
+  const float back[3] = {-1.0F, 0.0F, 0.0F};
+  const float far[3] = {40.0F, 0.5F, 0.0F};
+  broadphase.queryRay(far, back, 6.0F, hits);
+  REQUIRE(hits.size() == 1);
+  CHECK(hits[0].proxy == 9);
+  CHECK(hits[0].distance == doctest::Approx(3.0F));
+
+  // Unlimited distance ends at last proxy, from far outside too
+  broadphase.queryRay(origin, direction, INFINITY, hits);
+  CHECK(hits.size() == 11);
+  const float veryFar[3] = {1000000.0F, 0.5F, 0.0F};
+  broadphase.queryRay(veryFar, back, FLT_MAX, hits);
+  CHECK(hits.size() == 11);
+  CHECK(hits.back().proxy == 0);
+
+  Broadphase empty(2.0F);
+  empty.queryRay(origin, direction, INFINITY, hits);
+  CHECK(hits.empty());
+}
@@ -0,0 +1,196 @@
+#include "doctest.hpp"
+#include "physics/collision_bvh.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace Tyra;
+
+static void addQuad(std::vector<float>& vertices, const float* a,
+                    const float* b, const float* c, const float* d) {
+  const float* corners[6] = {a, b, c, a, c, d};
+  for (auto* corner : corners) {
+    vertices.insert(vertices.end(), {corner[0], corner[1], corner[2], 1.0F});
+  }
+}
+
+/** Floor grid at y = 0, cells of size 1, from -n to n, with wall at x = n */
+static std::vector<float> createLevel(const int& n) {
+  std::vector<float> result;
+
+  for (int z = -n; z < n; z++) {
+    for (int x = -n; x < n; x++) {
+      const float a[3] = {x + 0.0F, 0.0F, z + 0.0F};
+      const float b[3] = {x + 0.0F, 0.0F, z + 1.0F};
+      const float c[3] = {x + 1.0F, 0.0F, z + 1.0F};
+      const float d[3] = {x + 1.0F, 0.0F, z + 0.0F};
+      addQuad(result, a, b, c, d);
+    }
+  }
+
+  const float a[3] = {n + 0.0F, 0.0F, -n + 0.0F};
+  const float b[3] = {n + 0.0F, 10.0F, -n + 0.0F};
+  const float c[3] = {n + 0.0F, 10.0F, n + 0.0F};
+  const float d[3] = {n + 0.0F, 0.0F, n + 0.0F};
+  addQuad(result, a, b, c, d);
+
+  return result;
+}
+
+static CollisionRay createRay(const float& x, const float& y, const float& z,
+                              const float& dx, const float& dy,
+                              const float& dz) {
+  const float length = sqrtf(dx * dx + dy * dy + dz * dz);
+  return {{x, y, z, 1.0F}, {dx / length, dy / length, dz / length, 0.0F},
+          1000.0F};
+}
+
+TEST_CASE("Collision BVH nodes contain their triangles") {
+  auto level = createLevel(8);
+  CollisionBvh bvh;
+  bvh.addTriangles(level.data(), level.size() / 4);
+  bvh.build();
+
+  CHECK(bvh.getTriangles().size() == level.size() / 12);
+
+  unsigned int leafTriangles = 0;
+  for (const auto& node : bvh.getNodes()) {
+    if (node.count == 0) continue;
+    CHECK(node.count <= CollisionBvh::maxLeafTriangles);
+    leafTriangles += node.count;
+
+    for (unsigned int i = node.index; i < node.index + node.count; i++) {
+      const auto& triangle = bvh.getTriangles()[i];
+      for (int k = 0; k < 3; k++) {
+        CHECK(triangle.v0[k] >= node.min[k]);
+        CHECK(triangle.v0[k] + triangle.edge1[k] <= node.max[k]);
+      }
+    }
+  }
+
+  CHECK(leafTriangles == bvh.getTriangles().size());
+}
+
+TEST_CASE("Collision BVH raycast matches brute force") {
+  auto level = createLevel(32);
+  CollisionBvh bvh;
+  bvh.addTriangles(level.data(), level.size() / 4);
+  bvh.build();
+
+  std::vector<CollisionRay> rays;
+  for (int i = 0; i < 200; i++) {
+    rays.push_back(createRay((i % 17) - 8.0F, 5.0F, (i % 13) - 6.0F,
+                             (i % 7) - 3.0F, -1.0F - (i % 3), (i % 5) - 2.0F));
+  }
+
+  std::vector<CollisionHit> hits(rays.size());
+  const auto count = bvh.raycast(rays.data(), rays.size(), hits.data());
+  CHECK(count > 0);
+
+  for (unsigned int i = 0; i < rays.size(); i++) {
+    // Brute force: every triangle is its own bvh
+    float expected = -1.0F;
+    for (unsigned int t = 0; t < level.size() / 12; t++) {
+      CollisionBvh single;
+      single.addTriangles(&level[t * 12], 3);
+      single.build();
+
+      CollisionHit hit;
+      if (single.raycast(rays[i], &hit) &&
+          (expected < 0.0F || hit.distance < expected)) {
+        expected = hit.distance;
+      }
+    }
+
+    CHECK(hits[i].distance == doctest::Approx(expected));
+    CHECK(bvh.isOccluded(rays[i]) == (expected >= 0.0F));
+  }
+}
+
+TEST_CASE("Collision BVH applies matrix and hits wall") {
+  auto level = createLevel(4);
+  float matrix[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 2, 0, 1};
+
+  CollisionBvh bvh;
+  bvh.addTriangles(level.data(), level.size() / 4, matrix);
+  bvh.build();
+
+  CollisionHit hit;
+  REQUIRE(bvh.raycast(createRay(0.5F, 5.0F, 0.5F, 0.0F, -1.0F, 0.0F), &hit));
+  CHECK(hit.distance == doctest::Approx(3.0F));
+  CHECK(fabsf(hit.normal[1]) == doctest::Approx(1.0F));
+
+  REQUIRE(bvh.raycast(createRay(0.0F, 5.0F, 0.0F, 1.0F, 0.0F, 0.0F), &hit));
+  CHECK(hit.distance == doctest::Approx(4.0F));
+  CHECK(hit.point[0] == doctest::Approx(4.0F));
+}
+
+TEST_CASE("Collision BVH sphere sweep stops at contact and slides") {
+  auto level = createLevel(8);
+  CollisionBvh bvh;
+  bvh.addTriangles(level.data(), level.size() / 4);
+  bvh.build();
+
+  const float down[3] = {0.0F, -1.0F, 0.0F};
+  const float right[3] = {1.0F, 0.0F, 0.0F};
+  CollisionHit hit;
+
+  const float above[3] = {0.3F, 3.0F, 0.7F};
+  REQUIRE(bvh.sweepSphere(above, 0.5F, down, 10.0F, &hit));
+  CHECK(hit.distance == doctest::Approx(2.5F).epsilon(0.001));
+  CHECK(hit.normal[1] == doctest::Approx(1.0F));
+  CHECK(hit.point[1] == doctest::Approx(0.0F));
+
+  CHECK_FALSE(bvh.sweepSphere(above, 0.5F, down, 2.0F, &hit));
+  CHECK(hit.distance == -1.0F);
+
+  // Resting on floor and moving along it is not blocked by floor
+  const float resting[3] = {0.0F, 0.5F, 0.0F};
+  REQUIRE(bvh.sweepSphere(resting, 0.5F, right, 20.0F, &hit));
+  CHECK(hit.distance == doctest::Approx(7.5F).epsilon(0.001));
+  CHECK(hit.normal[0] == doctest::Approx(-1.0F));
+}
+
+TEST_CASE("Collision BVH capsule sweep hits edge with its side") {
+  auto level = createLevel(8);
+  CollisionBvh bvh;
+  bvh.addTriangles(level.data(), level.size() / 4);
+  bvh.build();
+
+  // Lying capsule falls onto floor
+  const float a[3] = {-2.0F, 4.0F, 1.0F};
+  const float b[3] = {2.0F, 4.0F, 1.0F};
+  const float down[3] = {0.0F, -1.0F, 0.0F};
+  CollisionHit hit;
+  REQUIRE(bvh.sweepCapsule(a, b, 0.25F, down, 10.0F, &hit));
+  CHECK(hit.distance == doctest::Approx(3.75F).epsilon(0.001));
+
+  // Standing capsule walks diagonally into wall
+  const float bottom[3] = {0.0F, 0.5F, 0.0F};
+  const float top[3] = {0.0F, 1.5F, 0.0F};
+  const float diagonal[3] = {0.70710678F, 0.0F, 0.70710678F};
+  REQUIRE(bvh.sweepCapsule(bottom, top, 0.5F, diagonal, 20.0F, &hit));
+  CHECK(hit.distance == doctest::Approx(7.5F * 1.41421356F).epsilon(0.001));
+  CHECK(hit.point[0] == doctest::Approx(8.0F));
+}
+
+TEST_CASE("Collision BVH closest point") {
+  auto level = createLevel(8);
+  CollisionBvh bvh;
+  bvh.addTriangles(level.data(), level.size() / 4);
+  bvh.build();
+
+  CollisionHit hit;
+  const float nearWall[3] = {7.0F, 5.0F, 2.0F};
+  REQUIRE(bvh.closestPoint(nearWall, 100.0F, &hit));
+  CHECK(hit.distance == doctest::Approx(1.0F));
+  CHECK(hit.point[0] == doctest::Approx(8.0F));
+  CHECK(hit.normal[0] == doctest::Approx(-1.0F));
+
+  const float far[3] = {0.0F, 50.0F, 0.0F};
+  CHECK_FALSE(bvh.closestPoint(far, 10.0F, &hit));
+
+  // Point below floor edge, closest is edge of floor
+  const float outside[3] = {-9.0F, -1.0F, 0.0F};
+  REQUIRE(bvh.closestPoint(outside, 10.0F, &hit));
+  CHECK(hit.distance == doctest::Approx(sqrtf(2.0F)));
+}
@@ -0,0 +1,78 @@
+#include "doctest.hpp"
+#include "renderer/dynamic_resolution.hpp"
+
+using namespace Tyra;
+
+TEST_CASE("Dynamic resolution lowers scale under load") {
+  DynamicResolution resolution;
+  resolution.init(16000, 0.5F);
+  CHECK(resolution.getScale() == 1.0F);
+
+  // GS needs 30% more time than budget
+  float last = 1.0F;
+  for (int i = 0; i < 30; i++) {
+    const auto scale = resolution.update(20800);
+    CHECK(scale <= last);
+    CHECK(last - scale <= 0.1F + 0.0001F);
+    last = scale;
+  }
+
+  // Busy time doesn't follow scale here, so it ends at minimum
+  CHECK(resolution.getScale() == doctest::Approx(0.5F));
+}
+
+TEST_CASE("Dynamic resolution settles when cost follows pixels") {
+  DynamicResolution resolution;
+  resolution.init(16000, 0.25F);
+
+  // Fill bound scene: 24ms at full resolution
+  const float fullCost = 24000.0F;
+  for (int i = 0; i < 60; i++) {
+    const auto scale = resolution.getScale();
+    resolution.update(static_cast<unsigned int>(fullCost * scale * scale));
+  }
+
+  const auto scale = resolution.getScale();
+  CHECK(fullCost * scale * scale <= 16000.0F);
+  CHECK(scale >= 0.7F);
+
+  // Quantized
+  const auto steps = scale / DynamicResolution::scaleStep;
+  CHECK(steps == doctest::Approx(static_cast<float>(static_cast<int>(
+                     steps + 0.5F))));
+
+  // Stable, no oscillation between neighbour sizes
+  for (int i = 0; i < 20; i++) {
+    const auto current = resolution.getScale();
+    resolution.update(static_cast<unsigned int>(fullCost * current * current));
+    CHECK(resolution.getScale() == scale);
+  }
+}
+
+TEST_CASE("Dynamic resolution recovers with headroom only") {
+  DynamicResolution resolution;
+  resolution.init(16000, 0.5F);
+  for (int i = 0; i < 10; i++) resolution.update(32000);
+  const auto low = resolution.getScale();
+  CHECK(low < 1.0F);
+
+  // Slightly under budget -> keep
+  for (int i = 0; i < 20; i++) resolution.update(15000);
+  CHECK(resolution.getScale() == low);
+
+  // Light scene -> back to full resolution
+  for (int i = 0; i < 40; i++) resolution.update(5000);
+  CHECK(resolution.getScale() == 1.0F);
+}
+
+TEST_CASE("Dynamic resolution scales sizes with alignment") {
+  DynamicResolution resolution;
+  resolution.init(16000, 0.5F);
+  CHECK(resolution.getScaledSize(512, 16) == 512);
+  CHECK(resolution.getScaledSize(456, 16) == 456);
+
+  for (int i = 0; i < 30; i++) resolution.update(64000);
+  CHECK(resolution.getScaledSize(512, 16) == 256);
+  CHECK(resolution.getScaledSize(448, 16) == 224);
+  CHECK(resolution.getScaledSize(448, 64) == 256);
+}
@@ -0,0 +1,84 @@
+#include "doctest.hpp"
+#include "math/vu0_kernels.hpp"
+#include "math/vu0_kernels_defines.h"
+
+using namespace Tyra;
+
+static void setTranslation(float* matrix, const float& x, const float& y,
+                           const float& z) {
+  for (int i = 0; i < 16; i++) matrix[i] = (i % 5 == 0) ? 1.0F : 0.0F;
+  matrix[12] = x;
+  matrix[13] = y;
+  matrix[14] = z;
+}
+
+TEST_CASE("VU0 kernels memory layouts fit in VU0 memory") {
+  CHECK(VU0_TRANSFORM_DATA_ADDR + VU0_TRANSFORM_MAX_COUNT * 2 <=
+        VU0_MEMORY_SIZE);
+  CHECK(VU0_CULL_DATA_ADDR + VU0_CULL_MAX_COUNT * 3 <= VU0_MEMORY_SIZE);
+  CHECK(VU0_MORPH_DATA_ADDR + VU0_MORPH_MAX_COUNT * 3 <= VU0_MEMORY_SIZE);
+  CHECK(VU0_SKIN_BONES_ADDR + VU0_SKIN_MAX_BONES * 4 <= VU0_SKIN_HEADER_ADDR);
+  CHECK(VU0_SKIN_DATA_ADDR + VU0_SKIN_MAX_COUNT * 4 <= VU0_MEMORY_SIZE);
+}
+
+TEST_CASE("VU0 transform kernel applies column major matrix") {
+  float matrix[16];
+  setTranslation(matrix, 1.0F, 2.0F, 3.0F);
+  matrix[0] = 2.0F;  // scale x
+
+  float in[8] = {1.0F, 1.0F, 1.0F, 1.0F, 0.0F, 0.0F, 0.0F, 0.0F};
+  float out[8];
+  Vu0Kernels::transform(matrix, in, out, 2);
+
+  CHECK(out[0] == 3.0F);
+  CHECK(out[1] == 3.0F);
+  CHECK(out[2] == 4.0F);
+  CHECK(out[3] == 1.0F);
+  CHECK(out[4] == 0.0F);  // w = 0 -> direction, no translation
+  CHECK(out[7] == 0.0F);
+}
+
+TEST_CASE("VU0 cull kernel returns common clip flags of box corners") {
+  float identity[16];
+  setTranslation(identity, 0.0F, 0.0F, 0.0F);
+
+  float boxes[24] = {
+      -0.5F, -0.5F, -0.5F, 1.0F, 0.5F, 0.5F, 0.5F, 1.0F,  // inside
+      2.0F,  -0.5F, -0.5F, 1.0F, 3.0F, 0.5F, 0.5F, 1.0F,  // +x
+      -5.0F, -5.0F, -5.0F, 1.0F, 5.0F, 5.0F, 5.0F, 1.0F,  // crossing
+  };
+  unsigned int flags[3];
+  Vu0Kernels::cullBoxes(identity, boxes, flags, 3);
+
+  CHECK(flags[0] == 0);
+  CHECK(flags[1] == 1);
+  CHECK(flags[2] == 0);
+
+  float below[4] = {0.0F, -2.0F, 0.0F, 1.0F};
+  CHECK(Vu0Kernels::getClipFlags(below) == 8);
+}
+
+TEST_CASE("VU0 morph and skin kernels") {
+  float from[4] = {0.0F, 0.0F, 0.0F, 1.0F};
+  float to[4] = {4.0F, 8.0F, -4.0F, 1.0F};
+  float morphed[4];
+  Vu0Kernels::morph(from, to, 0.25F, morphed, 1);
+  CHECK(morphed[0] == 1.0F);
+  CHECK(morphed[1] == 2.0F);
+  CHECK(morphed[2] == -1.0F);
+  CHECK(morphed[3] == 1.0F);
+
+  float bones[32];
+  setTranslation(&bones[0], 0.0F, 0.0F, 0.0F);
+  setTranslation(&bones[16], 10.0F, 0.0F, 0.0F);
+
+  float position[4] = {1.0F, 2.0F, 3.0F, 1.0F};
+  float weights[4] = {0.5F, 0.5F, 0.0F, 0.0F};
+  int indices[4] = {0, 1, 0, 0};
+  float skinned[4];
+  Vu0Kernels::skin(bones, position, weights, indices, skinned, 1);
+  CHECK(skinned[0] == 6.0F);
+  CHECK(skinned[1] == 2.0F);
+  CHECK(skinned[2] == 3.0F);
+  CHECK(skinned[3] == 1.0F);
+}
@@ -0,0 +1,161 @@
+#include "doctest.hpp"
+#include "memory/scratchpad_arena.hpp"
+#include "memory/scratchpad_double_buffer.hpp"
+#include "memory/memory_tracker.hpp"
+
+using namespace Tyra;
+
+/** Host emulation of 16KB EE scratchpad */
+static unsigned char scratchpad[16 * 1024] __attribute__((aligned(64)));
+
+TEST_CASE("Scratchpad arena allocates aligned blocks") {
+  ScratchpadArena arena;
+  arena.init(scratchpad, sizeof(scratchpad));
+
+  auto* a = static_cast<unsigned char*>(arena.allocate(20));
+  auto* b = static_cast<unsigned char*>(arena.allocate(16));
+  REQUIRE(a == scratchpad);
+  CHECK(b == scratchpad + 32);
+  CHECK(arena.getUsed() == 48);
+
+  auto* c = static_cast<unsigned char*>(arena.allocate(8, 64));
+  CHECK(c == scratchpad + 64);
+  CHECK(arena.contains(c));
+  CHECK_FALSE(arena.contains(scratchpad + sizeof(scratchpad)));
+
+  CHECK(arena.allocate(sizeof(scratchpad)) == nullptr);
+  CHECK(arena.allocate(0xFFFFFFF0) == nullptr);
+  CHECK(arena.getUsed() == 72);
+}
+
+TEST_CASE("Scratchpad arena releases to marker") {
+  ScratchpadArena arena;
+  arena.init(scratchpad, sizeof(scratchpad));
+
+  arena.allocate(100);
+  const auto marker = arena.getMarker();
+  arena.allocate(1000);
+  arena.allocate(2000);
+  CHECK(arena.getPeak() == 3120);
+
+  arena.release(marker);
+  CHECK(arena.getUsed() == marker);
+  CHECK(arena.getPeak() == 3120);
+
+  // Whole scratchpad can be used again
+  arena.reset();
+  CHECK(arena.allocate(sizeof(scratchpad)) == scratchpad);
+  CHECK(arena.getFree() == 0);
+}
+
+TEST_CASE("Scratchpad double buffer swaps halves") {
+  ScratchpadArena arena;
+  arena.init(scratchpad, sizeof(scratchpad));
+  arena.allocate(16);
+
+  ScratchpadDoubleBuffer buffer;
+  REQUIRE(buffer.init(&arena, 1024));
+  CHECK(buffer.getCurrent() == scratchpad + 16);
+  CHECK(buffer.swap() == scratchpad + 16 + 1024);
+  CHECK(buffer.getIndex() == 1);
+  CHECK(buffer.swap() == scratchpad + 16);
+
+  ScratchpadDoubleBuffer tooBig;
+  const auto used = arena.getUsed();
+  CHECK_FALSE(tooBig.init(&arena, 8 * 1024));
+  CHECK_FALSE(tooBig.isInitialized());
+  CHECK(arena.getUsed() == used);
+}
+
+TEST_CASE("Memory tracker counts live and peak bytes per category") {
+  MemoryTracker tracker;
+
+  auto* texture = tracker.allocate(1000, MEMORY_CATEGORY_TEXTURES, 128);
+  auto* mesh = tracker.allocate(300, MEMORY_CATEGORY_MESHES);
+  auto* mesh2 = tracker.allocate(200, MEMORY_CATEGORY_MESHES);
+  REQUIRE(texture != nullptr);
+  REQUIRE(mesh != nullptr);
+  CHECK(reinterpret_cast<unsigned long>(texture) % 128 == 0);
+  CHECK(reinterpret_cast<unsigned long>(mesh) % 16 == 0);
+
+  CHECK(MemoryTracker::getSize(texture) == 1000);
+  CHECK(MemoryTracker::getCategory(mesh) == MEMORY_CATEGORY_MESHES);
+  CHECK(tracker.getLiveBytes() == 1500);
+  CHECK(tracker.getLiveCount() == 3);
+  CHECK(tracker.getStats(MEMORY_CATEGORY_MESHES).liveBytes == 500);
+  CHECK(tracker.getOverheadBytes() == 128 + 16 + 16);
+
+  CHECK(tracker.free(mesh));
+  CHECK(tracker.getStats(MEMORY_CATEGORY_MESHES).liveBytes == 200);
+  CHECK(tracker.getStats(MEMORY_CATEGORY_MESHES).peakBytes == 500);
+  CHECK(tracker.getStats(MEMORY_CATEGORY_MESHES).totalCount == 2);
+  CHECK(tracker.getPeakBytes() == 1500);
+
+  CHECK(tracker.free(texture));
+  CHECK(tracker.free(mesh2));
+  CHECK(tracker.free(nullptr));
+  CHECK(tracker.getLiveBytes() == 0);
+  CHECK(tracker.getLiveCount() == 0);
+  CHECK(tracker.getOverheadBytes() == 0);
+  CHECK(tracker.getOverheadRatio() == 0.0F);
+}
+
+TEST_CASE("Memory tracker counts allocations per frame") {
+  MemoryTracker tracker;
+
+  for (int i = 0; i < 5; i++) {
+    tracker.free(tracker.allocate(64, MEMORY_CATEGORY_GAME));
+  }
+  tracker.track(4096, MEMORY_CATEGORY_PACKETS);
+
+  CHECK(tracker.getStats(MEMORY_CATEGORY_GAME).frameCount == 5);
+  CHECK(tracker.getStats(MEMORY_CATEGORY_GAME).frameBytes == 320);
+  CHECK(tracker.getStats(MEMORY_CATEGORY_PACKETS).liveBytes == 4096);
+
+  tracker.endFrame();
+  CHECK(tracker.getLastFrameCount() == 6);
+  CHECK(tracker.getStats(MEMORY_CATEGORY_GAME).frameCount == 0);
+
+  tracker.untrack(4096, MEMORY_CATEGORY_PACKETS);
+  CHECK(tracker.getLiveBytes() == 0);
+}
+
+static unsigned int budgetCalls = 0;
+static MemoryCategory budgetCategory = MEMORY_CATEGORY_GAME;
+
+static void onBudgetExceeded(const MemoryCategory& t_category,
+                             const MemoryCategoryStats&) {
+  budgetCalls++;
+  budgetCategory = t_category;
+}
+
+TEST_CASE("Memory tracker reports exceeded budget") {
+  MemoryTracker tracker;
+  tracker.onBudgetExceeded = onBudgetExceeded;
+  tracker.setBudget(MEMORY_CATEGORY_AUDIO, 1024);
+  budgetCalls = 0;
+
+  auto* a = tracker.allocate(1000, MEMORY_CATEGORY_AUDIO);
+  auto* b = tracker.allocate(2000, MEMORY_CATEGORY_GAME);
+  CHECK(budgetCalls == 0);
+  CHECK_FALSE(tracker.isOverBudget(MEMORY_CATEGORY_AUDIO));
+
+  auto* c = tracker.allocate(100, MEMORY_CATEGORY_AUDIO);
+  CHECK(budgetCalls == 1);
+  CHECK(budgetCategory == MEMORY_CATEGORY_AUDIO);
+  CHECK(tracker.isOverBudget(MEMORY_CATEGORY_AUDIO));
+
+  tracker.free(c);
+  CHECK_FALSE(tracker.isOverBudget(MEMORY_CATEGORY_AUDIO));
+
+  tracker.free(a);
+  tracker.free(b);
+}
+
+TEST_CASE("Memory tracker rejects foreign blocks") {
+  MemoryTracker tracker;
+
+  alignas(16) unsigned char block[64] = {};
+  CHECK_FALSE(tracker.free(block + 16));
+  CHECK(tracker.getLiveCount() == 0);
+}
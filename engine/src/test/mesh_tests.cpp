@@ -0,0 +1,278 @@
+#include "doctest.hpp"
+#include "mesh/binary_mesh_file.hpp"
+#include "mesh/mesh_optimizer.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Tyra;
+
+static BinaryMeshSourceFrame makeFrame(const unsigned int& count,
+                                       const float& offset) {
+  BinaryMeshSourceFrame frame;
+  frame.count = count;
+  for (unsigned int i = 0; i < count; i++) {
+    const float vertex[4] = {offset + i, -1.0F * i, 2.0F, 1.0F};
+    const float st[4] = {0.5F, 0.25F, 1.0F, 0.0F};
+    frame.arrays[BINARY_MESH_VERTICES].insert(
+        frame.arrays[BINARY_MESH_VERTICES].end(), vertex, vertex + 4);
+    frame.arrays[BINARY_MESH_TEXTURE_COORDS].insert(
+        frame.arrays[BINARY_MESH_TEXTURE_COORDS].end(), st, st + 4);
+  }
+  return frame;
+}
+
+static BinaryMeshSource makeSource() {
+  BinaryMeshSource source;
+  source.loadNormals = false;
+  source.loadLightmap = false;
+
+  BinaryMeshSourceMaterial body;
+  body.name = "body";
+  body.texturePath = "zombie.png";
+  body.ambient[0] = body.ambient[1] = body.ambient[2] = body.ambient[3] = 128;
+  body.frames.push_back(makeFrame(6, 0.0F));
+  body.frames.push_back(makeFrame(6, 10.0F));
+
+  BinaryMeshSourceMaterial eyes;
+  eyes.name = "eyes";
+  eyes.ambient[0] = 255.0F;
+  eyes.ambient[1] = eyes.ambient[2] = 0.0F;
+  eyes.ambient[3] = 128.0F;
+  eyes.frames.push_back(makeFrame(3, 0.0F));
+  eyes.frames.push_back(makeFrame(3, 0.0F));
+  eyes.frames[0].arrays[BINARY_MESH_TEXTURE_COORDS].clear();
+  eyes.frames[1].arrays[BINARY_MESH_TEXTURE_COORDS].clear();
+
+  source.materials.push_back(body);
+  source.materials.push_back(eyes);
+  return source;
+}
+
+TEST_CASE("Binary mesh roundtrip") {
+  auto source = makeSource();
+  auto data = BinaryMeshFile::build(source);
+  REQUIRE(BinaryMeshFile::validate(data.data(), data.size()));
+
+  const auto* header = BinaryMeshFile::getHeader(data.data());
+  CHECK(header->materialsCount == 2);
+  CHECK(header->framesCount == 2);
+  CHECK(header->flags == 0);
+
+  const auto* body = BinaryMeshFile::getMaterial(data.data(), 0);
+  CHECK(std::string(BinaryMeshFile::getString(data.data(), body->nameOffset)) ==
+        "body");
+  CHECK(std::string(BinaryMeshFile::getString(
+            data.data(), body->texturePathOffset)) == "zombie.png");
+
+  const auto* eyes = BinaryMeshFile::getMaterial(data.data(), 1);
+  CHECK(BinaryMeshFile::getString(data.data(), eyes->texturePathOffset) ==
+        nullptr);
+  CHECK(eyes->ambient[0] == 255.0F);
+
+  const auto* frame = BinaryMeshFile::getFrame(data.data(), 0, 1);
+  CHECK(frame->count == 6);
+  const auto* vertices =
+      BinaryMeshFile::getArray(data.data(), frame, BINARY_MESH_VERTICES);
+  REQUIRE(vertices != nullptr);
+  CHECK(reinterpret_cast<size_t>(vertices) % 16 ==
+        reinterpret_cast<size_t>(data.data()) % 16);
+  CHECK(memcmp(vertices,
+               source.materials[0].frames[1].arrays[BINARY_MESH_VERTICES].data(),
+               6 * 4 * sizeof(float)) == 0);
+
+  CHECK(frame->min[0] == 10.0F);
+  CHECK(frame->max[0] == 15.0F);
+  CHECK(frame->min[1] == -5.0F);
+  CHECK(frame->max[1] == 0.0F);
+
+  const auto* eyesFrame = BinaryMeshFile::getFrame(data.data(), 1, 0);
+  CHECK(BinaryMeshFile::getArray(data.data(), eyesFrame,
+                                 BINARY_MESH_TEXTURE_COORDS) == nullptr);
+  CHECK(BinaryMeshFile::getArray(data.data(), eyesFrame,
+                                 BINARY_MESH_NORMALS) == nullptr);
+}
+
+TEST_CASE("Binary mesh rejects invalid data") {
+  auto source = makeSource();
+  source.materials[1].frames.pop_back();
+  CHECK(BinaryMeshFile::build(source).empty());
+
+  source = makeSource();
+  source.materials[0].frames[0].arrays[BINARY_MESH_NORMALS].push_back(1.0F);
+  CHECK(BinaryMeshFile::build(source).empty());
+
+  auto data = BinaryMeshFile::build(makeSource());
+  CHECK_FALSE(BinaryMeshFile::validate(data.data(), data.size() - 16));
+
+  auto broken = data;
+  auto* frame = const_cast<BinaryMeshFrame*>(
+      BinaryMeshFile::getFrame(broken.data(), 0, 0));
+  frame->offsets[BINARY_MESH_VERTICES] += 4;
+  CHECK_FALSE(BinaryMeshFile::validate(broken.data(), broken.size()));
+
+  // Materials table size wraps in 32 bits
+  broken = data;
+  auto* header = const_cast<BinaryMeshHeader*>(
+      BinaryMeshFile::getHeader(broken.data()));
+  header->materialsCount = 0x80000000U / sizeof(BinaryMeshMaterial) * 2;
+  header->framesCount = 0;
+  CHECK_FALSE(BinaryMeshFile::validate(broken.data(), broken.size()));
+}
+
+static void addTriangle(BinaryMeshSourceFrame& frame, const float* a,
+                        const float* b, const float* c) {
+  const float* vertices[3] = {a, b, c};
+  for (auto* vertex : vertices) {
+    const float xyzw[4] = {vertex[0], vertex[1], vertex[2], 1.0F};
+    const float st[4] = {vertex[0], vertex[2], 1.0F, 0.0F};
+    auto& out = frame.arrays[BINARY_MESH_VERTICES];
+    out.insert(out.end(), xyzw, xyzw + 4);
+    auto& coords = frame.arrays[BINARY_MESH_TEXTURE_COORDS];
+    coords.insert(coords.end(), st, st + 4);
+    frame.count++;
+  }
+}
+
+/** Grid of quads on XZ plane, in random triangle order. */
+static BinaryMeshSourceMaterial makeShuffledGrid(const unsigned int& size,
+                                                 const std::string& name) {
+  BinaryMeshSourceMaterial material;
+  material.name = name;
+  material.texturePath = "floor.png";
+  for (auto& value : material.ambient) value = 128.0F;
+
+  std::vector<std::pair<float, float>> cells;
+  for (unsigned int x = 0; x < size; x++)
+    for (unsigned int z = 0; z < size; z++) cells.push_back({x, z});
+
+  srand(3);
+  for (unsigned int i = cells.size() - 1; i > 0; i--)
+    std::swap(cells[i], cells[rand() % (i + 1)]);
+
+  BinaryMeshSourceFrame frame;
+  frame.count = 0;
+  for (const auto& cell : cells) {
+    const float a[3] = {cell.first, 0.0F, cell.second};
+    const float b[3] = {cell.first + 1, 0.0F, cell.second};
+    const float c[3] = {cell.first + 1, 0.0F, cell.second + 1};
+    const float d[3] = {cell.first, 0.0F, cell.second + 1};
+    addTriangle(frame, a, b, c);
+    addTriangle(frame, a, c, d);
+  }
+  material.frames.push_back(frame);
+  return material;
+}
+
+TEST_CASE("Mesh optimizer detects degenerates") {
+  const float a[3] = {0.0F, 0.0F, 0.0F};
+  const float b[3] = {1.0F, 0.0F, 0.0F};
+  const float c[3] = {0.0F, 1.0F, 0.0F};
+  const float onLine[3] = {2.0F, 0.0F, 0.0F};
+
+  CHECK_FALSE(MeshOptimizer::isDegenerate(a, b, c));
+  CHECK(MeshOptimizer::isDegenerate(a, b, onLine));
+  CHECK(MeshOptimizer::isDegenerate(a, a, c));
+
+  // Tiny, but valid triangle
+  const float tinyB[3] = {0.001F, 0.0F, 0.0F};
+  const float tinyC[3] = {0.0F, 0.001F, 0.0F};
+  CHECK_FALSE(MeshOptimizer::isDegenerate(a, tinyB, tinyC));
+}
+
+TEST_CASE("Mesh optimizer morton codes keep locality") {
+  CHECK(MeshOptimizer::getMortonCode(0.0F, 0.0F, 0.0F) == 0);
+  CHECK(MeshOptimizer::getMortonCode(1.0F, 1.0F, 1.0F) == 0x3FFFFFFF);
+  CHECK(MeshOptimizer::getMortonCode(0.1F, 0.1F, 0.1F) <
+        MeshOptimizer::getMortonCode(0.9F, 0.9F, 0.9F));
+}
+
+TEST_CASE("Mesh optimizer removes, merges and sorts") {
+  BinaryMeshSource mesh;
+  mesh.loadNormals = false;
+  mesh.loadLightmap = false;
+  mesh.materials.push_back(makeShuffledGrid(16, "floor_a"));
+  mesh.materials.push_back(makeShuffledGrid(4, "floor_b"));
+
+  const float a[3] = {0.0F, 0.0F, 0.0F};
+  const float b[3] = {1.0F, 0.0F, 0.0F};
+  addTriangle(mesh.materials[0].frames[0], a, b, b);
+
+  MeshOptimizerOptions options;
+  options.packageSize = 48;
+  auto stats = MeshOptimizer::optimize(mesh, options);
+
+  CHECK(stats.trianglesBefore == 16 * 16 * 2 + 4 * 4 * 2 + 1);
+  CHECK(stats.degeneratesRemoved == 1);
+  CHECK(stats.materialsMerged == 1);
+  CHECK(stats.trianglesAfter == stats.trianglesBefore - 1);
+
+  REQUIRE(mesh.materials.size() == 1);
+  const auto& frame = mesh.materials[0].frames[0];
+  CHECK(frame.count == stats.trianglesAfter * 3);
+  CHECK(frame.arrays[BINARY_MESH_TEXTURE_COORDS].size() == frame.count * 4);
+
+  // Shuffled packages span whole grid, sorted ones are small
+  CHECK(stats.packageSpreadBefore > 0.8F);
+  CHECK(stats.packageSpreadAfter < 0.4F);
+
+  // Attributes travel with their vertices
+  const auto& vertices = frame.arrays[BINARY_MESH_VERTICES];
+  const auto& coords = frame.arrays[BINARY_MESH_TEXTURE_COORDS];
+  for (unsigned int i = 0; i < frame.count; i++) {
+    CHECK(coords[i * 4] == vertices[i * 4]);
+    CHECK(coords[i * 4 + 1] == vertices[i * 4 + 2]);
+  }
+
+  CHECK_FALSE(BinaryMeshFile::build(mesh).empty());
+}
+
+TEST_CASE("Mesh optimizer keeps animated triangles") {
+  BinaryMeshSource mesh;
+  mesh.loadNormals = false;
+  mesh.loadLightmap = false;
+
+  BinaryMeshSourceMaterial material;
+  material.name = "body";
+  for (auto& value : material.ambient) value = 128.0F;
+
+  const float a[3] = {0.0F, 0.0F, 0.0F};
+  const float b[3] = {1.0F, 0.0F, 0.0F};
+  const float c[3] = {0.0F, 1.0F, 0.0F};
+
+  // Collapsed only in first frame
+  BinaryMeshSourceFrame first, second;
+  first.count = second.count = 0;
+  addTriangle(first, a, b, b);
+  addTriangle(second, a, b, c);
+  addTriangle(first, a, b, c);
+  addTriangle(second, a, b, c);
+  material.frames.push_back(first);
+  material.frames.push_back(second);
+  mesh.materials.push_back(material);
+
+  auto stats = MeshOptimizer::optimize(mesh, MeshOptimizerOptions());
+  CHECK(stats.degeneratesRemoved == 0);
+  CHECK(mesh.materials[0].frames[0].count == 6);
+  CHECK(mesh.materials[0].frames[1].count == 6);
+}
+
+TEST_CASE("Binary mesh reads back into source") {
+  auto source = makeSource();
+  auto data = BinaryMeshFile::build(source);
+
+  BinaryMeshSource result;
+  REQUIRE(BinaryMeshFile::read(data.data(), data.size(), &result));
+  REQUIRE(result.materials.size() == 2);
+  CHECK(result.materials[0].texturePath.value() == "zombie.png");
+  CHECK_FALSE(result.materials[1].texturePath.has_value());
+  CHECK(result.materials[1].ambient[0] == 255.0F);
+  CHECK(result.materials[0].frames[1].arrays[BINARY_MESH_VERTICES] ==
+        source.materials[0].frames[1].arrays[BINARY_MESH_VERTICES]);
+  CHECK(result.materials[1].frames[0].arrays[BINARY_MESH_TEXTURE_COORDS]
+            .empty());
+
+  CHECK_FALSE(BinaryMeshFile::read(data.data(), data.size() - 16, &result));
+}
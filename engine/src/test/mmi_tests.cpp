@@ -0,0 +1,143 @@
+#include "doctest.hpp"
+#include "utils/mmi_kernels.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Tyra;
+
+static void fillRandom(unsigned char* data, const unsigned int& size) {
+  srand(1234);
+  for (unsigned int i = 0; i < size; i++) data[i] = rand() & 0xFF;
+}
+
+/** Sizes and unaligned offsets, to hit heads, bodies and tails */
+static const unsigned int sizes[] = {0, 1, 3, 4, 7, 8, 15, 16, 17, 64, 257};
+static const unsigned int offsets[] = {0, 4, 8, 12};
+
+TEST_CASE("MMI halveAlpha equals loader formula") {
+  alignas(16) unsigned char fast[1100];
+  alignas(16) unsigned char scalar[1100];
+
+  for (auto size : sizes) {
+    for (auto offset : offsets) {
+      fillRandom(fast, sizeof(fast));
+      memcpy(scalar, fast, sizeof(fast));
+
+      MmiKernels::halveAlpha(fast + offset, size);
+      for (unsigned int i = 0; i < size; i++) {
+        auto* pixel = &scalar[offset + i * 4];
+        pixel[3] = ((int)pixel[3] * 128 / 255);
+      }
+
+      REQUIRE(memcmp(fast, scalar, sizeof(fast)) == 0);
+    }
+  }
+
+  unsigned char pixel[4] = {1, 2, 3, 255};
+  MmiKernels::halveAlpha(pixel, 1);
+  CHECK(pixel[3] == 128);
+}
+
+TEST_CASE("MMI rgbxToRgb equals scalar version") {
+  alignas(16) unsigned char input[1100];
+  alignas(16) unsigned char fast[1100];
+  alignas(16) unsigned char scalar[1100];
+  fillRandom(input, sizeof(input));
+
+  for (auto size : sizes) {
+    for (auto offset : offsets) {
+      memset(fast, 0, sizeof(fast));
+      memset(scalar, 0, sizeof(scalar));
+
+      MmiKernels::rgbxToRgb(fast + offset, input + offset, size);
+      MmiKernels::rgbxToRgbScalar(scalar + offset, input + offset, size);
+
+      REQUIRE(memcmp(fast, scalar, sizeof(fast)) == 0);
+    }
+  }
+
+  unsigned char rgbx[32];
+  for (unsigned int i = 0; i < 32; i++) rgbx[i] = i;
+  unsigned char rgb[24];
+  MmiKernels::rgbxToRgbScalar(rgb, rgbx, 8);
+  CHECK(rgb[3] == 4);
+  CHECK(rgb[23] == 30);
+}
+
+TEST_CASE("MMI nibble swap and CLUT swizzle") {
+  alignas(16) unsigned char fast[600];
+  alignas(16) unsigned char scalar[600];
+
+  for (auto size : sizes) {
+    for (unsigned int offset = 0; offset < 4; offset++) {
+      fillRandom(fast, sizeof(fast));
+      memcpy(scalar, fast, sizeof(fast));
+
+      MmiKernels::swapNibbles(fast + offset, size);
+      MmiKernels::swapNibblesScalar(scalar + offset, size);
+      REQUIRE(memcmp(fast, scalar, sizeof(fast)) == 0);
+    }
+  }
+
+  unsigned char byte = 0x12;
+  MmiKernels::swapNibbles(&byte, 1);
+  CHECK(byte == 0x21);
+
+  alignas(16) unsigned int clut[256];
+  alignas(16) unsigned int clutScalar[256];
+  for (unsigned int i = 0; i < 256; i++) clut[i] = clutScalar[i] = i;
+
+  MmiKernels::swizzleClutCsm1(clut, 256);
+  MmiKernels::swizzleClutCsm1Scalar(clutScalar, 256);
+  CHECK(memcmp(clut, clutScalar, sizeof(clut)) == 0);
+  CHECK(clut[7] == 7);
+  CHECK(clut[8] == 16);
+  CHECK(clut[16] == 8);
+  CHECK(clut[40] == 48);
+}
+
+TEST_CASE("MMI byte and halfword to float expansion") {
+  alignas(16) float scale[4] = {2.0F, 0.5F, 1.0F, 0.0F};
+  alignas(16) float offset[4] = {-1.0F, 0.0F, 3.0F, 1.0F};
+
+  unsigned char bytes[33];
+  fillRandom(bytes, sizeof(bytes));
+
+  alignas(16) float fast[32];
+  alignas(16) float scalar[32];
+
+  // Unaligned source, like MD2 frame vertices
+  MmiKernels::bytesToFloats(fast, bytes + 1, 8, scale, offset);
+  MmiKernels::bytesToFloatsScalar(scalar, bytes + 1, 8, scale, offset);
+  for (unsigned int i = 0; i < 32; i++) {
+    CHECK(fast[i] == doctest::Approx(scalar[i]));
+  }
+  CHECK(scalar[0] == bytes[1] * 2.0F - 1.0F);
+  CHECK(scalar[3] == 1.0F);
+
+  unsigned short halfwords[16];
+  for (unsigned int i = 0; i < 16; i++) halfwords[i] = i * 4000;
+
+  MmiKernels::halfwordsToFloats(fast, halfwords, 4, scale, offset);
+  MmiKernels::halfwordsToFloatsScalar(scalar, halfwords, 4, scale, offset);
+  for (unsigned int i = 0; i < 16; i++) {
+    CHECK(fast[i] == doctest::Approx(scalar[i]));
+  }
+  CHECK(scalar[13] == 26000.0F);
+}
+
+TEST_CASE("MMI qword copy and fill") {
+  alignas(16) unsigned char input[256];
+  alignas(16) unsigned char output[256];
+  fillRandom(input, sizeof(input));
+
+  MmiKernels::copy128(output, input, 16);
+  CHECK(memcmp(output, input, sizeof(input)) == 0);
+
+  alignas(16) unsigned int filled[12];
+  filled[11] = 7;
+  MmiKernels::fill128(filled, 0x80FF00AA, 2);
+  for (unsigned int i = 0; i < 8; i++) CHECK(filled[i] == 0x80FF00AA);
+  CHECK(filled[11] == 7);
+}
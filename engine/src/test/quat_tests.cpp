@@ -0,0 +1,135 @@
+#include "doctest.hpp"
+#include "math/quat_math.hpp"
+#include <cmath>
+
+using namespace Tyra;
+
+static const float halfPi = 1.5707963267948966F;
+
+static void checkVector(const float* a, const float* b,
+                        const unsigned int& count) {
+  for (unsigned int i = 0; i < count; i++) {
+    CHECK(a[i] == doctest::Approx(b[i]).epsilon(0.0001));
+  }
+}
+
+TEST_CASE("Quat multiply composes rotations") {
+  const float axisZ[3] = {0.0F, 0.0F, 1.0F};
+  float quarter[4], half[4], expected[4];
+  QuatMath::fromAxisAngle(quarter, axisZ, halfPi);
+  QuatMath::fromAxisAngle(expected, axisZ, halfPi * 2.0F);
+
+  QuatMath::multiply(half, quarter, quarter);
+  checkVector(half, expected, 4);
+
+  const float identity[4] = {0.0F, 0.0F, 0.0F, 1.0F};
+  float result[4];
+  QuatMath::multiply(result, quarter, identity);
+  checkVector(result, quarter, 4);
+
+  float inverse[4];
+  QuatMath::conjugate(inverse, quarter);
+  QuatMath::multiply(result, quarter, inverse);
+  checkVector(result, identity, 4);
+}
+
+TEST_CASE("Quat rotate matches rotation matrix") {
+  const float axis[3] = {1.0F, 2.0F, -0.5F};
+  float quat[4], matrix[16];
+  QuatMath::fromAxisAngle(quat, axis, 0.7F);
+  QuatMath::toMatrix(matrix, quat);
+
+  const float v[4] = {3.0F, -1.0F, 2.0F, 1.0F};
+  float rotated[4];
+  QuatMath::rotate(rotated, quat, v);
+
+  float expected[4];
+  for (int row = 0; row < 4; row++) {
+    expected[row] = 0.0F;
+    for (int col = 0; col < 4; col++)
+      expected[row] += matrix[col * 4 + row] * v[col];
+  }
+
+  checkVector(rotated, expected, 4);
+}
+
+TEST_CASE("Quat axis angle rotates X into Y around Z") {
+  const float axisZ[3] = {0.0F, 0.0F, 2.0F};
+  float quat[4];
+  QuatMath::fromAxisAngle(quat, axisZ, halfPi);
+
+  const float x[4] = {1.0F, 0.0F, 0.0F, 0.0F};
+  const float y[4] = {0.0F, 1.0F, 0.0F, 0.0F};
+  float result[4];
+  QuatMath::rotate(result, quat, x);
+  checkVector(result, y, 3);
+  CHECK(result[2] == doctest::Approx(0.0F));
+}
+
+TEST_CASE("Quat matrix conversion round trips") {
+  const float axes[4][3] = {{1.0F, 0.0F, 0.0F},
+                            {0.0F, 1.0F, 1.0F},
+                            {-1.0F, 0.3F, 0.2F},
+                            {0.0F, 0.0F, 1.0F}};
+  const float angles[4] = {0.3F, 3.0F, -2.5F, 3.14159F};
+
+  for (int i = 0; i < 4; i++) {
+    float quat[4], matrix[16], result[4];
+    QuatMath::fromAxisAngle(quat, axes[i], angles[i]);
+    QuatMath::toMatrix(matrix, quat);
+    QuatMath::fromMatrix(result, matrix);
+
+    // q and -q are the same rotation
+    if (QuatMath::dot(quat, result) < 0.0F)
+      for (int j = 0; j < 4; j++) result[j] = -result[j];
+
+    checkVector(result, quat, 4);
+  }
+}
+
+TEST_CASE("Quat slerp and nlerp interpolate on shortest path") {
+  const float axisY[3] = {0.0F, 1.0F, 0.0F};
+  float a[4], b[4], expected[4];
+  QuatMath::fromAxisAngle(a, axisY, 0.0F);
+  QuatMath::fromAxisAngle(b, axisY, halfPi);
+  QuatMath::fromAxisAngle(expected, axisY, halfPi * 0.25F);
+
+  float result[4];
+  QuatMath::slerp(result, a, b, 0.25F);
+  checkVector(result, expected, 4);
+
+  QuatMath::nlerp(result, a, b, 0.0F);
+  checkVector(result, a, 4);
+  QuatMath::nlerp(result, a, b, 1.0F);
+  checkVector(result, b, 4);
+  CHECK(QuatMath::dot(result, result) == doctest::Approx(1.0F));
+
+  // -b is same rotation, result must not take the long way
+  const float negB[4] = {-b[0], -b[1], -b[2], -b[3]};
+  QuatMath::slerp(result, a, negB, 0.25F);
+  checkVector(result, expected, 4);
+}
+
+TEST_CASE("Quat look rotation points -Z at forward") {
+  const float forward[3] = {1.0F, 0.0F, -1.0F};
+  const float up[3] = {0.0F, 1.0F, 0.0F};
+  float quat[4];
+  QuatMath::lookRotation(quat, forward, up);
+
+  const float minusZ[4] = {0.0F, 0.0F, -1.0F, 0.0F};
+  const float plusY[4] = {0.0F, 1.0F, 0.0F, 0.0F};
+  float result[4];
+
+  QuatMath::rotate(result, quat, minusZ);
+  const float expected[3] = {0.70710678F, 0.0F, -0.70710678F};
+  checkVector(result, expected, 3);
+
+  QuatMath::rotate(result, quat, plusY);
+  CHECK(result[1] == doctest::Approx(1.0F));
+
+  // Forward parallel to up still gives valid rotation
+  const float straightUp[3] = {0.0F, 5.0F, 0.0F};
+  QuatMath::lookRotation(quat, straightUp, up);
+  QuatMath::rotate(result, quat, minusZ);
+  CHECK(result[1] == doctest::Approx(1.0F));
+}
@@ -0,0 +1,140 @@
+#include "doctest.hpp"
+#include "terrain/heightfield.hpp"
+#include "terrain/terrain_geomipmap.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace Tyra;
+
+/** 33x33 samples, sample = x * 10 + z * 3 + small bumps */
+static std::vector<unsigned short> createSamples() {
+  std::vector<unsigned short> result;
+  for (int z = 0; z < 33; z++) {
+    for (int x = 0; x < 33; x++) {
+      result.push_back(x * 10 + z * 3 + ((x * 7 + z * 13) % 5) * 4);
+    }
+  }
+  return result;
+}
+
+TEST_CASE("Heightfield bilinear heights, normals and batch") {
+  const unsigned short samples[9] = {0, 100, 200, 0, 100, 200, 0, 100, 200};
+  Heightfield heightfield(samples, 3, 3, 2.0F, 0.5F, 10.0F);
+
+  CHECK(heightfield.getSizeX() == doctest::Approx(4.0F));
+  CHECK(heightfield.getSample(1, 1) == doctest::Approx(60.0F));
+  CHECK(heightfield.getSample(-5, 7) == doctest::Approx(10.0F));
+  CHECK(heightfield.getHeight(1.0F, 3.0F) == doctest::Approx(35.0F));
+  CHECK(heightfield.getHeight(100.0F, 1.0F) == doctest::Approx(110.0F));
+
+  // Slope of 25 height per unit along X
+  float normal[4];
+  heightfield.getNormal(2.0F, 2.0F, normal);
+  const float length = sqrtf(25.0F * 25.0F + 1.0F);
+  CHECK(normal[0] == doctest::Approx(-25.0F / length));
+  CHECK(normal[1] == doctest::Approx(1.0F / length));
+  CHECK(normal[2] == doctest::Approx(0.0F));
+
+  const float positions[8] = {0.5F, 0.0F, 0.5F, 1.0F, 3.0F, 0.0F, 1.0F, 1.0F};
+  float heights[2];
+  heightfield.getHeights(positions, 2, heights);
+  CHECK(heights[0] == heightfield.getHeight(0.5F, 0.5F));
+  CHECK(heights[1] == heightfield.getHeight(3.0F, 1.0F));
+
+  float min, max;
+  heightfield.getRange(1, 0, 2, 2, &min, &max);
+  CHECK(min == doctest::Approx(60.0F));
+  CHECK(max == doctest::Approx(110.0F));
+}
+
+TEST_CASE("Heightfield single row and single sample") {
+  const unsigned short samples[3] = {0, 100, 200};
+  Heightfield row(samples, 3, 1, 2.0F, 0.5F, 10.0F);
+  CHECK(row.getHeight(1.0F, 0.0F) == doctest::Approx(35.0F));
+  CHECK(row.getHeight(3.0F, 5.0F) == doctest::Approx(85.0F));
+
+  Heightfield column(samples, 1, 3, 2.0F, 0.5F, 10.0F);
+  CHECK(column.getHeight(7.0F, 1.0F) == doctest::Approx(35.0F));
+
+  Heightfield single(samples + 2, 1, 1, 2.0F, 0.5F, 10.0F);
+  CHECK(single.getHeight(1.0F, 1.0F) == doctest::Approx(110.0F));
+}
+
+TEST_CASE("Terrain geomipmap LOD selection by distance") {
+  auto samples = createSamples();
+  Heightfield heightfield(samples.data(), 33, 33, 1.0F, 0.1F, 0.0F);
+
+  CHECK(TerrainGeomipmap::getChunksCount(33, 8) == 4);
+  CHECK(TerrainGeomipmap::selectLod(5.0F, 10.0F, 3) == 0);
+  CHECK(TerrainGeomipmap::selectLod(15.0F, 10.0F, 3) == 1);
+  CHECK(TerrainGeomipmap::selectLod(500.0F, 10.0F, 3) == 2);
+
+  unsigned char lods[16];
+  TerrainGeomipmap::selectLods(heightfield, 8, 4.0F, 4.0F, 6.0F, 4, lods);
+  CHECK(lods[0] == 0);   // camera inside
+  CHECK(lods[1] == 0);   // 4 units away
+  CHECK(lods[2] == 2);   // 12 units away
+  CHECK(lods[15] == 3);  // far corner, clamped
+}
+
+TEST_CASE("Terrain geomipmap chunk seams have no cracks") {
+  auto samples = createSamples();
+  Heightfield heightfield(samples.data(), 33, 33, 1.0F, 0.1F, 0.0F);
+
+  // Fine chunk (0, 0) next to coarse chunk (1, 0) on its right
+  const unsigned int fineNeighbors[4] = {0, 2, 0, 0};
+  const unsigned int coarseNeighbors[4] = {0, 2, 2, 2};
+
+  std::vector<float> fine(TerrainGeomipmap::getVertexCount(8, 0) * 4);
+  std::vector<float> coarse(TerrainGeomipmap::getVertexCount(8, 2) * 4);
+  std::vector<float> uvs(fine.size());
+  CHECK(fine.size() / 4 == 8 * 8 * 6);
+  CHECK(coarse.size() / 4 == 2 * 2 * 6);
+
+  TerrainGeomipmap::buildChunk(heightfield, 0, 0, 8, 0, fineNeighbors,
+                               fine.data(), uvs.data(), 2.0F);
+  TerrainGeomipmap::buildChunk(heightfield, 1, 0, 8, 2, coarseNeighbors,
+                               coarse.data());
+
+  // Coarse chunk height on its left edge (x = 8), linear between samples
+  auto getCoarseEdgeHeight = [&](const float& z) {
+    const int z0 = static_cast<int>(z) / 4 * 4;
+    const float a = heightfield.getSample(8, z0);
+    const float b = heightfield.getSample(8, z0 + 4);
+    return a + (b - a) * (z - z0) / 4.0F;
+  };
+
+  unsigned int edgeVertices = 0;
+  for (unsigned int i = 0; i < fine.size() / 4; i++) {
+    const float* position = &fine[i * 4];
+    if (position[0] != 8.0F) {
+      // Inner vertices are untouched samples
+      const int x = static_cast<int>(position[0]);
+      const int z = static_cast<int>(position[2]);
+      if (x > 0 && z > 0 && z < 8) {
+        CHECK(position[1] == heightfield.getSample(x, z));
+      }
+      continue;
+    }
+
+    CHECK(position[1] == doctest::Approx(getCoarseEdgeHeight(position[2])));
+    edgeVertices++;
+  }
+  CHECK(edgeVertices > 0);
+
+  for (unsigned int i = 0; i < coarse.size() / 4; i++) {
+    const float* position = &coarse[i * 4];
+    CHECK(static_cast<int>(position[0]) % 4 == 0);
+    CHECK(static_cast<int>(position[2]) % 4 == 0);
+  }
+
+  // Triangles face up, uvs scaled over whole heightfield
+  float e1[3], e2[3];
+  for (int k = 0; k < 3; k++) {
+    e1[k] = fine[4 + k] - fine[k];
+    e2[k] = fine[8 + k] - fine[k];
+  }
+  CHECK(e1[2] * e2[0] - e1[0] * e2[2] > 0.0F);
+  CHECK(uvs[2 * 4 + 0] == doctest::Approx(2.0F / 32.0F));
+  CHECK(uvs[2 * 4 + 2] == 1.0F);
+}
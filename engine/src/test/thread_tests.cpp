@@ -0,0 +1,68 @@
+#include "doctest.hpp"
+#include "thread/threading_event.hpp"
+#include "thread/threading_semaphore.hpp"
+#include <atomic>
+#include <thread>
+
+using namespace Tyra;
+
+TEST_CASE("Threading semaphore counts up to max") {
+  ThreadingSemaphore sema;
+  sema.init(1, 2);
+  CHECK(sema.getCount() == 1);
+
+  sema.signal();
+  sema.signal();
+  CHECK(sema.getCount() == 2);
+
+  CHECK(sema.tryWait());
+  sema.wait();
+  CHECK_FALSE(sema.tryWait());
+  CHECK(sema.getCount() == 0);
+}
+
+TEST_CASE("Threading semaphore wakes waiting thread") {
+  ThreadingSemaphore request, response;
+  request.init(0, 1);
+  response.init(0, 1);
+  std::atomic<int> served(0);
+
+  std::thread worker([&]() {
+    for (int i = 0; i < 100; i++) {
+      request.wait();
+      served++;
+      response.signal();
+    }
+  });
+
+  for (int i = 0; i < 100; i++) {
+    request.signal();
+    response.wait();
+    CHECK(served == i + 1);
+  }
+
+  worker.join();
+}
+
+TEST_CASE("Threading event merges sets and waits for condition") {
+  ThreadingEvent event;
+  event.init();
+
+  event.set();
+  event.set();
+  event.wait();
+  event.reset();
+
+  std::atomic<int> value(0);
+  std::thread producer([&]() {
+    for (int i = 0; i < 10; i++) {
+      value++;
+      event.set();
+    }
+  });
+
+  event.waitUntil([&]() { return value == 10; });
+  CHECK(value == 10);
+
+  producer.join();
+}
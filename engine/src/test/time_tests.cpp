@@ -0,0 +1,89 @@
+#include "doctest.hpp"
+#include "time/fixed_timestep.hpp"
+#include "time/frame_stats.hpp"
+
+using namespace Tyra;
+
+TEST_CASE("Frame stats computes average, extremes and percentiles") {
+  FrameStats stats;
+  CHECK(stats.getAverage() == 0);
+  CHECK(stats.getPercentile(99.0F) == 0);
+
+  // 95 smooth frames and 5 hitches
+  for (int i = 0; i < 95; i++) stats.add(16683);
+  for (int i = 0; i < 5; i++) stats.add(33367);
+
+  CHECK(stats.getCount() == 100);
+  CHECK(stats.getLast() == 33367);
+  CHECK(stats.getMin() == 16683);
+  CHECK(stats.getMax() == 33367);
+  CHECK(stats.getAverage() == (95 * 16683 + 5 * 33367) / 100);
+  CHECK(stats.getPercentile(50.0F) == 16683);
+  CHECK(stats.getPercentile(95.0F) == 16683);
+  CHECK(stats.getPercentile(96.0F) == 33367);
+  CHECK(stats.getPercentile(100.0F) == 33367);
+
+  const auto* histogram = stats.getHistogram();
+  CHECK(histogram[16683 / stats.getBucketSize()] == 95);
+  CHECK(histogram[33367 / stats.getBucketSize()] == 5);
+}
+
+TEST_CASE("Frame stats window drops oldest frames") {
+  FrameStats stats(1000);
+
+  stats.add(500000);
+  for (unsigned int i = 0; i < FrameStats::windowSize; i++) stats.add(20000);
+
+  CHECK(stats.getCount() == FrameStats::windowSize);
+  CHECK(stats.getMax() == 20000);
+  CHECK(stats.getAverage() == 20000);
+  CHECK(stats.getHistogram()[FrameStats::bucketsCount - 1] == 0);
+  CHECK(stats.getHistogram()[20] == FrameStats::windowSize);
+
+  stats.reset();
+  CHECK(stats.getCount() == 0);
+  CHECK(stats.getHistogram()[20] == 0);
+}
+
+TEST_CASE("Fixed timestep runs updates at constant rate") {
+  FixedTimestep timestep;
+  timestep.init(50.0F, 4);
+  CHECK(timestep.getStep() == doctest::Approx(0.02F));
+
+  unsigned int updates = 0;
+
+  // 60Hz display, 50Hz updates -> 5 updates per 6 frames
+  for (int frame = 0; frame < 60; frame++) {
+    timestep.advance(1.0F / 60.0F);
+    while (timestep.step()) updates++;
+
+    CHECK(timestep.getAlpha() >= 0.0F);
+    CHECK(timestep.getAlpha() < 1.0F);
+  }
+
+  CHECK(updates >= 49);
+  CHECK(updates <= 50);
+  CHECK(timestep.getDroppedCount() == 0);
+}
+
+TEST_CASE("Fixed timestep drops lag above max steps") {
+  FixedTimestep timestep;
+  timestep.init(60.0F, 4);
+
+  // Loading hitch
+  timestep.advance(1.0F);
+
+  unsigned int updates = 0;
+  while (timestep.step()) updates++;
+
+  CHECK(updates == 4);
+  CHECK(timestep.getStepsCount() == 4);
+  // 60 steps in total, last one may be partial by float rounding
+  CHECK(timestep.getDroppedCount() >= 55);
+  CHECK(timestep.getDroppedCount() <= 56);
+  CHECK(timestep.getAlpha() < 1.0F);
+
+  // Nothing left to catch up
+  timestep.advance(0.0F);
+  CHECK_FALSE(timestep.step());
+}
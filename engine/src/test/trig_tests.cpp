@@ -0,0 +1,96 @@
+#include "doctest.hpp"
+#include "math/trig_kernels.hpp"
+#include "math/fixed_angle.hpp"
+#include <cmath>
+#include <vector>
+
+using namespace Tyra;
+
+static const double twoPi = 6.283185307179586;
+
+TEST_CASE("Trig kernels sinCos error bound vs libm") {
+  float maxError = 0.0F;
+
+  for (int i = -20000; i <= 20000; i++) {
+    const float x = i * 0.0512F;  // <-1024, 1024>
+    float s, c;
+    TrigKernels::sinCos(x, &s, &c);
+
+    maxError = fmaxf(maxError, fabsf(s - static_cast<float>(sin(x))));
+    maxError = fmaxf(maxError, fabsf(c - static_cast<float>(cos(x))));
+  }
+
+  CHECK(maxError < 2e-6F);
+}
+
+TEST_CASE("Trig kernels array sinCos equals single calls") {
+  std::vector<float> angles, sines(37), cosines(37);
+  for (int i = 0; i < 37; i++) angles.push_back(-9.0F + i * 0.5F);
+
+  TrigKernels::sinCos(angles.data(), sines.data(), cosines.data(), 37);
+
+  for (int i = 0; i < 37; i++) {
+    float s, c;
+    TrigKernels::sinCos(angles[i], &s, &c);
+    CHECK(sines[i] == s);
+    CHECK(cosines[i] == c);
+  }
+}
+
+TEST_CASE("Trig kernels atan2 error bound vs libm") {
+  float maxError = 0.0F;
+
+  for (int i = 0; i < 4096; i++) {
+    const double angle = twoPi * i / 4096.0;
+    const float radius = 0.01F + (i % 7) * 30.0F;
+    const float x = static_cast<float>(cos(angle)) * radius;
+    const float y = static_cast<float>(sin(angle)) * radius;
+
+    const float error = fabsf(TrigKernels::atan2(y, x) - atan2f(y, x));
+    maxError = fmaxf(maxError, error);
+  }
+
+  CHECK(maxError < 2e-5F);
+  CHECK(TrigKernels::atan2(0.0F, 0.0F) == 0.0F);
+  CHECK(TrigKernels::atan2(0.0F, -1.0F) == doctest::Approx(M_PI));
+  CHECK(TrigKernels::atan2(-1.0F, 0.0F) == doctest::Approx(-M_PI / 2));
+}
+
+TEST_CASE("Fixed angle wraps and converts") {
+  CHECK(FixedAngle::fromDegrees(90.0F).value == 16384);
+  CHECK(FixedAngle::fromDegrees(-90.0F).value == 49152);
+  CHECK(FixedAngle::fromDegrees(720.0F).value == 0);
+  CHECK(FixedAngle::fromRadians(M_PI).value == 32768);
+
+  auto angle = FixedAngle(65000);
+  angle += FixedAngle(1000);
+  CHECK(angle.value == 464);
+  CHECK(FixedAngle(100).deltaTo(FixedAngle(65500)) == -136);
+
+  CHECK(FixedAngle(16384).toDegrees() == doctest::Approx(90.0F));
+  CHECK(FixedAngle(49152).toSignedRadians() == doctest::Approx(-M_PI / 2));
+}
+
+TEST_CASE("Fixed angle table lookup error bounds vs libm") {
+  float maxSinError = 0.0F;
+  float maxAtanError = 0.0F;
+
+  for (unsigned int i = 0; i < FixedAngle::unitsPerTurn; i += 7) {
+    const auto angle = FixedAngle(static_cast<unsigned short>(i));
+    const double radians = twoPi * i / FixedAngle::unitsPerTurn;
+
+    float s, c;
+    angle.sinCos(&s, &c);
+    const auto expectedSin = static_cast<float>(sin(radians));
+    const auto expectedCos = static_cast<float>(cos(radians));
+    maxSinError = fmaxf(maxSinError, fabsf(s - expectedSin));
+    maxSinError = fmaxf(maxSinError, fabsf(c - expectedCos));
+
+    const auto result =
+        FixedAngle::atan2(expectedSin * 5.0F, expectedCos * 5.0F);
+    maxAtanError = fmaxf(maxAtanError, abs(angle.deltaTo(result)));
+  }
+
+  CHECK(maxSinError < 1e-5F);
+  CHECK(maxAtanError <= 1.0F);
+}
@@ -0,0 +1,243 @@
+#include "doctest.hpp"
+#include "world/world_layout_file.hpp"
+#include "world/world_splitter.hpp"
+#include "world/world_streaming_planner.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using namespace Tyra;
+
+/** Row of cells along X, 100 units each, every cell with own texture. */
+static WorldLayoutSource makeLayout(const unsigned int& count) {
+  WorldLayoutSource source;
+  source.cellSize = 100.0F;
+
+  WorldLayoutSourceTexture shared;
+  shared.name = "ground.png";
+  shared.vramSize = 1000;
+  source.textures.push_back(shared);
+
+  for (unsigned int i = 0; i < count; i++) {
+    WorldLayoutSourceTexture texture;
+    texture.name = "wall" + std::to_string(i) + ".png";
+    texture.vramSize = 100;
+    source.textures.push_back(texture);
+
+    WorldLayoutSourceCell cell;
+    cell.x = i;
+    cell.z = 0;
+    cell.meshPath = "cell_" + std::to_string(i) + "_0.tym";
+    cell.ramSize = 10;
+    cell.textures = {0, i + 1};
+    cell.min[0] = i * 100.0F;
+    cell.min[1] = 0.0F;
+    cell.min[2] = 0.0F;
+    cell.max[0] = (i + 1) * 100.0F;
+    cell.max[1] = 10.0F;
+    cell.max[2] = 100.0F;
+    source.cells.push_back(cell);
+  }
+
+  return source;
+}
+
+static WorldStreamingOptions makeOptions() {
+  WorldStreamingOptions options;
+  options.loadRadius = 50.0F;
+  options.prefetchRadius = 150.0F;
+  options.evictRadius = 250.0F;
+  options.ramBudget = 1000;
+  options.vramBudget = 10000;
+  options.maxLoadsInFlight = 100;
+  return options;
+}
+
+TEST_CASE("World layout roundtrip") {
+  auto data = WorldLayoutFile::build(makeLayout(3));
+  REQUIRE(WorldLayoutFile::validate(data.data(), data.size()));
+
+  const auto* header = WorldLayoutFile::getHeader(data.data());
+  CHECK(header->cellsCount == 3);
+  CHECK(header->texturesCount == 4);
+  CHECK(header->cellSize == 100.0F);
+
+  const auto* cell = WorldLayoutFile::getCell(data.data(), 2);
+  CHECK(cell->x == 2);
+  CHECK(cell->max[0] == 300.0F);
+  CHECK(std::string(WorldLayoutFile::getString(
+            data.data(), cell->meshPathOffset)) == "cell_2_0.tym");
+  REQUIRE(cell->texturesCount == 2);
+  CHECK(WorldLayoutFile::getCellTexture(data.data(), cell, 0) == 0);
+
+  const auto texture = WorldLayoutFile::getCellTexture(data.data(), cell, 1);
+  CHECK(std::string(WorldLayoutFile::getString(
+            data.data(),
+            WorldLayoutFile::getTexture(data.data(), texture)->nameOffset)) ==
+        "wall2.png");
+}
+
+TEST_CASE("World layout rejects invalid data") {
+  auto source = makeLayout(2);
+  source.cells[1].textures.push_back(10);
+  CHECK(WorldLayoutFile::build(source).empty());
+
+  auto data = WorldLayoutFile::build(makeLayout(2));
+  CHECK_FALSE(WorldLayoutFile::validate(data.data(), data.size() - 1));
+
+  auto* cell = const_cast<WorldLayoutCell*>(
+      WorldLayoutFile::getCell(data.data(), 0));
+  cell->texturesCount = 100;
+  CHECK_FALSE(WorldLayoutFile::validate(data.data(), data.size()));
+}
+
+TEST_CASE("World streaming loads nearest cells first") {
+  auto data = WorldLayoutFile::build(makeLayout(10));
+  std::vector<WorldCellState> states(10, WORLD_CELL_UNLOADED);
+
+  CHECK(WorldStreamingPlanner::getDistance(
+            WorldLayoutFile::getCell(data.data(), 2), 250.0F, 50.0F) == 0.0F);
+  CHECK(WorldStreamingPlanner::getDistance(
+            WorldLayoutFile::getCell(data.data(), 4), 250.0F, 50.0F) ==
+        150.0F);
+
+  auto plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                          makeOptions());
+  REQUIRE(plan.loads.size() == 5);
+  CHECK(plan.loads[0] == 2);
+  CHECK(std::is_permutation(plan.loads.begin(), plan.loads.end(),
+                            std::vector<unsigned int>{2, 1, 3, 0, 4}.begin()));
+  CHECK(plan.evictions.empty());
+  CHECK(plan.overBudget == 0);
+
+  auto options = makeOptions();
+  options.maxLoadsInFlight = 2;
+  states[2] = WORLD_CELL_LOADING;
+  plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                     options);
+  CHECK(plan.loads.size() == 1);
+}
+
+TEST_CASE("World streaming evicts far cells") {
+  auto data = WorldLayoutFile::build(makeLayout(10));
+  std::vector<WorldCellState> states(10, WORLD_CELL_UNLOADED);
+  states[0] = WORLD_CELL_RESIDENT;
+  states[1] = WORLD_CELL_RESIDENT;
+  states[2] = WORLD_CELL_LOADING;
+
+  // Camera in cell 5: cell 0 is 400 away, cell 1 300, cell 2 200
+  auto plan = WorldStreamingPlanner::plan(data.data(), states, 550.0F, 50.0F,
+                                          makeOptions());
+  CHECK(plan.evictions == std::vector<unsigned int>{0, 1});
+  CHECK(std::find(plan.loads.begin(), plan.loads.end(), 5) !=
+        plan.loads.end());
+}
+
+TEST_CASE("World streaming respects budgets") {
+  auto data = WorldLayoutFile::build(makeLayout(10));
+  std::vector<WorldCellState> states(10, WORLD_CELL_UNLOADED);
+
+  // Ground is shared, so 3 cells = 1000 + 3 * 100
+  auto options = makeOptions();
+  options.vramBudget = 1300;
+  auto plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                          options);
+  CHECK(plan.loads.size() == 3);
+
+  options.ramBudget = 20;
+  plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                     options);
+  CHECK(plan.loads.size() == 2);
+
+  // Closer cells replace far prefetched ones, cell 3 doesn't fit anymore
+  states[0] = WORLD_CELL_RESIDENT;
+  states[4] = WORLD_CELL_RESIDENT;
+  plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                     options);
+  CHECK(plan.loads == std::vector<unsigned int>{2, 1});
+  CHECK(plan.evictions.size() == 2);
+  CHECK(plan.overBudget == 1);
+
+  unsigned int ram, vram;
+  states = std::vector<WorldCellState>(10, WORLD_CELL_RESIDENT);
+  WorldStreamingPlanner::getUsage(data.data(), states, &ram, &vram);
+  CHECK(ram == 100);
+  CHECK(vram == 2000);
+
+  options.ramBudget = 5;
+  states = std::vector<WorldCellState>(10, WORLD_CELL_UNLOADED);
+  plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                     options);
+  CHECK(plan.loads.empty());
+  CHECK(plan.overBudget == 3);
+}
+
+TEST_CASE("World streaming doesn't evict for cell which won't fit") {
+  auto source = makeLayout(5);
+  source.cells[2].ramSize = 500;
+  auto data = WorldLayoutFile::build(source);
+
+  std::vector<WorldCellState> states(5, WORLD_CELL_UNLOADED);
+  states[0] = WORLD_CELL_RESIDENT;
+  states[4] = WORLD_CELL_RESIDENT;
+
+  // Only cell 2 is wanted, and it is bigger than whole budget
+  auto options = makeOptions();
+  options.loadRadius = 10.0F;
+  options.prefetchRadius = 10.0F;
+  options.ramBudget = 100;
+  auto plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                          options);
+  CHECK(plan.loads.empty());
+  CHECK(plan.evictions.empty());
+  CHECK(plan.overBudget == 1);
+
+  // Fits after evicting both far cells
+  options.ramBudget = 500;
+  plan = WorldStreamingPlanner::plan(data.data(), states, 250.0F, 50.0F,
+                                     options);
+  CHECK(plan.loads == std::vector<unsigned int>{2});
+  CHECK(plan.evictions.size() == 2);
+}
+
+TEST_CASE("World splitter assigns triangles by centroid") {
+  BinaryMeshSource mesh;
+  mesh.loadNormals = false;
+  mesh.loadLightmap = false;
+
+  BinaryMeshSourceMaterial material;
+  material.name = "ground";
+  material.texturePath = "ground.png";
+  for (auto& value : material.ambient) value = 128.0F;
+  material.frames.resize(1);
+  material.frames[0].count = 0;
+
+  // One triangle per cell of 3x2 grid
+  for (int x = 0; x < 3; x++)
+    for (int z = 0; z < 2; z++) {
+      const float vertices[12] = {x * 10.0F + 1, 0, z * 10.0F + 1, 1,
+                                  x * 10.0F + 9, 0, z * 10.0F + 1, 1,
+                                  x * 10.0F + 1, 5, z * 10.0F + 9, 1};
+      auto& array = material.frames[0].arrays[BINARY_MESH_VERTICES];
+      array.insert(array.end(), vertices, vertices + 12);
+      material.frames[0].count += 3;
+    }
+  mesh.materials.push_back(material);
+
+  auto cells = WorldSplitter::split(mesh, 10.0F);
+  REQUIRE(cells.size() == 6);
+  CHECK(cells[0].x == 0);
+  CHECK(cells[0].z == 0);
+  CHECK(cells[1].x == 1);
+  CHECK(cells[5].z == 1);
+
+  const auto& cell = cells[4];
+  CHECK(cell.min[0] == 11.0F);
+  CHECK(cell.max[0] == 19.0F);
+  CHECK(cell.max[1] == 5.0F);
+  REQUIRE(cell.mesh.materials.size() == 1);
+  CHECK(cell.mesh.materials[0].texturePath.value() == "ground.png");
+  CHECK(cell.mesh.materials[0].frames[0].count == 3);
+  CHECK(WorldSplitter::getArraysSize(cell.mesh) == 3 * 4 * sizeof(float));
+  CHECK_FALSE(BinaryMeshFile::build(cell.mesh).empty());
+}
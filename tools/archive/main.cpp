@@ -0,0 +1,130 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+/**
+ * Packs files into Tyra archive, loadable by ArchiveReader.
+ * Entry name is path relative to base directory.
+ * Files are stored in given order, so list them in loading order.
+ * Usage: archive [-z] output.tya basedir file1 [file2 ...]
+ *        archive [-z] output.tya basedir @list.txt
+ *   -z  compress entries (only if it saves space)
+ */
+
+#include "archive/archive_file.hpp"
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Tyra;
+
+static bool readFile(const std::string& path,
+                     std::vector<unsigned char>& output) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file) return false;
+
+  fseek(file, 0, SEEK_END);
+  output.resize(ftell(file));
+  fseek(file, 0, SEEK_SET);
+  size_t readed = fread(output.data(), 1, output.size(), file);
+  fclose(file);
+
+  return readed == output.size();
+}
+
+static bool readList(const std::string& path, std::vector<std::string>& names) {
+  FILE* file = fopen(path.c_str(), "r");
+  if (!file) return false;
+
+  char line[1024];
+  while (fgets(line, sizeof(line), file)) {
+    std::string name = line;
+    while (!name.empty() && (name.back() == '\n' || name.back() == '\r' ||
+                             name.back() == ' '))
+      name.pop_back();
+    if (!name.empty() && name[0] != '#') names.push_back(name);
+  }
+  fclose(file);
+
+  return true;
+}
+
+int main(int argc, char** argv) {
+  int arg = 1;
+  bool compress = false;
+  if (arg < argc && strcmp(argv[arg], "-z") == 0) {
+    compress = true;
+    arg++;
+  }
+
+  if (argc - arg < 3) {
+    printf("Usage: archive [-z] output.tya basedir file1 [file2 ...]\n");
+    printf("       archive [-z] output.tya basedir @list.txt\n");
+    return 1;
+  }
+
+  std::string output = argv[arg++];
+  std::string baseDir = argv[arg++];
+  if (baseDir.back() != '/' && baseDir.back() != '\\') baseDir += "/";
+
+  std::vector<std::string> names;
+  for (; arg < argc; arg++) {
+    if (argv[arg][0] == '@') {
+      if (!readList(argv[arg] + 1, names)) {
+        printf("Failed to read %s\n", argv[arg] + 1);
+        return 1;
+      }
+    } else {
+      names.push_back(argv[arg]);
+    }
+  }
+
+  std::vector<ArchiveSource> sources;
+  unsigned int unpackedSize = 0;
+  for (const auto& name : names) {
+    ArchiveSource source;
+    source.name = ArchiveFile::normalizeName(name);
+    source.compress = compress;
+
+    if (!readFile(baseDir + name, source.data)) {
+      printf("Failed to read %s\n", (baseDir + name).c_str());
+      return 1;
+    }
+
+    unpackedSize += source.data.size();
+    sources.push_back(source);
+  }
+
+  auto archive = ArchiveFile::build(sources);
+  if (archive.empty()) {
+    printf("Duplicated entry names (or hash collision)!\n");
+    return 1;
+  }
+
+  for (const auto& source : sources) {
+    const auto* entry =
+        ArchiveFile::find(archive.data(), ArchiveFile::getNameHash(source.name));
+    printf("%s: %u -> %u bytes%s\n", source.name.c_str(), entry->unpackedSize,
+           entry->size,
+           entry->compression == ARCHIVE_COMPRESSION_LZ ? " (lz)" : "");
+  }
+
+  FILE* file = fopen(output.c_str(), "wb");
+  if (!file) {
+    printf("Failed to write %s\n", output.c_str());
+    return 1;
+  }
+  fwrite(archive.data(), 1, archive.size(), file);
+  fclose(file);
+
+  printf("%s: %zu entries, %u -> %zu bytes\n", output.c_str(), sources.size(),
+         unpackedSize, archive.size());
+  return 0;
+}
@@ -0,0 +1,262 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+/**
+ * Cooks OBJ meshes into binary mesh (.tym), loadable by BinaryMeshLoader.
+ * Conversion rules are the same as in ObjLoader, so result is equal to
+ * ObjLoader::load() output with the same options.
+ * Usage: meshcook [options] input.obj output.tym
+ *   -s <scale>     vertices scale (default 1.0)
+ *   -f <count>     animation frames count. Frames are read from
+ *                  input_000001.obj, input_000002.obj... (default 1)
+ *   --flip-uvs     flip V texture coordinate
+ *   -O             optimize mesh (degenerates removal, materials merge,
+ *                  spatial triangle sort), see MeshOptimizer
+ */
+
+#define TINYOBJLOADER_USE_MAPBOX_EARCUT
+#define TINYOBJLOADER_IMPLEMENTATION
+#include "loaders/3d/obj_loader/tiny_obj_loader.hpp"
+
+#include "mesh/binary_mesh_file.hpp"
+#include "mesh/mesh_optimizer.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Tyra;
+
+struct CookOptions {
+  float scale = 1.0F;
+  unsigned int frames = 1;
+  bool flipUVs = false;
+  bool optimize = false;
+};
+
+static std::string getFramePath(const std::string& path,
+                                const unsigned int& index,
+                                const unsigned int& count) {
+  if (count == 1) return path;
+
+  auto dot = path.find_last_of('.');
+  char number[8];
+  snprintf(number, sizeof(number), "%06u", index);
+  return path.substr(0, dot) + "_" + number + path.substr(dot);
+}
+
+static bool parse(const std::string& path, const CookOptions& options,
+                  tinyobj::ObjReader& reader) {
+  tinyobj::ObjReaderConfig config;
+  config.triangulate = options.frames == 1;
+  config.triangulation_method = options.frames == 1 ? "earcut" : "simple";
+
+  auto slash = path.find_last_of("/\\");
+  config.mtl_search_path =
+      slash == std::string::npos ? "./" : path.substr(0, slash + 1);
+
+  if (!reader.ParseFromFile(path, config)) {
+    printf("%s: %s\n", path.c_str(), reader.Error().c_str());
+    return false;
+  }
+
+  if (!reader.Warning().empty())
+    printf("%s: %s\n", path.c_str(), reader.Warning().c_str());
+
+  if (reader.GetMaterials().empty()) {
+    printf("%s: no material data found, please add mtllib\n", path.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+static void addMaterials(const tinyobj::ObjReader& reader,
+                         BinaryMeshSource& output) {
+  output.loadNormals = !reader.GetAttrib().normals.empty();
+  output.loadLightmap = false;
+
+  for (const auto& input : reader.GetMaterials()) {
+    BinaryMeshSourceMaterial material;
+    material.name = input.name;
+    if (!input.diffuse_texname.empty())
+      material.texturePath = input.diffuse_texname;
+
+    material.ambient[0] = input.diffuse[0] * 128.0F;
+    material.ambient[1] = input.diffuse[1] * 128.0F;
+    material.ambient[2] = input.diffuse[2] * 128.0F;
+    material.ambient[3] = 128.0F;
+
+    output.materials.push_back(material);
+  }
+}
+
+static bool importFrame(const tinyobj::ObjReader& reader,
+                        const CookOptions& options, BinaryMeshSource& output) {
+  const auto& attrib = reader.GetAttrib();
+  const auto& materials = reader.GetMaterials();
+
+  if (materials.size() != output.materials.size()) {
+    printf("Every frame must have the same materials!\n");
+    return false;
+  }
+
+  std::vector<BinaryMeshSourceFrame> frames(materials.size());
+  for (auto& frame : frames) frame.count = 0;
+
+  for (const auto& shape : reader.GetShapes()) {
+    const auto& mesh = shape.mesh;
+
+    size_t indexOffset = 0;
+    for (size_t f = 0; f < mesh.num_face_vertices.size(); f++) {
+      const auto vertCountPerFace = size_t(mesh.num_face_vertices[f]);
+      const int materialId = mesh.material_ids[f];
+
+      if (vertCountPerFace != 3) {
+        printf("Please triangulate obj files if you are animating!\n");
+        return false;
+      }
+      if (materialId < 0) {
+        printf("Face without material found!\n");
+        return false;
+      }
+
+      auto& material = output.materials[materialId];
+      auto& frame = frames[materialId];
+
+      for (size_t v = 0; v < vertCountPerFace; v++) {
+        const auto idx = mesh.indices[indexOffset + v];
+
+        float vertex[4] = {attrib.vertices[3 * idx.vertex_index + 0],
+                           attrib.vertices[3 * idx.vertex_index + 1],
+                           attrib.vertices[3 * idx.vertex_index + 2], 1.0F};
+        for (int i = 0; i < 3; i++) vertex[i] *= options.scale;
+        auto& vertices = frame.arrays[BINARY_MESH_VERTICES];
+        vertices.insert(vertices.end(), vertex, vertex + 4);
+
+        if (output.loadNormals) {
+          float normal[4] = {0.0F, 0.0F, 0.0F, 1.0F};
+          if (idx.normal_index >= 0)
+            for (int i = 0; i < 3; i++)
+              normal[i] = attrib.normals[3 * idx.normal_index + i];
+          auto& normals = frame.arrays[BINARY_MESH_NORMALS];
+          normals.insert(normals.end(), normal, normal + 4);
+        }
+
+        if (material.texturePath.has_value()) {
+          float st[4] = {0.0F, 0.0F, 1.0F, 0.0F};
+          if (idx.texcoord_index >= 0) {
+            st[0] = attrib.texcoords[2 * idx.texcoord_index + 0];
+            st[1] = attrib.texcoords[2 * idx.texcoord_index + 1];
+            if (options.flipUVs) st[1] = 1.0F - st[1];
+          }
+          auto& coords = frame.arrays[BINARY_MESH_TEXTURE_COORDS];
+          coords.insert(coords.end(), st, st + 4);
+        }
+
+        frame.count++;
+      }
+
+      indexOffset += vertCountPerFace;
+    }
+  }
+
+  for (unsigned int i = 0; i < frames.size(); i++)
+    output.materials[i].frames.push_back(frames[i]);
+
+  return true;
+}
+
+/** Same as ObjLoader: materials without triangles are not supported. */
+static bool checkMaterials(const BinaryMeshSource& source) {
+  for (const auto& material : source.materials)
+    for (const auto& frame : material.frames)
+      if (frame.count == 0) {
+        printf("Material \"%s\" has no triangles, please remove it!\n",
+               material.name.c_str());
+        return false;
+      }
+  return true;
+}
+
+int main(int argc, char** argv) {
+  CookOptions options;
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      options.scale = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      options.frames = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--flip-uvs") == 0) {
+      options.flipUVs = true;
+    } else if (strcmp(argv[i], "-O") == 0) {
+      options.optimize = true;
+    } else {
+      files.push_back(argv[i]);
+    }
+  }
+
+  if (files.size() != 2 || options.frames == 0) {
+    printf("Usage: meshcook [-s scale] [-f frames] [--flip-uvs] [-O] ");
+    printf("input.obj output.tym\n");
+    return 1;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+
+  BinaryMeshSource source;
+  for (unsigned int i = 1; i <= options.frames; i++) {
+    auto path = getFramePath(files[0], i, options.frames);
+
+    tinyobj::ObjReader reader;
+    if (!parse(path, options, reader)) return 1;
+
+    if (i == 1) addMaterials(reader, source);
+    if (!importFrame(reader, options, source)) return 1;
+  }
+
+  if (!checkMaterials(source)) return 1;
+
+  if (options.optimize) {
+    auto stats = MeshOptimizer::optimize(source, MeshOptimizerOptions());
+    printf("Optimized: %u -> %u triangles (%u degenerates), ",
+           stats.trianglesBefore, stats.trianglesAfter,
+           stats.degeneratesRemoved);
+    printf("%u materials merged, package spread %.2f -> %.2f\n",
+           stats.materialsMerged, stats.packageSpreadBefore,
+           stats.packageSpreadAfter);
+  }
+
+  auto data = BinaryMeshFile::build(source);
+  if (data.empty()) {
+    printf("Failed to build binary mesh!\n");
+    return 1;
+  }
+
+  FILE* file = fopen(files[1].c_str(), "wb");
+  if (!file) {
+    printf("Failed to write %s\n", files[1].c_str());
+    return 1;
+  }
+  fwrite(data.data(), 1, data.size(), file);
+  fclose(file);
+
+  auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count();
+
+  printf("%s: %zu materials, %u frames, %zu bytes (parsed in %lld ms)\n",
+         files[1].c_str(), source.materials.size(), options.frames,
+         data.size(), static_cast<long long>(ms));
+  return 0;
+}
@@ -0,0 +1,82 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+/**
+ * Packs ADPCM samples (adpenc output) into sound bank,
+ * loadable by AudioSoundBank.
+ * Sample name is filename without extension.
+ * Usage: soundbank output.bank shoot.adpcm punch.adpcm ...
+ */
+
+#include "audio/sound_bank_file.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Tyra;
+
+static std::string getName(const std::string& path) {
+  auto slash = path.find_last_of("/\\");
+  auto name = slash == std::string::npos ? path : path.substr(slash + 1);
+  auto dot = name.find_last_of('.');
+  return dot == std::string::npos ? name : name.substr(0, dot);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    printf("Usage: soundbank output.bank sample1.adpcm [sample2.adpcm ...]\n");
+    return 1;
+  }
+
+  std::vector<SoundBankSource> sources;
+  for (int i = 2; i < argc; i++) {
+    FILE* file = fopen(argv[i], "rb");
+    if (!file) {
+      printf("Failed to read %s\n", argv[i]);
+      return 1;
+    }
+
+    SoundBankSource source;
+    source.name = getName(argv[i]);
+    fseek(file, 0, SEEK_END);
+    source.data.resize(ftell(file));
+    fseek(file, 0, SEEK_SET);
+    size_t readed = fread(source.data.data(), 1, source.data.size(), file);
+    fclose(file);
+
+    if (readed != source.data.size()) {
+      printf("Failed to read %s\n", argv[i]);
+      return 1;
+    }
+
+    for (const auto& other : sources)
+      if (other.name == source.name) {
+        printf("Duplicated sample name: %s\n", source.name.c_str());
+        return 1;
+      }
+
+    printf("%s: %zu bytes\n", source.name.c_str(), source.data.size());
+    sources.push_back(source);
+  }
+
+  auto bank = SoundBankFile::build(sources);
+
+  FILE* file = fopen(argv[1], "wb");
+  if (!file) {
+    printf("Failed to write %s\n", argv[1]);
+    return 1;
+  }
+  fwrite(bank.data(), 1, bank.size(), file);
+  fclose(file);
+
+  printf("%s: %zu samples, %zu bytes\n", argv[1], sources.size(),
+         bank.size());
+  return 0;
+}
@@ -0,0 +1,221 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+/**
+ * Converts PCM WAV into IMA ADPCM WAV, streamable by AudioSong.
+ * Usage: wav2ima input.wav output.wav [-r rate] [-c channels]
+ *        [-b blockAlignPerChannel] [--bench iterations]
+ */
+
+#include "audio/ima_adpcm.hpp"
+#include "audio/wav_parser.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Tyra;
+
+static bool readFile(const char* path, std::vector<unsigned char>* data) {
+  FILE* file = fopen(path, "rb");
+  if (!file) return false;
+  fseek(file, 0, SEEK_END);
+  data->resize(ftell(file));
+  fseek(file, 0, SEEK_SET);
+  bool result = fread(data->data(), 1, data->size(), file) == data->size();
+  fclose(file);
+  return result;
+}
+
+/** Converts PCM data into 16bit samples with given channel count. */
+static std::vector<short> toShorts(const WavInfo& info,
+                                   const unsigned char* data,
+                                   const unsigned int& channels) {
+  const unsigned int bytesPerSample = info.bitsPerSample / 8;
+  const unsigned int frames = info.dataSize / (bytesPerSample * info.channels);
+  std::vector<short> result(frames * channels);
+
+  for (unsigned int i = 0; i < frames; i++) {
+    int sum = 0;
+    short input[2];
+    for (unsigned int ch = 0; ch < info.channels; ch++) {
+      const unsigned char* sample =
+          data + (i * info.channels + ch) * bytesPerSample;
+      input[ch] = bytesPerSample == 1 ? (sample[0] - 128) << 8
+                                      : static_cast<short>(sample[0] |
+                                                           (sample[1] << 8));
+      sum += input[ch];
+    }
+
+    for (unsigned int ch = 0; ch < channels; ch++) {
+      if (channels == info.channels)
+        result[i * channels + ch] = input[ch];
+      else if (channels == 1)
+        result[i] = sum / static_cast<int>(info.channels);
+      else
+        result[i * channels + ch] = input[0];
+    }
+  }
+
+  return result;
+}
+
+/** Linear interpolation resampler. */
+static std::vector<short> resample(const std::vector<short>& input,
+                                   const unsigned int& channels,
+                                   const unsigned int& fromRate,
+                                   const unsigned int& toRate) {
+  if (fromRate == toRate) return input;
+
+  const unsigned int inFrames = input.size() / channels;
+  const unsigned int outFrames =
+      static_cast<unsigned long long>(inFrames) * toRate / fromRate;
+  std::vector<short> result(outFrames * channels);
+
+  for (unsigned int i = 0; i < outFrames; i++) {
+    const double position = static_cast<double>(i) * fromRate / toRate;
+    const unsigned int index = static_cast<unsigned int>(position);
+    const double fraction = position - index;
+    const unsigned int next = index + 1 < inFrames ? index + 1 : index;
+
+    for (unsigned int ch = 0; ch < channels; ch++) {
+      const double a = input[index * channels + ch];
+      const double b = input[next * channels + ch];
+      result[i * channels + ch] = static_cast<short>(a + (b - a) * fraction);
+    }
+  }
+
+  return result;
+}
+
+static void benchmark(const std::vector<unsigned char>& encoded,
+                      const WavInfo& info, const unsigned int& iterations) {
+  std::vector<short> block(info.samplesPerBlock * info.channels);
+  const auto start = std::chrono::steady_clock::now();
+  unsigned long long samples = 0;
+
+  for (unsigned int it = 0; it < iterations; it++) {
+    for (unsigned int offset = 0; offset < encoded.size();
+         offset += info.blockAlign) {
+      unsigned int size = encoded.size() - offset;
+      if (size > info.blockAlign) size = info.blockAlign;
+      samples += ImaAdpcm::decodeBlock(encoded.data() + offset, size,
+                                       info.channels, block.data());
+    }
+  }
+
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+  const double audioSeconds = static_cast<double>(samples) / info.sampleRate;
+
+  printf("Decode benchmark: %u iterations, %.3f s\n", iterations, seconds);
+  printf("  %.1f MB/s of PCM output, %.0fx realtime\n",
+         samples * info.channels * 2 / seconds / (1024.0 * 1024.0),
+         audioSeconds / seconds);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    printf(
+        "Usage: wav2ima input.wav output.wav [-r rate] [-c channels] "
+        "[-b blockAlignPerChannel] [--bench iterations]\n");
+    return 1;
+  }
+
+  unsigned int rate = 22050, channels = 0, blockAlignPerChannel = 512;
+  unsigned int benchIterations = 0;
+
+  for (int i = 3; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "-r") == 0)
+      rate = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-c") == 0)
+      channels = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "-b") == 0)
+      blockAlignPerChannel = atoi(argv[i + 1]);
+    else if (strcmp(argv[i], "--bench") == 0)
+      benchIterations = atoi(argv[i + 1]);
+  }
+
+  std::vector<unsigned char> input;
+  if (!readFile(argv[1], &input)) {
+    printf("Failed to read %s\n", argv[1]);
+    return 1;
+  }
+
+  WavInfo info;
+  if (!WavParser::parse(input.data(), input.size(), input.size(), &info) ||
+      info.format != WAV_FORMAT_PCM) {
+    printf("Input must be mono/stereo 8/16bit PCM WAV\n");
+    return 1;
+  }
+
+  if (channels == 0) channels = info.channels;
+  if (channels < 1 || channels > ImaAdpcm::maxChannels ||
+      blockAlignPerChannel < 8 || blockAlignPerChannel % 4 != 0) {
+    printf("Invalid channels or block align\n");
+    return 1;
+  }
+
+  auto pcm = resample(toShorts(info, input.data() + info.dataOffset, channels),
+                      channels, info.sampleRate, rate);
+
+  WavInfo output;
+  output.format = WAV_FORMAT_IMA_ADPCM;
+  output.channels = channels;
+  output.sampleRate = rate;
+  output.bitsPerSample = 4;
+  output.blockAlign = blockAlignPerChannel * channels;
+  output.samplesPerBlock =
+      ImaAdpcm::getSamplesPerBlock(output.blockAlign, channels);
+
+  const unsigned int frames = pcm.size() / channels;
+  const unsigned int blocks =
+      (frames + output.samplesPerBlock - 1) / output.samplesPerBlock;
+
+  std::vector<unsigned char> encoded(blocks * output.blockAlign);
+  unsigned char indexes[ImaAdpcm::maxChannels] = {0, 0};
+
+  for (unsigned int i = 0; i < blocks; i++) {
+    const unsigned int first = i * output.samplesPerBlock;
+    unsigned int samples = frames - first;
+    if (samples > output.samplesPerBlock) samples = output.samplesPerBlock;
+
+    ImaAdpcm::encodeBlock(pcm.data() + first * channels, samples,
+                          output.blockAlign, channels, indexes,
+                          encoded.data() + i * output.blockAlign);
+  }
+
+  output.dataSize = encoded.size();
+
+  unsigned char header[64];
+  const unsigned int headerSize = WavParser::write(output, header);
+
+  FILE* file = fopen(argv[2], "wb");
+  if (!file) {
+    printf("Failed to write %s\n", argv[2]);
+    return 1;
+  }
+  fwrite(header, 1, headerSize, file);
+  fwrite(encoded.data(), 1, encoded.size(), file);
+  fclose(file);
+
+  printf("%s: %uHz %uch %ubit PCM, %u bytes\n", argv[1], info.sampleRate,
+         info.channels, info.bitsPerSample, info.dataSize);
+  printf("%s: %uHz %uch IMA ADPCM, %u bytes (%.1f KB/s)\n", argv[2], rate,
+         channels, output.dataSize + headerSize,
+         static_cast<double>(output.blockAlign) * rate /
+             output.samplesPerBlock / 1024.0);
+
+  if (benchIterations > 0) benchmark(encoded, output, benchIterations);
+
+  return 0;
+}
@@ -0,0 +1,200 @@
+/*
+# _____        ____   ___
+#   |     \/   ____| |___|
+#   |     |   |   \  |   |
+#-----------------------------------------------------------------------
+# Copyright 2022, tyra - https://github.com/h4570/tyra
+# Licensed under Apache License 2.0
+# Sandro Sobczyński <sandro.sobczynski@gmail.com>
+*/
+
+/**
+ * Splits static level mesh (.tym, meshcook output) into XZ grid cells,
+ * streamable by WorldStreamer.
+ * Writes cell_<x>_<z>.tym files and world.tyw layout into output dir.
+ * Usage: worldsplit [-c size] [-t texdir] input.tym outputdir
+ *   -c <size>     cell size in world units (default 100.0)
+ *   -t <texdir>   directory with PNG textures, used to estimate VRAM
+ *                 size of every texture (default: input directory)
+ * Textures are not copied, put them next to world.tyw.
+ */
+
+#include "mesh/binary_mesh_file.hpp"
+#include "world/world_layout_file.hpp"
+#include "world/world_splitter.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Tyra;
+
+static bool readFile(const std::string& path,
+                     std::vector<unsigned char>& output) {
+  FILE* file = fopen(path.c_str(), "rb");
+  if (!file) return false;
+
+  fseek(file, 0, SEEK_END);
+  output.resize(ftell(file));
+  fseek(file, 0, SEEK_SET);
+  size_t readed = fread(output.data(), 1, output.size(), file);
+  fclose(file);
+
+  return readed == output.size();
+}
+
+static bool writeFile(const std::string& path,
+                      const std::vector<unsigned char>& data) {
+  FILE* file = fopen(path.c_str(), "wb");
+  if (!file) return false;
+
+  size_t written = fwrite(data.data(), 1, data.size(), file);
+  fclose(file);
+
+  return written == data.size();
+}
+
+static std::string getFilename(const std::string& path) {
+  auto slash = path.find_last_of("/\\");
+  return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+
+static std::string getDirectory(const std::string& path) {
+  auto slash = path.find_last_of("/\\");
+  return slash == std::string::npos ? "" : path.substr(0, slash + 1);
+}
+
+/** Texture memory of PNG as Tyra stores it (pixels + clut), 0 if unknown */
+static unsigned int getVramSize(const std::string& path) {
+  std::vector<unsigned char> data;
+  if (!readFile(path, data) || data.size() < 26 ||
+      memcmp(data.data() + 12, "IHDR", 4) != 0)
+    return 0;
+
+  auto readInt = [&data](const unsigned int& offset) {
+    return (data[offset] << 24) | (data[offset + 1] << 16) |
+           (data[offset + 2] << 8) | data[offset + 3];
+  };
+
+  const unsigned int width = readInt(16);
+  const unsigned int height = readInt(20);
+  const unsigned char bitDepth = data[24];
+  const unsigned char colorType = data[25];
+
+  // Palette: 4 or 8 bit indices + 32 bit clut
+  if (colorType == 3) {
+    if (bitDepth <= 4) return width * height / 2 + 16 * 4;
+    return width * height + 256 * 4;
+  }
+
+  // RGB
+  if (colorType == 2) return width * height * 3;
+
+  return width * height * 4;
+}
+
+int main(int argc, char** argv) {
+  float cellSize = 100.0F;
+  std::string texturesDir;
+  std::vector<std::string> files;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-c") == 0 && i + 1 < argc) {
+      cellSize = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+      texturesDir = argv[++i];
+    } else {
+      files.push_back(argv[i]);
+    }
+  }
+
+  if (files.size() != 2 || !(cellSize > 0.0F)) {
+    printf("Usage: worldsplit [-c size] [-t texdir] input.tym outputdir\n");
+    return 1;
+  }
+
+  std::string outputDir = files[1];
+  if (outputDir.back() != '/' && outputDir.back() != '\\') outputDir += "/";
+
+  if (texturesDir.empty()) texturesDir = getDirectory(files[0]);
+  if (!texturesDir.empty() && texturesDir.back() != '/' &&
+      texturesDir.back() != '\\')
+    texturesDir += "/";
+
+  std::vector<unsigned char> input;
+  BinaryMeshSource mesh;
+  if (!readFile(files[0], input) ||
+      !BinaryMeshFile::read(input.data(), input.size(), &mesh)) {
+    printf("Failed to read binary mesh %s\n", files[0].c_str());
+    return 1;
+  }
+
+  auto cells = WorldSplitter::split(mesh, cellSize);
+
+  WorldLayoutSource layout;
+  layout.cellSize = cellSize;
+  std::map<std::string, unsigned int> textureIndices;
+
+  for (auto& cell : cells) {
+    WorldLayoutSourceCell layoutCell;
+    layoutCell.x = cell.x;
+    layoutCell.z = cell.z;
+    layoutCell.meshPath = "cell_" + std::to_string(cell.x) + "_" +
+                          std::to_string(cell.z) + ".tym";
+    layoutCell.ramSize = WorldSplitter::getArraysSize(cell.mesh);
+
+    for (unsigned int axis = 0; axis < 3; axis++) {
+      layoutCell.min[axis] = cell.min[axis];
+      layoutCell.max[axis] = cell.max[axis];
+    }
+
+    for (auto& material : cell.mesh.materials) {
+      if (!material.texturePath.has_value()) continue;
+
+      auto name = getFilename(material.texturePath.value());
+      material.texturePath = name;
+
+      auto found = textureIndices.find(name);
+      if (found == textureIndices.end()) {
+        WorldLayoutSourceTexture texture;
+        texture.name = name;
+        texture.vramSize = getVramSize(texturesDir + name);
+        if (texture.vramSize == 0)
+          printf("Warning: can't read PNG %s%s, VRAM size unknown\n",
+                 texturesDir.c_str(), name.c_str());
+
+        found = textureIndices.insert({name, layout.textures.size()}).first;
+        layout.textures.push_back(texture);
+      }
+
+      bool isAdded = false;
+      for (const auto& index : layoutCell.textures)
+        if (index == found->second) isAdded = true;
+      if (!isAdded) layoutCell.textures.push_back(found->second);
+    }
+
+    auto data = BinaryMeshFile::build(cell.mesh);
+    if (data.empty() || !writeFile(outputDir + layoutCell.meshPath, data)) {
+      printf("Failed to write %s%s\n", outputDir.c_str(),
+             layoutCell.meshPath.c_str());
+      return 1;
+    }
+
+    printf("%s: %zu materials, %u bytes\n", layoutCell.meshPath.c_str(),
+           cell.mesh.materials.size(), layoutCell.ramSize);
+
+    layout.cells.push_back(layoutCell);
+  }
+
+  auto data = WorldLayoutFile::build(layout);
+  if (data.empty() || !writeFile(outputDir + "world.tyw", data)) {
+    printf("Failed to write %sworld.tyw\n", outputDir.c_str());
+    return 1;
+  }
+
+  printf("%sworld.tyw: %zu cells, %zu textures\n", outputDir.c_str(),
+         layout.cells.size(), layout.textures.size());
+  return 0;
+}